@@ -0,0 +1,140 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestTemporalCacheMemoryLimit.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Tests the memory budget shared by the temporal caches of vtkCPProcessor:
+// the least recently used time steps of all the caches are removed first, and
+// each cache keeps its most recent time step.
+
+#include "vtkCPDataDescription.h"
+#include "vtkCPInputDataDescription.h"
+#include "vtkCPProcessor.h"
+#include "vtkDoubleArray.h"
+#include "vtkImageData.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkPVTemporalDataSetCache.h"
+#include "vtkPointData.h"
+#include "vtkSMSourceProxy.h"
+#include "vtkSmartPointer.h"
+
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+vtkSmartPointer<vtkImageData> NewGrid(int size, double time)
+{
+  auto grid = vtkSmartPointer<vtkImageData>::New();
+  grid->SetDimensions(size, size, size);
+  vtkNew<vtkDoubleArray> values;
+  values->SetName("values");
+  values->SetNumberOfTuples(grid->GetNumberOfPoints());
+  values->Fill(time);
+  grid->GetPointData()->AddArray(values);
+  return grid;
+}
+
+// Runs a time step, the "small" input is cached before the "large" one.
+bool CoProcess(vtkCPProcessor* processor, int step)
+{
+  const double time = 0.1 * step;
+  vtkNew<vtkCPDataDescription> dd;
+  dd->SetTimeData(time, step);
+  dd->AddInput("small");
+  dd->AddInput("large");
+  dd->GetInputDescriptionByName("small")->SetGrid(NewGrid(10, time));
+  dd->GetInputDescriptionByName("large")->SetGrid(NewGrid(20, time));
+  return processor->CoProcess(dd) != 0;
+}
+
+vtkPVTemporalDataSetCache* GetCache(vtkCPProcessor* processor, const char* name)
+{
+  vtkSMSourceProxy* proxy = processor->GetTemporalCache(name);
+  return proxy ? vtkPVTemporalDataSetCache::SafeDownCast(proxy->GetClientSideObject()) : nullptr;
+}
+
+bool CheckSteps(vtkCPProcessor* processor, const char* name, const std::vector<int>& steps)
+{
+  vtkPVTemporalDataSetCache* tc = GetCache(processor, name);
+  bool same = tc && tc->GetNumberOfCachedTimeSteps() == static_cast<int>(steps.size());
+  for (int cc = 0; same && cc < tc->GetNumberOfCachedTimeSteps(); ++cc)
+  {
+    same = tc->GetCachedTimeStep(cc) == 0.1 * steps[cc];
+  }
+  if (!same)
+  {
+    vtkLogF(ERROR, "cache '%s' holds %d time steps instead of %d, or not the expected ones", name,
+      tc ? tc->GetNumberOfCachedTimeSteps() : -1, static_cast<int>(steps.size()));
+  }
+  return same;
+}
+}
+
+int TestTemporalCacheMemoryLimit(int, char* [])
+{
+  vtkNew<vtkCPProcessor> processor;
+  processor->Initialize();
+  processor->SetTemporalCacheSize(10);
+  processor->MakeTemporalCache("small");
+  processor->MakeTemporalCache("large");
+
+  bool success = true;
+  for (int step = 0; step < 3; ++step)
+  {
+    success = CoProcess(processor, step) && success;
+  }
+  success = CheckSteps(processor, "small", { 0, 1, 2 }) && success;
+  success = CheckSteps(processor, "large", { 0, 1, 2 }) && success;
+
+  // all the time steps of a cache have the same size.
+  const vtkTypeInt64 small = processor->GetTemporalCacheMemorySize("small") / 3;
+  const vtkTypeInt64 large = processor->GetTemporalCacheMemorySize("large") / 3;
+  if (small <= 0 || large <= small ||
+    processor->GetTemporalCacheMemorySize() != 3 * (small + large))
+  {
+    vtkLogF(ERROR, "unexpected memory sizes: %lld and %lld per time step",
+      static_cast<long long>(small), static_cast<long long>(large));
+    processor->Finalize();
+    return EXIT_FAILURE;
+  }
+
+  // the oldest time step is the first one of the small input, though the large
+  // input uses more memory.
+  processor->SetTemporalCacheMemoryLimit(3 * large + 2 * small);
+  success = CheckSteps(processor, "small", { 1, 2 }) && success;
+  success = CheckSteps(processor, "large", { 0, 1, 2 }) && success;
+
+  processor->SetTemporalCacheMemoryLimit(2 * large + 2 * small);
+  success = CheckSteps(processor, "small", { 1, 2 }) && success;
+  success = CheckSteps(processor, "large", { 1, 2 }) && success;
+
+  // a new time step removes the oldest one of each cache, in access order.
+  success = CoProcess(processor, 3) && success;
+  success = CheckSteps(processor, "small", { 2, 3 }) && success;
+  success = CheckSteps(processor, "large", { 2, 3 }) && success;
+  if (processor->GetTemporalCacheMemorySize() > processor->GetTemporalCacheMemoryLimit())
+  {
+    vtkLogF(ERROR, "the caches use %lld bytes, more than the limit",
+      static_cast<long long>(processor->GetTemporalCacheMemorySize()));
+    success = false;
+  }
+
+  // the most recent time step of each cache is kept, even above the limit.
+  processor->SetTemporalCacheMemoryLimit(1);
+  success = CheckSteps(processor, "small", { 3 }) && success;
+  success = CheckSteps(processor, "large", { 3 }) && success;
+
+  processor->Finalize();
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -47,6 +47,7 @@ vtkCPInputDataDescription::vtkCPInputDataDescription()
   this->WholeExtent[0] = this->WholeExtent[2] = this->WholeExtent[4] = 0;
   this->WholeExtent[1] = this->WholeExtent[3] = this->WholeExtent[5] = -1;
   this->TemporalCache = nullptr;
+  this->TemporalCacheShallowCopy = false;
 }
 
 //----------------------------------------------------------------------------
@@ -178,6 +179,7 @@ void vtkCPInputDataDescription::ShallowCopy(vtkCPInputDataDescription* idd)
   memcpy(this->WholeExtent, idd->WholeExtent, 6 * sizeof(int));
   this->Internals->Fields = idd->Internals->Fields;
   this->SetTemporalCache(idd->TemporalCache);
+  this->TemporalCacheShallowCopy = idd->TemporalCacheShallowCopy;
 }
 
 //----------------------------------------------------------------------------
@@ -197,4 +199,5 @@ void vtkCPInputDataDescription::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "WholeExtent: " << this->WholeExtent[0] << " " << this->WholeExtent[1] << " "
      << this->WholeExtent[2] << " " << this->WholeExtent[3] << " " << this->WholeExtent[4] << " "
      << this->WholeExtent[5] << "\n";
+  os << indent << "TemporalCacheShallowCopy: " << this->TemporalCacheShallowCopy << "\n";
 }
@@ -108,6 +108,15 @@ public:
   // Get the temporal cache.
   vtkGetObjectMacro(TemporalCache, vtkSMSourceProxy);
 
+  // Description:
+  // When set to true, the temporal cache keeps shallow copies of the grid,
+  // sharing its arrays, instead of deep copies. Only turn it on if the
+  // simulation does not modify these arrays once passed to Catalyst, e.g.
+  // because it allocates new ones at each time step. Off by default.
+  vtkSetMacro(TemporalCacheShallowCopy, bool);
+  vtkGetMacro(TemporalCacheShallowCopy, bool);
+  vtkBooleanMacro(TemporalCacheShallowCopy, bool);
+
 protected:
   vtkCPInputDataDescription();
   ~vtkCPInputDataDescription() override;
@@ -128,6 +137,10 @@ protected:
   // The temporal cache associated with grid. The cache is not owned by the object.
   vtkSMSourceProxy* TemporalCache;
 
+  // Description:
+  // On when the temporal cache may share the arrays of the grid.
+  bool TemporalCacheShallowCopy;
+
 private:
   vtkCPInputDataDescription(const vtkCPInputDataDescription&) = delete;
   void operator=(const vtkCPInputDataDescription&) = delete;
@@ -32,6 +32,7 @@
 #include "vtkMultiProcessController.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
+#include "vtkPVTemporalDataSetCache.h"
 #include "vtkPassArrays.h"
 #include "vtkSMIntVectorProperty.h"
 #include "vtkSMProxy.h"
@@ -40,7 +41,6 @@
 #include "vtkSMSourceProxy.h"
 #include "vtkSmartPointer.h"
 #include "vtkStringArray.h"
-#include "vtkTemporalDataSetCache.h"
 
 #include <list>
 #include <map>
@@ -277,8 +277,10 @@ int vtkCPProcessor::CoProcess(vtkCPDataDescription* dataDescription)
           this->GetTemporalCache(dataDescription->GetInputDescriptionName(i));
         if (cacheForInput)
         {
-          vtkTemporalDataSetCache* tc =
-            vtkTemporalDataSetCache::SafeDownCast(cacheForInput->GetClientSideObject());
+          vtkPVTemporalDataSetCache* tc =
+            vtkPVTemporalDataSetCache::SafeDownCast(cacheForInput->GetClientSideObject());
+          vtkCPInputDataDescription* idd = dataDescription->GetInputDescription(i);
+          tc->SetShallowCopy(idd->GetTemporalCacheShallowCopy());
           tc->SetInputDataObject(input);
 
           tc->UpdateTimeStep(dataDescription->GetTime());
@@ -286,6 +288,7 @@ int vtkCPProcessor::CoProcess(vtkCPDataDescription* dataDescription)
       }
     }
   }
+  this->ShrinkTemporalCaches();
 
   std::string originalWorkingDirectory;
   if (this->WorkingDirectory)
@@ -384,6 +387,8 @@ void vtkCPProcessor::FinalizeAndRemovePipelines()
 void vtkCPProcessor::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "TemporalCacheSize: " << this->TemporalCacheSize << endl;
+  os << indent << "TemporalCacheMemoryLimit: " << this->TemporalCacheMemoryLimit << endl;
 }
 
 //----------------------------------------------------------------------------
@@ -397,13 +402,74 @@ void vtkCPProcessor::SetTemporalCacheSize(int nv)
   for (vtkCPProcessorInternals::CacheListIterator it = this->Internal->TemporalCaches.begin();
        it != this->Internal->TemporalCaches.end(); it++)
   {
-    vtkTemporalDataSetCache* tc =
-      vtkTemporalDataSetCache::SafeDownCast(it->second.GetPointer()->GetClientSideObject());
+    vtkPVTemporalDataSetCache* tc =
+      vtkPVTemporalDataSetCache::SafeDownCast(it->second.GetPointer()->GetClientSideObject());
     tc->SetCacheSize(this->TemporalCacheSize);
   }
   this->Modified();
 }
 
+//----------------------------------------------------------------------------
+void vtkCPProcessor::SetTemporalCacheMemoryLimit(vtkTypeInt64 limit)
+{
+  limit = limit > 0 ? limit : 0;
+  if (this->TemporalCacheMemoryLimit == limit)
+  {
+    return;
+  }
+  this->TemporalCacheMemoryLimit = limit;
+  this->ShrinkTemporalCaches();
+  this->Modified();
+}
+
+//----------------------------------------------------------------------------
+void vtkCPProcessor::ShrinkTemporalCaches()
+{
+  if (this->TemporalCacheMemoryLimit <= 0)
+  {
+    return;
+  }
+  while (this->GetTemporalCacheMemorySize() > this->TemporalCacheMemoryLimit)
+  {
+    // remove the least recently used timestep of all the caches.
+    vtkPVTemporalDataSetCache* oldest = nullptr;
+    for (auto& item : this->Internal->TemporalCaches)
+    {
+      vtkPVTemporalDataSetCache* tc =
+        vtkPVTemporalDataSetCache::SafeDownCast(item.second->GetClientSideObject());
+      if (tc->GetNumberOfCachedTimeSteps() > 1 &&
+        (oldest == nullptr || tc->GetLeastRecentAccess() < oldest->GetLeastRecentAccess()))
+      {
+        oldest = tc;
+      }
+    }
+    if (oldest == nullptr || !oldest->RemoveLeastRecentlyUsedTimeStep())
+    {
+      break;
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+vtkTypeInt64 vtkCPProcessor::GetTemporalCacheMemorySize()
+{
+  vtkTypeInt64 size = 0;
+  for (auto& item : this->Internal->TemporalCaches)
+  {
+    size += this->GetTemporalCacheMemorySize(item.first.c_str());
+  }
+  return size;
+}
+
+//----------------------------------------------------------------------------
+vtkTypeInt64 vtkCPProcessor::GetTemporalCacheMemorySize(const char* name)
+{
+  vtkSMSourceProxy* cache = this->GetTemporalCache(name);
+  vtkPVTemporalDataSetCache* tc =
+    cache ? vtkPVTemporalDataSetCache::SafeDownCast(cache->GetClientSideObject()) : nullptr;
+  return tc ? tc->GetCacheMemorySize() : 0;
+}
+
 //----------------------------------------------------------------------------
 void vtkCPProcessor::MakeTemporalCache(const char* name)
 {
@@ -426,8 +492,8 @@ void vtkCPProcessor::MakeTemporalCache(const char* name)
   producer.TakeReference(vtkSMSourceProxy::SafeDownCast(
     sessionProxyManager->NewProxy("sources", "TemporalCache"))); // note: source
   producer->UpdateVTKObjects();
-  vtkTemporalDataSetCache* tc =
-    vtkTemporalDataSetCache::SafeDownCast(producer->GetClientSideObject());
+  vtkPVTemporalDataSetCache* tc =
+    vtkPVTemporalDataSetCache::SafeDownCast(producer->GetClientSideObject());
   tc->SetCacheSize(this->TemporalCacheSize);
   tc->CacheInMemkindOn();
   this->Internal->TemporalCaches[name] = producer;
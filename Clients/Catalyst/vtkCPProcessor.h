@@ -81,10 +81,24 @@ public:
   virtual void SetTemporalCacheSize(int);
   vtkGetMacro(TemporalCacheSize, int);
 
+  // Controls the memory, in bytes, that all the temporal caches may use
+  // together. When exceeded, the least recently used timesteps of all the
+  // caches are removed, except for the most recent timestep of each cache.
+  // Default is zero, which means no limit.
+  virtual void SetTemporalCacheMemoryLimit(vtkTypeInt64);
+  vtkGetMacro(TemporalCacheMemoryLimit, vtkTypeInt64);
+
   // Accessor to specific temporal cache. Names match CPInputData names
   virtual void MakeTemporalCache(const char* name);
   virtual vtkSMSourceProxy* GetTemporalCache(const char* name);
 
+  // Memory, in bytes, used by all the temporal caches or by the cache of a
+  // specific input. The timesteps held by a cache and the memory used by each
+  // of them are available from its vtkPVTemporalDataSetCache, the client side
+  // object of the proxy returned by GetTemporalCache().
+  virtual vtkTypeInt64 GetTemporalCacheMemorySize();
+  virtual vtkTypeInt64 GetTemporalCacheMemorySize(const char* name);
+
   /// Initialize the co-processor. Returns 1 if successful and 0
   /// otherwise. If Catalyst is built with MPI then Initialize()
   /// can also be called with a specific MPI communicator if
@@ -147,6 +161,12 @@ protected:
    */
   void FinalizeAndRemovePipelines();
 
+  /**
+   * Removes the least recently used timesteps of the temporal caches until
+   * they fit in TemporalCacheMemoryLimit.
+   */
+  void ShrinkTemporalCaches();
+
 private:
   vtkCPProcessor(const vtkCPProcessor&) = delete;
   void operator=(const vtkCPProcessor&) = delete;
@@ -156,6 +176,7 @@ private:
   static vtkMultiProcessController* Controller;
   char* WorkingDirectory;
   int TemporalCacheSize = 0;
+  vtkTypeInt64 TemporalCacheMemoryLimit = 0;
 };
 
 #endif
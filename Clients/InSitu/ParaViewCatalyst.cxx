@@ -151,6 +151,7 @@ void catalyst_initialize(const conduit_node* params)
 void catalyst_execute(const conduit_node* params)
 {
   vtkVLogScopeFunction(PARAVIEW_LOG_CATALYST_VERBOSITY());
+  PARAVIEW_LOG_EVENT_SCOPE(CATALYST, "catalyst_execute");
 
   const auto& cpp_params = (*conduit::cpp_node(params));
   if (!cpp_params.has_path("catalyst"))
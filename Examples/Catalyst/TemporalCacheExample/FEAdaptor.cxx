@@ -14,10 +14,10 @@
 #include <vtkIntArray.h>
 #include <vtkLogger.h>
 #include <vtkNew.h>
+#include <vtkPVTemporalDataSetCache.h>
 #include <vtkPointData.h>
 #include <vtkSMSourceProxy.h>
 #include <vtkStreamingDemandDrivenPipeline.h>
-#include <vtkTemporalDataSetCache.h>
 #include <vtkTemporalStatistics.h>
 #include <vtkUnstructuredGrid.h>
 #include <vtkXMLDataSetWriter.h>
@@ -72,8 +72,8 @@ public:
     vtkSMSourceProxy* pcache = idd->GetTemporalCache();
     // KEY POINT:
     // Get access to the cache
-    vtkTemporalDataSetCache* cache =
-      vtkTemporalDataSetCache::SafeDownCast(pcache->GetClientSideObject());
+    vtkPVTemporalDataSetCache* cache =
+      vtkPVTemporalDataSetCache::SafeDownCast(pcache->GetClientSideObject());
     if (!cache)
     {
       cerr << "Something is wrong, pipeline should have a temporal cache." << endl;
@@ -117,10 +117,11 @@ void pqImageCompressorWidget::setCompressorConfig(const QString& value)
                      "([01])" // strip alpha (0 or 1).
                      "$");
   QRegExp lz4RegExp("^vtkLZ4Compressor"
-                    "\\s+"     // space
-                    "0"        // 0
-                    "\\s+"     // space
-                    "([0-9]+)" // num-of-bits.
+                    "\\s+"          // space
+                    "0"             // 0
+                    "\\s+"          // space
+                    "([0-9]+)"      // num-of-bits.
+                    "(\\s+[0-9]+)?" // optional number of stripes.
                     "$");
   QRegExp nvpipeRegExp("^vtkNvPipeCompressor"
                        "\\s+"     // space
@@ -52,6 +52,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "vtkNew.h"
 #include "vtkPVXMLElement.h"
 #include "vtkSMLiveInsituLinkProxy.h"
+#include "vtkSMOutputPort.h"
 #include "vtkSMParaViewPipelineControllerWithRendering.h"
 #include "vtkSMPropertyHelper.h"
 #include "vtkSMSourceProxy.h"
@@ -441,6 +442,14 @@ private:
       return PipelineModelIconType::DATA_EXTRACTOR;
     }
 
+    // the preferred view type depends on the data information, don't block
+    // the UI while it is gathered. The icon is updated once it is received.
+    vtkSMOutputPort* outputPort = port->getOutputPortProxy();
+    if (outputPort && !outputPort->RequestDataInformation())
+    {
+      return PipelineModelIconType::GEOMETRY;
+    }
+
     QString iconType =
       this->Controller->GetPipelineIcon(port->getSourceProxy(), port->getPortNumber());
     if (!iconType.isEmpty())
@@ -1154,6 +1163,11 @@ void pqPipelineModel::addSource(pqPipelineSource* source)
     SLOT(updateData(pqServerManagerModelItem*)));
   QObject::connect(source, SIGNAL(modifiedStateChanged(pqServerManagerModelItem*)), this,
     SLOT(updateData(pqServerManagerModelItem*)));
+  for (int cc = 0; cc < source->getNumberOfOutputPorts(); cc++)
+  {
+    QObject::connect(source->getOutputPort(cc), SIGNAL(dataInformationUpdated(pqOutputPort*)),
+      this, SLOT(updateDataInformation(pqOutputPort*)));
+  }
 }
 
 //-----------------------------------------------------------------------------
@@ -1550,6 +1564,27 @@ void pqPipelineModel::updateData(pqServerManagerModelItem* source, ItemType type
   }
 }
 
+//-----------------------------------------------------------------------------
+void pqPipelineModel::updateDataInformation(pqOutputPort* port)
+{
+  // the icons are determined from the data information.
+  pqPipelineSource* source = port->getSource();
+  pqServerManagerModelItem* smitem = port;
+  ItemType type = pqPipelineModel::Port;
+  if (source->getNumberOfOutputPorts() == 1)
+  {
+    smitem = source;
+    type = pqPipelineModel::Proxy;
+  }
+
+  pqPipelineModelDataItem* item = this->getDataItem(smitem, &this->Internal->Root, type);
+  if (item)
+  {
+    this->checkAndLoadPipelinePixmap(item->getIconType());
+    this->updateData(smitem, type);
+  }
+}
+
 //-----------------------------------------------------------------------------
 void pqPipelineModel::updateDataServer(pqServer* server)
 {
@@ -63,6 +63,7 @@ class QFont;
 class QPixmap;
 class QString;
 class pqExtractor;
+class pqOutputPort;
 class pqPipelineModelDataItem;
 class pqPipelineModelInternal;
 class pqPipelineSource;
@@ -412,6 +413,11 @@ private Q_SLOTS:
   void updateData(pqServerManagerModelItem*, ItemType type = Proxy);
   void updateDataServer(pqServer* server);
 
+  /**
+  * called when the data information for a port has been received.
+  */
+  void updateDataInformation(pqOutputPort* port);
+
 private:
   friend class pqPipelineModelDataItem;
 
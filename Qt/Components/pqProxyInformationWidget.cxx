@@ -151,6 +151,8 @@ void pqProxyInformationWidget::setOutputPort(pqOutputPort* source)
   {
     QObject::disconnect(this->OutputPort->getSource(), SIGNAL(dataUpdated(pqPipelineSource*)), this,
       SLOT(updateInformation()));
+    QObject::disconnect(this->OutputPort, SIGNAL(dataInformationUpdated(pqOutputPort*)), this,
+      SLOT(updateInformation()));
   }
 
   this->OutputPort = source;
@@ -159,6 +161,8 @@ void pqProxyInformationWidget::setOutputPort(pqOutputPort* source)
   {
     QObject::connect(this->OutputPort->getSource(), SIGNAL(dataUpdated(pqPipelineSource*)), this,
       SLOT(updateInformation()));
+    QObject::connect(this->OutputPort, SIGNAL(dataInformationUpdated(pqOutputPort*)), this,
+      SLOT(updateInformation()));
   }
 
   this->updateInformation();
@@ -174,6 +178,15 @@ pqOutputPort* pqProxyInformationWidget::getOutputPort()
 //-----------------------------------------------------------------------------
 void pqProxyInformationWidget::updateInformation()
 {
+  vtkSMOutputPort* outputPort = this->OutputPort ? this->OutputPort->getOutputPortProxy() : nullptr;
+  if (outputPort && !outputPort->RequestDataInformation())
+  {
+    // don't block the UI while the data information is gathered, the panel
+    // is updated once it has been received.
+    vtkVLogF(PARAVIEW_LOG_APPLICATION_VERBOSITY(), "update-information-panel (pending)");
+    return;
+  }
+
   this->Ui->compositeTreeModel->reset(nullptr);
   this->Ui->hierarchyTabWidget->setVisible(false);
   this->Ui->filename->setText(tr("NA"));
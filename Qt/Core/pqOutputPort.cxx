@@ -32,6 +32,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "pqOutputPort.h"
 
 // Server Manager Includes.
+#include "vtkCommand.h"
 #include "vtkPVClassNameInformation.h"
 #include "vtkPVDataInformation.h"
 #include "vtkSMOutputPort.h"
@@ -42,6 +43,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <QtDebug>
 
 // ParaView Includes.
+#include "pqCoreUtilities.h"
 #include "pqDataRepresentation.h"
 #include "pqPipelineSource.h"
 #include "pqServer.h"
@@ -69,6 +71,9 @@ pqOutputPort::pqOutputPort(pqPipelineSource* source, int portno)
     SIGNAL(visibilityChanged(pqOutputPort*, pqDataRepresentation*)));
   QObject::connect(this, SIGNAL(representationRemoved(pqOutputPort*, pqDataRepresentation*)), this,
     SIGNAL(visibilityChanged(pqOutputPort*, pqDataRepresentation*)));
+
+  pqCoreUtilities::connect(source->getSourceProxy()->GetOutputPort(portno),
+    vtkCommand::UpdateInformationEvent, this, SLOT(onDataInformationUpdated()));
 }
 
 //-----------------------------------------------------------------------------
@@ -251,6 +256,12 @@ void pqOutputPort::onRepresentationVisibilityChanged()
   Q_EMIT this->visibilityChanged(this, qobject_cast<pqDataRepresentation*>(this->sender()));
 }
 
+//-----------------------------------------------------------------------------
+void pqOutputPort::onDataInformationUpdated()
+{
+  Q_EMIT this->dataInformationUpdated(this);
+}
+
 //-----------------------------------------------------------------------------
 pqDataRepresentation* pqOutputPort::getRepresentation(pqView* view) const
 {
@@ -216,8 +216,15 @@ Q_SIGNALS:
   */
   void visibilityChanged(pqOutputPort* source, pqDataRepresentation* repr);
 
+  /**
+  * Fired when the data information requested using
+  * vtkSMOutputPort::RequestDataInformation() has been received.
+  */
+  void dataInformationUpdated(pqOutputPort* source);
+
 protected Q_SLOTS:
   void onRepresentationVisibilityChanged();
+  void onDataInformationUpdated();
 
 protected:
   friend class pqPipelineFilter;
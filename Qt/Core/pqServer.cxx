@@ -79,6 +79,9 @@ public:
 
   QTimer ServerLifeTimeTimer;
 
+  // Used to process the replies to asynchronous information requests.
+  QTimer InformationReplyTimer;
+
   // remaining time in minutes
   int RemainingLifeTime{ -1 };
 
@@ -118,6 +121,15 @@ pqServer::pqServer(vtkIdType connectionID, vtkPVOptions* options, QObject* _pare
   QObject::connect(
     &this->IdleCollaborationTimer, SIGNAL(timeout()), this, SLOT(processServerNotification()));
 
+  // Process the replies to vtkSMSession::GatherInformationAsync() requests
+  // while the event loop is running.
+  this->Internals->InformationReplyTimer.setInterval(10);
+  this->Internals->InformationReplyTimer.setSingleShot(true);
+  QObject::connect(&this->Internals->InformationReplyTimer, &QTimer::timeout, this,
+    &pqServer::processInformationReplies);
+  this->Internals->VTKConnect->Connect(this->Session, vtkSMSession::InformationRequestedEvent,
+    &this->Internals->InformationReplyTimer, SLOT(start()));
+
   // Monitor server crash for better error management
   this->Internals->VTKConnect->Connect(this->Session, vtkPVSessionBase::ConnectionLost, this,
     SLOT(onConnectionLost(vtkObject*, ulong, void*, void*)));
@@ -435,6 +447,32 @@ void pqServer::processServerNotification()
   this->IdleCollaborationTimer.start();
 }
 
+//-----------------------------------------------------------------------------
+void pqServer::processInformationReplies()
+{
+  vtkSMSessionClient* sessionClient = vtkSMSessionClient::SafeDownCast(this->Session);
+  if (!sessionClient || sessionClient->GetNumberOfPendingInformationRequests() == 0)
+  {
+    return;
+  }
+
+  if (sessionClient->IsNotBusy())
+  {
+    vtkNetworkAccessManager* nam =
+      vtkProcessModule::GetProcessModule()->GetNetworkAccessManager();
+    while (sessionClient->GetNumberOfPendingInformationRequests() > 0 &&
+      nam->ProcessEvents(1) == 1)
+    {
+    }
+  }
+
+  if (sessionClient->GetNumberOfPendingInformationRequests() > 0)
+  {
+    // try again later.
+    this->Internals->InformationReplyTimer.start();
+  }
+}
+
 //-----------------------------------------------------------------------------
 void pqServer::onCollaborationCommunication(
   vtkObject* vtkNotUsed(src), unsigned long event_, void* vtkNotUsed(method), void* data)
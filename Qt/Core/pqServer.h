@@ -260,6 +260,12 @@ protected Q_SLOTS:
   */
   void processServerNotification();
 
+  /**
+  * Called when idle to process the replies to asynchronous information
+  * requests i.e. vtkSMSession::GatherInformationAsync().
+  */
+  void processInformationReplies();
+
   /**
   * Called by vtkSMCollaborationManager when associated message happen.
   * This will convert the given parameter into vtkSMMessage and
@@ -100,6 +100,7 @@ public:
   QItemSelectionModel SelectionModel;
   pqTimer Timer;
   pqTimer SelectionTimer;
+  pqTimer PrefetchTimer;
   int DecimalPrecision;
   bool FixedRepresentation;
   vtkIdType LastRowCount;
@@ -132,6 +133,12 @@ pqSpreadSheetViewModel::pqSpreadSheetViewModel(vtkSMProxy* view, QObject* parent
   this->Internal->Timer.setInterval(500); // milliseconds.
   QObject::connect(&this->Internal->Timer, SIGNAL(timeout()), this, SLOT(delayedUpdate()));
 
+  // prefetch once the fetched rows have been shown, i.e. when idle.
+  this->Internal->PrefetchTimer.setSingleShot(true);
+  this->Internal->PrefetchTimer.setInterval(0);
+  QObject::connect(
+    &this->Internal->PrefetchTimer, SIGNAL(timeout()), this, SLOT(prefetchBlock()));
+
   this->Internal->SelectionTimer.setSingleShot(true);
   this->Internal->SelectionTimer.setInterval(100); // milliseconds.
   QObject::connect(
@@ -212,6 +219,7 @@ void pqSpreadSheetViewModel::forceUpdate()
   this->Internal->SelectionModel.clear();
   this->Internal->Timer.stop();
   this->Internal->SelectionTimer.stop();
+  this->Internal->PrefetchTimer.stop();
 
   vtkIdType& rows = this->Internal->LastRowCount;
   vtkIdType& columns = this->Internal->LastColumnCount;
@@ -248,6 +256,14 @@ void pqSpreadSheetViewModel::delayedUpdate()
   }
 }
 
+//-----------------------------------------------------------------------------
+void pqSpreadSheetViewModel::prefetchBlock()
+{
+  // a block is fetched at a time, fetching it fires onDataFetched() which
+  // schedules the next one.
+  this->Internal->VTKView->PrefetchBlock();
+}
+
 //-----------------------------------------------------------------------------
 void pqSpreadSheetViewModel::triggerSelectionChanged()
 {
@@ -287,6 +303,8 @@ void pqSpreadSheetViewModel::onDataFetched(vtkObject*, unsigned long, void*, voi
   this->dataChanged(topLeft, bottomRight);
   // we always invalidate header data, just to be on a safe side.
   this->headerDataChanged(Qt::Horizontal, 0, this->columnCount() - 1);
+
+  this->Internal->PrefetchTimer.start();
 }
 namespace
 {
@@ -219,6 +219,11 @@ private Q_SLOTS:
   */
   void delayedUpdate();
 
+  /**
+  * called when idle to fetch the blocks likely to be shown next.
+  */
+  void prefetchBlock();
+
   void triggerSelectionChanged();
 
   /**
@@ -0,0 +1,81 @@
+# Tests the time index file of vtkFileSeriesReader: the time of each file is
+# saved next to the first file, reused while the files are unchanged and
+# ignored once one of them changes.
+
+from paraview.simple import *
+from paraview import smtesting
+from vtkmodules.vtkFiltersSources import vtkSphereSource
+from vtkmodules.vtkIOXML import vtkXMLPolyDataWriter
+
+import json
+import os
+import os.path
+
+smtesting.ProcessCommandLineArguments()
+
+pm = servermanager.vtkProcessModule.GetProcessModule()
+controller = pm.GetGlobalController()
+rank = controller.GetLocalProcessId() if controller else 0
+
+def write_file(fname, times, resolution):
+    sphere = vtkSphereSource()
+    sphere.SetThetaResolution(resolution)
+    writer = vtkXMLPolyDataWriter()
+    writer.SetInputConnection(sphere.GetOutputPort())
+    writer.SetFileName(fname)
+    writer.SetNumberOfTimeSteps(len(times))
+    writer.Start()
+    for t in times:
+        writer.WriteNextTime(t)
+    writer.Stop()
+
+def barrier():
+    if pm.GetSymmetricMPIMode() and controller:
+        controller.Barrier()
+
+def read_times(files):
+    reader = XMLPolyDataReader(FileName=files)
+    reader.GetClientSideObject().SetUseIndexFile(True)
+    reader.UpdatePipelineInformation()
+    times = list(reader.TimestepValues)
+    index = reader.GetClientSideObject().GetIndexFileName()
+    Delete(reader)
+    return times, index
+
+files = [os.path.join(smtesting.TempDir, "FileSeriesTimeIndex_%d.vtp" % i) for i in range(4)]
+expected = [float(t) for t in range(8)]
+if rank == 0:
+    for i, fname in enumerate(files):
+        write_file(fname, [2 * i, 2 * i + 1], 8)
+    stale = os.path.join(smtesting.TempDir, ".FileSeriesTimeIndex_0.vtp.series-index")
+    if os.path.exists(stale):
+        os.remove(stale)
+barrier()
+
+# the reader is queried and the index written.
+times, index = read_times(files)
+if times != expected:
+    raise smtesting.TestError("Incorrect times %s, expected %s." % (times, expected))
+if rank == 0 and not os.path.exists(index):
+    raise smtesting.TestError("Index file '%s' was not written." % index)
+
+# the index is used while the files are unchanged.
+if rank == 0:
+    with open(index) as f:
+        root = json.load(f)
+    root["files"][2]["time-steps"] = [100.0, 101.0]
+    root["files"][2]["time-range"] = [100.0, 101.0]
+    with open(index, "w") as f:
+        json.dump(root, f)
+barrier()
+times, index = read_times(files)
+if times != expected[:4] + expected[6:] + [100.0, 101.0]:
+    raise smtesting.TestError("Index file was not used, times %s." % times)
+
+# the index is ignored once a file changes.
+if rank == 0:
+    write_file(files[2], [4, 5], 16)
+barrier()
+times, index = read_times(files)
+if times != expected:
+    raise smtesting.TestError("Outdated index file was used, times %s." % times)
@@ -37,6 +37,8 @@ s.ThetaResolution = 80
 
 SaveData(join(rootdir, "sphere-cont.stl"), s, NumberOfIORanks=2, RankAssignmentMode="Contiguous")
 SaveData(join(rootdir, "sphere-rr.stl"), s, NumberOfIORanks=2, RankAssignmentMode="RoundRobin")
+SaveData(join(rootdir, "sphere-stream.stl"), s, NumberOfIORanks=2, RankAssignmentMode="Contiguous",
+    AggregationMode="Streaming", MaximumChunkSize=1)
 
 
 Barrier()
@@ -44,6 +46,20 @@ Barrier()
 
 c0 = OpenDataFile(join(rootdir, "sphere-cont-0.stl"))
 c1 = OpenDataFile(join(rootdir, "sphere-cont-1.stl"))
+
+# streaming aggregation must write the same data as gathering it.
+for i in range(2):
+    cont = OpenDataFile(join(rootdir, "sphere-cont-%d.stl" % i))
+    stream = OpenDataFile(join(rootdir, "sphere-stream-%d.stl" % i))
+    UpdatePipeline(proxy=cont)
+    UpdatePipeline(proxy=stream)
+    ncont = cont.GetDataInformation().GetNumberOfCells()
+    nstream = stream.GetDataInformation().GetNumberOfCells()
+    if ncont != nstream:
+        raise smtesting.TestError("Streaming aggregation wrote %d cells instead of %d." % (nstream, ncont))
+    Delete(cont)
+    Delete(stream)
+
 grc = GroupDatasets(Input=[c0, c1])
 dc = Show(grc)
 
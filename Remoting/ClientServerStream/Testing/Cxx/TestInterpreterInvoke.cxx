@@ -0,0 +1,122 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestInterpreterInvoke.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Tests that vtkClientServerInterpreter passes the right arguments to command
+// functions, both when a message is used in place and when it has to be
+// expanded first.
+
+#include "vtkClientServerInterpreter.h"
+#include "vtkClientServerStream.h"
+#include "vtkDoubleArray.h"
+#include "vtkNew.h"
+
+#include <cstring>
+#include <vector>
+
+namespace
+{
+struct InvokeInformation
+{
+  const vtkClientServerStream* LastMessage;
+  std::vector<double> LastValues;
+};
+
+int DoubleArrayCommand(vtkClientServerInterpreter*, vtkObjectBase*, const char* method,
+  const vtkClientServerStream& msg, vtkClientServerStream& result, void* ctx)
+{
+  InvokeInformation* info = static_cast<InvokeInformation*>(ctx);
+  info->LastMessage = &msg;
+  info->LastValues.clear();
+  if (strcmp(method, "SetValues") != 0)
+  {
+    return 0;
+  }
+
+  for (int cc = 2; cc < msg.GetNumberOfArguments(0); ++cc)
+  {
+    vtkTypeUInt32 length;
+    if (msg.GetArgumentLength(0, cc, &length))
+    {
+      const size_t offset = info->LastValues.size();
+      info->LastValues.resize(offset + length);
+      if (length > 0 && !msg.GetArgument(0, cc, &info->LastValues[offset], length))
+      {
+        return 0;
+      }
+    }
+    else
+    {
+      double value;
+      if (!msg.GetArgument(0, cc, &value))
+      {
+        return 0;
+      }
+      info->LastValues.push_back(value);
+    }
+  }
+  result << vtkClientServerStream::Reply << static_cast<int>(info->LastValues.size())
+         << vtkClientServerStream::End;
+  return 1;
+}
+}
+
+int TestInterpreterInvoke(int, char* [])
+{
+  vtkNew<vtkClientServerInterpreter> interp;
+  InvokeInformation info;
+  interp->AddCommandFunction("vtkDoubleArray", DoubleArrayCommand, &info);
+
+  vtkNew<vtkDoubleArray> array;
+  std::vector<double> values(100000);
+  for (size_t cc = 0; cc < values.size(); ++cc)
+  {
+    values[cc] = static_cast<double>(cc);
+  }
+
+  // The first message has nothing to expand, it must be used in place.
+  vtkClientServerStream css;
+  css << vtkClientServerStream::Invoke << array.GetPointer() << "SetValues"
+      << vtkClientServerStream::InsertArray(&values[0], static_cast<int>(values.size()))
+      << vtkClientServerStream::End;
+  if (!interp->ProcessStream(css) || info.LastMessage != &css || info.LastValues != values)
+  {
+    cerr << "ERROR: message without references was not passed in place." << endl;
+    return EXIT_FAILURE;
+  }
+
+  // Messages referring to other values must be expanded.
+  css.Reset();
+  css << vtkClientServerStream::Assign << vtkClientServerID(1) << 12.0 << 13.0
+      << vtkClientServerStream::End;
+  css << vtkClientServerStream::Invoke << array.GetPointer() << "SetValues" << 11.0
+      << vtkClientServerID(1) << vtkClientServerStream::End;
+  if (!interp->ProcessStream(css) || info.LastMessage == &css || info.LastValues.size() != 3 ||
+    info.LastValues[0] != 11.0 || info.LastValues[1] != 12.0 || info.LastValues[2] != 13.0)
+  {
+    cerr << "ERROR: message with an id argument was not expanded." << endl;
+    return EXIT_FAILURE;
+  }
+
+  // the last result is the number of values set by the previous invocation.
+  css.Reset();
+  css << vtkClientServerStream::Invoke << array.GetPointer() << "SetValues" << 1.0
+      << vtkClientServerStream::LastResult << vtkClientServerStream::End;
+  if (!interp->ProcessStream(css) || info.LastMessage == &css || info.LastValues.size() != 2 ||
+    info.LastValues[1] != 3.0)
+  {
+    cerr << "ERROR: message with the last result was not expanded." << endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
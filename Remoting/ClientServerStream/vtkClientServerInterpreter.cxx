@@ -25,10 +25,33 @@
 #include <map>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 vtkStandardNewMacro(vtkClientServerInterpreter);
 
+//----------------------------------------------------------------------------
+// Returns whether any argument of the given message starting at the given
+// index refers to a value that vtkClientServerInterpreter::ExpandMessage
+// must replace.
+static bool vtkClientServerInterpreterNeedsExpansion(
+  const vtkClientServerStream& css, int midx, int startArgument)
+{
+  for (int a = startArgument; a < css.GetNumberOfArguments(midx); ++a)
+  {
+    switch (css.GetArgumentType(midx, a))
+    {
+      case vtkClientServerStream::id_value:
+      case vtkClientServerStream::LastResult:
+      case vtkClientServerStream::stream_value:
+        return true;
+      default:
+        break;
+    }
+  }
+  return false;
+}
+
 //----------------------------------------------------------------------------
 class vtkClientServerInterpreterInternals
 {
@@ -70,12 +93,23 @@ public:
   };
   typedef FunctionWithContext<vtkClientServerNewInstanceFunction> NewInstanceFunction;
   typedef FunctionWithContext<vtkClientServerCommandFunction> CommandFunction;
-  typedef std::map<std::string, const NewInstanceFunction*> NewInstanceFunctionsType;
-  typedef std::map<std::string, const CommandFunction*> ClassToFunctionMapType;
+  typedef std::unordered_map<std::string, const NewInstanceFunction*> NewInstanceFunctionsType;
+  typedef std::unordered_map<std::string, const CommandFunction*> ClassToFunctionMapType;
   typedef std::map<vtkTypeUInt32, vtkClientServerStream*> IDToMessageMapType;
   NewInstanceFunctionsType NewInstanceFunctions;
   ClassToFunctionMapType ClassToFunctionMap;
   IDToMessageMapType IDToMessageMap;
+
+  // Look up the command function for a class, returns nullptr if there is none.
+  const CommandFunction* FindCommandFunction(const char* cname) const
+  {
+    if (!cname)
+    {
+      return nullptr;
+    }
+    ClassToFunctionMapType::const_iterator iter = this->ClassToFunctionMap.find(cname);
+    return iter != this->ClassToFunctionMap.end() ? iter->second : nullptr;
+  }
 };
 
 //----------------------------------------------------------------------------
@@ -350,10 +384,11 @@ int vtkClientServerInterpreter::ProcessCommandNew(const vtkClientServerStream& c
 
     // Find a NewInstance function that knows about the class.
     int created = 0;
-    if (this->Internal->NewInstanceFunctions.count(cname))
+    vtkClientServerInterpreterInternals::NewInstanceFunctionsType::const_iterator iter =
+      this->Internal->NewInstanceFunctions.find(cname);
+    if (iter != this->Internal->NewInstanceFunctions.end())
     {
-      const vtkClientServerInterpreterInternals::NewInstanceFunction* n =
-        this->Internal->NewInstanceFunctions[cname];
+      const vtkClientServerInterpreterInternals::NewInstanceFunction* n = iter->second;
       vtkClientServerNewInstanceFunction function = n->Function;
       void* ctx = n->Context ? n->Context->Context : 0;
       this->NewInstance(function(ctx), id);
@@ -392,13 +427,23 @@ int vtkClientServerInterpreter::ProcessCommandNew(const vtkClientServerStream& c
 //----------------------------------------------------------------------------
 int vtkClientServerInterpreter::ProcessCommandInvoke(const vtkClientServerStream& css, int midx)
 {
-  // Create a message with all known id_value arguments expanded.
-  vtkClientServerStream msg;
-  if (!this->ExpandMessage(css, midx, 0, msg))
+  // Create a message with all known id_value arguments expanded.  Command
+  // functions always read message 0, so when the first message has nothing
+  // to expand it is used in place instead of copying all its arguments,
+  // which may include large arrays.
+  vtkClientServerStream expanded;
+  const vtkClientServerStream* msgPtr = &css;
+  if (midx != 0 || &css == this->LastResultMessage ||
+    vtkClientServerInterpreterNeedsExpansion(css, midx, 0))
   {
-    // ExpandMessage left an error in the LastResultMessage for us.
-    return 0;
+    if (!this->ExpandMessage(css, midx, 0, expanded))
+    {
+      // ExpandMessage left an error in the LastResultMessage for us.
+      return 0;
+    }
+    msgPtr = &expanded;
   }
+  const vtkClientServerStream& msg = *msgPtr;
 
   // Now that id_values have been expanded, we do not need the last
   // result.  Reset the result to empty before processing the message.
@@ -414,15 +459,17 @@ int vtkClientServerInterpreter::ProcessCommandInvoke(const vtkClientServerStream
     if (this->LogStream)
     {
       *this->LogStream << "Invoking ";
-      msg.Print(*this->LogStream);
+      msg.PrintMessage(*this->LogStream, 0);
       this->LogStream->flush();
     }
 
     // Find the command function for this object's type.
-    if (obj && this->HasCommandFunction(obj->GetClassName()))
+    const vtkClientServerInterpreterInternals::CommandFunction* command =
+      obj ? this->Internal->FindCommandFunction(obj->GetClassName()) : nullptr;
+    if (command)
     {
-      if (this->CallCommandFunction(
-            obj->GetClassName(), obj, method, msg, *this->LastResultMessage))
+      void* ctx = command->Context ? command->Context->Context : 0;
+      if (command->Function(this, obj, method, msg, *this->LastResultMessage, ctx))
       {
         return 1;
       }
@@ -782,11 +829,7 @@ void vtkClientServerInterpreter::AddCommandFunction(const char* cname,
 //----------------------------------------------------------------------------
 bool vtkClientServerInterpreter::HasCommandFunction(const char* cname)
 {
-  if (!cname)
-  {
-    return false;
-  }
-  return (this->Internal->ClassToFunctionMap.count(cname) > 0);
+  return this->Internal->FindCommandFunction(cname) != nullptr;
 }
 
 //----------------------------------------------------------------------------
@@ -809,6 +852,23 @@ int vtkClientServerInterpreter::CallCommandFunction(const char* cname, vtkObject
   return function(this, ptr, method, msg, result, ctx);
 }
 
+//----------------------------------------------------------------------------
+int vtkClientServerInterpreter::CallCommandFunctionIfAvailable(const char* cname,
+  vtkObjectBase* ptr, const char* method, const vtkClientServerStream& msg,
+  vtkClientServerStream& result)
+{
+  const vtkClientServerInterpreterInternals::CommandFunction* n =
+    this->Internal->FindCommandFunction(cname);
+  if (!n)
+  {
+    return 0;
+  }
+
+  void* ctx = n->Context ? n->Context->Context : 0;
+  return n->Function(this, ptr, method, msg, result, ctx);
+}
+
+//----------------------------------------------------------------------------
 void vtkClientServerInterpreter::AddNewInstanceFunction(const char* name,
   vtkClientServerNewInstanceFunction f, void* ctx, vtkContextFreeFunction freeFunction)
 {
@@ -1000,13 +1060,14 @@ vtkClientServerID vtkClientServerInterpreter::GetNextAvailableId()
 //----------------------------------------------------------------------------
 vtkObjectBase* vtkClientServerInterpreter::NewInstance(const char* classname)
 {
-  if (!this->Internal->NewInstanceFunctions.count(classname))
+  vtkClientServerInterpreterInternals::NewInstanceFunctionsType::const_iterator iter =
+    this->Internal->NewInstanceFunctions.find(classname);
+  if (iter == this->Internal->NewInstanceFunctions.end())
   {
     return NULL;
   }
 
-  const vtkClientServerInterpreterInternals::NewInstanceFunction* n =
-    this->Internal->NewInstanceFunctions[classname];
+  const vtkClientServerInterpreterInternals::NewInstanceFunction* n = iter->second;
 
   vtkClientServerNewInstanceFunction function = n->Function;
   void* ctx = n->Context ? n->Context->Context : 0;
@@ -149,6 +149,32 @@ public:
   int CallCommandFunction(const char* classname, vtkObjectBase* ptr, const char* method,
     const vtkClientServerStream& msg, vtkClientServerStream& result);
 
+  /**
+   * Call the command function for the class if there is one.  Returns 0 if
+   * the class has no command function, otherwise the value returned by the
+   * command function.  This is used by generated code to forward unknown
+   * methods to the superclass with a single lookup.
+   */
+  int CallCommandFunctionIfAvailable(const char* classname, vtkObjectBase* ptr,
+    const char* method, const vtkClientServerStream& msg, vtkClientServerStream& result);
+
+  /**
+   * Hash of a method name used by the generated command functions to
+   * dispatch to the requested method without comparing it to the name of
+   * every wrapped method.  This must match the hash computed by the
+   * WrapClientServer tool.
+   */
+  static vtkTypeUInt32 GetMethodNameHash(const char* method)
+  {
+    // 32-bit FNV-1a
+    vtkTypeUInt32 hash = 2166136261u;
+    for (; method && *method; ++method)
+    {
+      hash = (hash ^ static_cast<unsigned char>(*method)) * 16777619u;
+    }
+    return hash;
+  }
+
   /**
    * Add a function used to create new objects.
    */
@@ -0,0 +1,209 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestCompositeDataInformation.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Tests that the information gathered for composite datasets with many blocks,
+// which is computed concurrently, matches merging the blocks one at a time,
+// also when some blocks are null or have no points, and when blocks are
+// repeated or share their coordinates, which must be processed serially.
+
+#include "vtkDoubleArray.h"
+#include "vtkImageData.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkMultiPieceDataSet.h"
+#include "vtkNew.h"
+#include "vtkPVArrayInformation.h"
+#include "vtkPVDataInformation.h"
+#include "vtkPVDataSetAttributesInformation.h"
+#include "vtkPointData.h"
+#include "vtkRectilinearGrid.h"
+#include "vtkSmartPointer.h"
+
+#include <cstring>
+
+namespace
+{
+vtkSmartPointer<vtkImageData> GetBlock(int index)
+{
+  vtkNew<vtkImageData> img;
+  img->SetDimensions(3, 3, 3);
+  img->SetOrigin(2.0 * index, 0, 0);
+
+  vtkNew<vtkDoubleArray> values;
+  values->SetName("values");
+  values->SetNumberOfTuples(img->GetNumberOfPoints());
+  for (vtkIdType cc = 0; cc < values->GetNumberOfTuples(); ++cc)
+  {
+    values->SetTypedComponent(cc, 0, index * 100 + cc);
+  }
+  img->GetPointData()->AddArray(values);
+
+  // only every other block has this array, it must be flagged as partial.
+  if (index % 2 == 0)
+  {
+    vtkNew<vtkDoubleArray> partial;
+    partial->SetName("partial");
+    partial->SetNumberOfTuples(img->GetNumberOfPoints());
+    partial->Fill(-index);
+    img->GetPointData()->AddArray(partial);
+  }
+  return img;
+}
+
+bool Compare(vtkPVDataInformation* info, vtkPVDataInformation* expected)
+{
+  if (info->GetNumberOfPoints() != expected->GetNumberOfPoints() ||
+    info->GetNumberOfCells() != expected->GetNumberOfCells() ||
+    info->GetNumberOfDataSets() != expected->GetNumberOfDataSets() ||
+    info->GetMemorySize() != expected->GetMemorySize())
+  {
+    cerr << "ERROR: mismatched counts." << endl;
+    return false;
+  }
+
+  double* bds = info->GetBounds();
+  double* ebds = expected->GetBounds();
+  for (int cc = 0; cc < 6; ++cc)
+  {
+    if (bds[cc] != ebds[cc])
+    {
+      cerr << "ERROR: mismatched bounds." << endl;
+      return false;
+    }
+  }
+
+  vtkPVDataSetAttributesInformation* pd = info->GetPointDataInformation();
+  vtkPVDataSetAttributesInformation* epd = expected->GetPointDataInformation();
+  if (pd->GetNumberOfArrays() != epd->GetNumberOfArrays())
+  {
+    cerr << "ERROR: mismatched number of point arrays." << endl;
+    return false;
+  }
+  for (int cc = 0; cc < pd->GetNumberOfArrays(); ++cc)
+  {
+    vtkPVArrayInformation* ainfo = pd->GetArrayInformation(cc);
+    vtkPVArrayInformation* eainfo = epd->GetArrayInformation(cc);
+    double range[2], erange[2];
+    ainfo->GetComponentRange(0, range);
+    eainfo->GetComponentRange(0, erange);
+    if (strcmp(ainfo->GetName(), eainfo->GetName()) != 0 ||
+      ainfo->GetIsPartial() != eainfo->GetIsPartial() || range[0] != erange[0] ||
+      range[1] != erange[1])
+    {
+      cerr << "ERROR: mismatched information for array `" << eainfo->GetName() << "`." << endl;
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestCompositeDataInformation(int, char* [])
+{
+  const unsigned int numBlocks = 1000;
+
+  vtkNew<vtkMultiBlockDataSet> mb;
+  vtkNew<vtkMultiPieceDataSet> mp;
+  mp->SetNumberOfPieces(numBlocks);
+  mb->SetNumberOfBlocks(numBlocks);
+
+  vtkNew<vtkPVDataInformation> expected;
+  for (unsigned int cc = 0; cc < numBlocks; ++cc)
+  {
+    // leave a few null blocks.
+    if (cc % 7 == 3)
+    {
+      continue;
+    }
+    // and a few blocks without points, including the first one.
+    vtkSmartPointer<vtkImageData> block;
+    if (cc == 0 || cc % 11 == 5 || (cc > 500 && cc < 520))
+    {
+      block = vtkSmartPointer<vtkImageData>::New();
+    }
+    else
+    {
+      block = GetBlock(cc);
+    }
+    mb->SetBlock(cc, block);
+    mp->SetPiece(cc, block);
+
+    vtkNew<vtkPVDataInformation> blockInfo;
+    blockInfo->CopyFromObject(block);
+    expected->AddInformation(blockInfo, /*addingParts=*/1);
+  }
+
+  vtkNew<vtkPVDataInformation> mbInfo;
+  mbInfo->CopyFromObject(mb);
+  if (!Compare(mbInfo, expected))
+  {
+    cerr << "ERROR: vtkMultiBlockDataSet information is incorrect." << endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkPVDataInformation> mpInfo;
+  mpInfo->CopyFromObject(mp);
+  if (!Compare(mpInfo, expected))
+  {
+    cerr << "ERROR: vtkMultiPieceDataSet information is incorrect." << endl;
+    return EXIT_FAILURE;
+  }
+
+  if (mbInfo->GetArrayInformation("partial", vtkDataObject::POINT) == nullptr ||
+    !mbInfo->GetArrayInformation("partial", vtkDataObject::POINT)->GetIsPartial())
+  {
+    cerr << "ERROR: `partial` should have been flagged as partial." << endl;
+    return EXIT_FAILURE;
+  }
+
+  // rectilinear grids sharing their coordinates, and a repeated block.
+  vtkNew<vtkDoubleArray> coords;
+  coords->SetNumberOfTuples(3);
+  for (vtkIdType cc = 0; cc < 3; ++cc)
+  {
+    coords->SetValue(cc, cc);
+  }
+  vtkNew<vtkMultiBlockDataSet> shared;
+  shared->SetNumberOfBlocks(100);
+  vtkNew<vtkPVDataInformation> sharedExpected;
+  for (unsigned int cc = 0; cc < 100; ++cc)
+  {
+    vtkSmartPointer<vtkRectilinearGrid> grid;
+    if (cc % 10 == 9)
+    {
+      grid = vtkRectilinearGrid::SafeDownCast(shared->GetBlock(cc - 1));
+    }
+    else
+    {
+      grid = vtkSmartPointer<vtkRectilinearGrid>::New();
+      grid->SetDimensions(3, 3, 3);
+      grid->SetXCoordinates(coords);
+      grid->SetYCoordinates(coords);
+      grid->SetZCoordinates(coords);
+    }
+    shared->SetBlock(cc, grid);
+
+    vtkNew<vtkPVDataInformation> blockInfo;
+    blockInfo->CopyFromObject(grid);
+    sharedExpected->AddInformation(blockInfo, /*addingParts=*/1);
+  }
+
+  vtkNew<vtkPVDataInformation> sharedInfo;
+  sharedInfo->CopyFromObject(shared);
+  if (!Compare(sharedInfo, sharedExpected))
+  {
+    cerr << "ERROR: information of blocks sharing coordinates is incorrect." << endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
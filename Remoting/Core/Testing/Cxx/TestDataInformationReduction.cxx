@@ -0,0 +1,251 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestDataInformationReduction.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Tests that merging the data information of several ranks gives the same
+// result with the flat gather used by vtkPVSessionCore::CollectInformation()
+// and the binomial tree used by vtkPVSessionCore::ReduceInformation(), when
+// some ranks have empty or no pieces. The information are serialized between
+// merges as they are between processes.
+
+#include "vtkClientServerStream.h"
+#include "vtkDoubleArray.h"
+#include "vtkImageData.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkPVArrayInformation.h"
+#include "vtkPVDataInformation.h"
+#include "vtkPVDataSetAttributesInformation.h"
+#include "vtkPointData.h"
+#include "vtkPolyData.h"
+#include "vtkSmartPointer.h"
+#include "vtkSphereSource.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace
+{
+vtkSmartPointer<vtkPVDataInformation> RoundTrip(vtkPVDataInformation* info)
+{
+  vtkClientServerStream stream;
+  info->CopyToStream(&stream);
+  const unsigned char* data;
+  size_t length;
+  stream.GetData(&data, &length);
+
+  vtkClientServerStream rcvStream;
+  rcvStream.SetData(data, length);
+  auto result = vtkSmartPointer<vtkPVDataInformation>::New();
+  result->CopyFromStream(&rcvStream);
+  return result;
+}
+
+vtkSmartPointer<vtkPVDataInformation> Flat(const std::vector<vtkDataObject*>& pieces)
+{
+  auto result = vtkSmartPointer<vtkPVDataInformation>::New();
+  result->CopyFromObject(pieces[0]);
+  for (size_t rank = 1; rank < pieces.size(); ++rank)
+  {
+    vtkNew<vtkPVDataInformation> info;
+    info->CopyFromObject(pieces[rank]);
+    result->AddInformation(RoundTrip(info));
+  }
+  return result;
+}
+
+vtkSmartPointer<vtkPVDataInformation> Tree(const std::vector<vtkDataObject*>& pieces)
+{
+  const int nranks = static_cast<int>(pieces.size());
+  std::vector<vtkSmartPointer<vtkPVDataInformation> > partial(nranks);
+  for (int rank = 0; rank < nranks; ++rank)
+  {
+    partial[rank] = vtkSmartPointer<vtkPVDataInformation>::New();
+    partial[rank]->CopyFromObject(pieces[rank]);
+  }
+  for (int step = 1; step < nranks; step *= 2)
+  {
+    for (int rank = 0; rank + step < nranks; rank += 2 * step)
+    {
+      partial[rank]->AddInformation(RoundTrip(partial[rank + step]));
+    }
+  }
+  return partial[0];
+}
+
+bool SameString(const char* a, const char* b)
+{
+  return (a == nullptr || b == nullptr) ? a == b : strcmp(a, b) == 0;
+}
+
+bool Compare(vtkPVDataInformation* tree, vtkPVDataInformation* flat, const std::string& label)
+{
+  if (tree->GetNumberOfDataSets() != flat->GetNumberOfDataSets() ||
+    tree->GetNumberOfPoints() != flat->GetNumberOfPoints() ||
+    tree->GetNumberOfCells() != flat->GetNumberOfCells() ||
+    tree->GetPolygonCount() != flat->GetPolygonCount())
+  {
+    cerr << "ERROR: " << label << ": mismatched counts, " << tree->GetNumberOfDataSets()
+         << " data sets instead of " << flat->GetNumberOfDataSets() << "." << endl;
+    return false;
+  }
+  if (tree->GetDataSetType() != flat->GetDataSetType() ||
+    !SameString(tree->GetDataClassName(), flat->GetDataClassName()))
+  {
+    cerr << "ERROR: " << label << ": mismatched data set type." << endl;
+    return false;
+  }
+  if (tree->GetCompositeDataSetType() != flat->GetCompositeDataSetType() ||
+    !SameString(tree->GetCompositeDataClassName(), flat->GetCompositeDataClassName()))
+  {
+    cerr << "ERROR: " << label << ": mismatched composite data set type." << endl;
+    return false;
+  }
+  for (int cc = 0; cc < 6; ++cc)
+  {
+    if (tree->GetBounds()[cc] != flat->GetBounds()[cc])
+    {
+      cerr << "ERROR: " << label << ": mismatched bounds." << endl;
+      return false;
+    }
+  }
+
+  vtkPVDataSetAttributesInformation* pd = tree->GetPointDataInformation();
+  vtkPVDataSetAttributesInformation* fpd = flat->GetPointDataInformation();
+  if (pd->GetNumberOfArrays() != fpd->GetNumberOfArrays())
+  {
+    cerr << "ERROR: " << label << ": mismatched number of point arrays." << endl;
+    return false;
+  }
+  for (int cc = 0; cc < pd->GetNumberOfArrays(); ++cc)
+  {
+    vtkPVArrayInformation* ainfo = pd->GetArrayInformation(cc);
+    vtkPVArrayInformation* fainfo = fpd->GetArrayInformation(cc);
+    if (!SameString(ainfo->GetName(), fainfo->GetName()) ||
+      ainfo->GetIsPartial() != fainfo->GetIsPartial())
+    {
+      cerr << "ERROR: " << label << ": mismatched information for array `" << fainfo->GetName()
+           << "`." << endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+vtkSmartPointer<vtkPolyData> NewSphere(int index, bool withPartialArray)
+{
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetCenter(index, 0, 0);
+  sphere->Update();
+  auto pd = vtkSmartPointer<vtkPolyData>::New();
+  pd->ShallowCopy(sphere->GetOutput());
+  if (withPartialArray)
+  {
+    vtkNew<vtkDoubleArray> partial;
+    partial->SetName("partial");
+    partial->SetNumberOfTuples(pd->GetNumberOfPoints());
+    partial->Fill(index);
+    pd->GetPointData()->AddArray(partial);
+  }
+  return pd;
+}
+
+// Runs the flat and tree merges for all numbers of ranks in [1, 12]. Every
+// non-null data set, empty or not, must be counted.
+bool RunCase(const std::string& label,
+  const std::function<vtkSmartPointer<vtkDataObject>(int, int)>& pieceOfRank,
+  const std::function<int(int)>& numberOfDataSets)
+{
+  for (int nranks = 1; nranks <= 12; ++nranks)
+  {
+    std::vector<vtkSmartPointer<vtkDataObject> > pieces;
+    std::vector<vtkDataObject*> rawPieces;
+    for (int rank = 0; rank < nranks; ++rank)
+    {
+      pieces.push_back(pieceOfRank(rank, nranks));
+      rawPieces.push_back(pieces.back());
+    }
+    const std::string caseLabel = label + " on " + std::to_string(nranks) + " ranks";
+    auto flat = Flat(rawPieces);
+    if (!Compare(Tree(rawPieces), flat, caseLabel))
+    {
+      return false;
+    }
+    if (flat->GetNumberOfDataSets() != numberOfDataSets(nranks))
+    {
+      cerr << "ERROR: " << caseLabel << ": " << flat->GetNumberOfDataSets()
+           << " data sets instead of " << numberOfDataSets(nranks) << "." << endl;
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestDataInformationReduction(int, char* [])
+{
+  // one poly data per rank, every other one is empty.
+  bool success = RunCase("poly data", [](int rank, int) -> vtkSmartPointer<vtkDataObject> {
+    if (rank % 2 == 0)
+    {
+      return vtkSmartPointer<vtkPolyData>::New();
+    }
+    return NewSphere(rank, rank % 3 == 0);
+  }, [](int) { return 1; });
+
+  // different data set types, some empty, to check the common type.
+  success = RunCase("mixed types", [](int rank, int) -> vtkSmartPointer<vtkDataObject> {
+    switch (rank % 4)
+    {
+      case 0:
+        return vtkSmartPointer<vtkUnstructuredGrid>::New();
+      case 1:
+        return NewSphere(rank, false);
+      case 2:
+        return vtkSmartPointer<vtkPolyData>::New();
+      default:
+      {
+        auto img = vtkSmartPointer<vtkImageData>::New();
+        img->SetDimensions(2, 2, 2);
+        img->SetOrigin(rank, 0, 0);
+        return img;
+      }
+    }
+  }, [](int) { return 1; }) && success;
+
+  // a distributed multiblock: every rank has the same structure, the blocks of
+  // other ranks are null. Some ranks only have empty blocks, some none at all.
+  success = RunCase("multiblock", [](int rank, int nranks) -> vtkSmartPointer<vtkDataObject> {
+    auto mb = vtkSmartPointer<vtkMultiBlockDataSet>::New();
+    mb->SetNumberOfBlocks(2 * nranks);
+    switch (rank % 3)
+    {
+      case 0:
+        mb->SetBlock(2 * rank, vtkSmartPointer<vtkPolyData>::New());
+        mb->SetBlock(2 * rank + 1, vtkSmartPointer<vtkPolyData>::New());
+        break;
+      case 1:
+        mb->SetBlock(2 * rank, NewSphere(rank, rank % 2 == 0));
+        mb->SetBlock(2 * rank + 1, vtkSmartPointer<vtkUnstructuredGrid>::New());
+        break;
+      default:
+        break;
+    }
+    return mb;
+  }, [](int nranks) { return 2 * ((nranks + 2) / 3 + (nranks + 1) / 3); }) && success;
+
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
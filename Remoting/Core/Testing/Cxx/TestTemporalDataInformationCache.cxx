@@ -0,0 +1,145 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestTemporalDataInformationCache.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Tests that vtkPVTemporalDataInformation only executes the time steps
+// missing from vtkPVTemporalDataInformationCache, and that the cache is
+// discarded when the pipeline is modified.
+
+#include "vtkDoubleArray.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPVArrayInformation.h"
+#include "vtkPVDataInformation.h"
+#include "vtkPVTemporalDataInformation.h"
+#include "vtkPVTemporalDataInformationCache.h"
+#include "vtkPointData.h"
+#include "vtkPolyData.h"
+#include "vtkPolyDataAlgorithm.h"
+#include "vtkSphereSource.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+
+#define expect(x, msg)                                                                             \
+  if (!(x))                                                                                        \
+  {                                                                                                \
+    cerr << __LINE__ << ": " msg << endl;                                                          \
+    return EXIT_FAILURE;                                                                           \
+  }
+
+namespace
+{
+// sphere with 5 time steps and a point array equal to time * Scale.
+class TemporalSphereSource : public vtkPolyDataAlgorithm
+{
+public:
+  static TemporalSphereSource* New();
+  vtkTypeMacro(TemporalSphereSource, vtkPolyDataAlgorithm);
+  vtkSetMacro(Scale, double);
+
+  int NumberOfExecutions = 0;
+
+protected:
+  TemporalSphereSource() { this->SetNumberOfInputPorts(0); }
+
+  int RequestInformation(vtkInformation*, vtkInformationVector**,
+    vtkInformationVector* outputVector) override
+  {
+    vtkInformation* outInfo = outputVector->GetInformationObject(0);
+    double steps[5] = { 0, 1, 2, 3, 4 };
+    double range[2] = { 0, 4 };
+    outInfo->Set(vtkStreamingDemandDrivenPipeline::TIME_STEPS(), steps, 5);
+    outInfo->Set(vtkStreamingDemandDrivenPipeline::TIME_RANGE(), range, 2);
+    return 1;
+  }
+
+  int RequestData(vtkInformation*, vtkInformationVector**,
+    vtkInformationVector* outputVector) override
+  {
+    ++this->NumberOfExecutions;
+    vtkInformation* outInfo = outputVector->GetInformationObject(0);
+    const double time = outInfo->Has(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP())
+      ? outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP())
+      : 0.0;
+
+    vtkNew<vtkSphereSource> sphere;
+    sphere->Update();
+    vtkPolyData* output = vtkPolyData::GetData(outInfo);
+    output->ShallowCopy(sphere->GetOutput());
+
+    vtkNew<vtkDoubleArray> values;
+    values->SetName("Values");
+    values->SetNumberOfTuples(output->GetNumberOfPoints());
+    values->FillComponent(0, time * this->Scale);
+    output->GetPointData()->AddArray(values);
+    output->GetInformation()->Set(vtkDataObject::DATA_TIME_STEP(), time);
+    return 1;
+  }
+
+  double Scale = 1.0;
+};
+vtkStandardNewMacro(TemporalSphereSource);
+
+bool CheckRange(TemporalSphereSource* source, double max)
+{
+  vtkNew<vtkPVTemporalDataInformation> tinfo;
+  tinfo->SetPortNumber(0);
+  tinfo->CopyFromObject(source);
+  vtkPVArrayInformation* ainfo = tinfo->GetArrayInformation("Values", vtkDataObject::POINT);
+  return ainfo && ainfo->GetComponentRange(0)[0] == 0.0 && ainfo->GetComponentRange(0)[1] == max;
+}
+
+void GatherDataInformation(TemporalSphereSource* source, double time)
+{
+  source->UpdateTimeStep(time);
+  vtkNew<vtkPVDataInformation> dinfo;
+  dinfo->SetPortNumber(0);
+  dinfo->CopyFromObject(source);
+}
+}
+
+int TestTemporalDataInformationCache(int, char* [])
+{
+  vtkPVTemporalDataInformationCache* cache = vtkPVTemporalDataInformationCache::GetInstance();
+  vtkNew<TemporalSphereSource> source;
+
+  // all the time steps are executed once.
+  expect(CheckRange(source, 4.0), "incorrect temporal range.");
+  expect(source->NumberOfExecutions == 5, "all time steps should have been executed.");
+  expect(cache->GetNumberOfTimeSteps(source, 0) == 5, "all time steps should be cached.");
+
+  // then served from the cache.
+  expect(CheckRange(source, 4.0), "incorrect temporal range.");
+  expect(source->NumberOfExecutions == 5, "no time step should have been executed.");
+
+  // modifying the pipeline discards the cache, time steps executed for any
+  // reason are recorded.
+  source->SetScale(2.0);
+  GatherDataInformation(source, 1.0);
+  GatherDataInformation(source, 3.0);
+  expect(cache->GetNumberOfTimeSteps(source, 0) == 2, "executed time steps should be cached.");
+  source->NumberOfExecutions = 0;
+  expect(CheckRange(source, 8.0), "incorrect temporal range after modification.");
+  expect(source->NumberOfExecutions == 3, "only missing time steps should have been executed.");
+
+  // disabled cache.
+  cache->SetEnabled(false);
+  source->NumberOfExecutions = 0;
+  expect(CheckRange(source, 8.0), "incorrect temporal range without cache.");
+  expect(source->NumberOfExecutions == 4, "all time steps should have been executed.");
+  cache->SetEnabled(true);
+  cache->RemoveAllTimeSteps();
+  expect(cache->GetNumberOfTimeSteps(source, 0) == 0, "cache should be empty.");
+  return EXIT_SUCCESS;
+}
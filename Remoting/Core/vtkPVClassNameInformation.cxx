@@ -98,12 +98,14 @@ void vtkPVClassNameInformation::CopyFromStream(const vtkClientServerStream* css)
 //----------------------------------------------------------------------------
 void vtkPVClassNameInformation::CopyParametersToStream(vtkMultiProcessStream& str)
 {
+  this->Superclass::CopyParametersToStream(str);
   str << 829992 << this->PortNumber;
 }
 
 //----------------------------------------------------------------------------
 void vtkPVClassNameInformation::CopyParametersFromStream(vtkMultiProcessStream& str)
 {
+  this->Superclass::CopyParametersFromStream(str);
   int magic_number;
   str >> magic_number >> this->PortNumber;
   if (magic_number != 829992)
@@ -164,6 +164,13 @@ const char* vtkPVCompositeDataInformation::GetName(unsigned int idx)
 
 //----------------------------------------------------------------------------
 void vtkPVCompositeDataInformation::CopyFromObject(vtkObject* object)
+{
+  this->IncrementalCopyFromObject(object, nullptr);
+}
+
+//----------------------------------------------------------------------------
+void vtkPVCompositeDataInformation::IncrementalCopyFromObject(
+  vtkObject* object, vtkPVInformation* previous)
 {
   this->Initialize();
 
@@ -211,29 +218,47 @@ void vtkPVCompositeDataInformation::CopyFromObject(vtkObject* object)
   iter->SkipEmptyNodesOff();
 
   // vtkTimerLog::MarkStartEvent("Copying information from composite data");
-  unsigned int index = 0;
-  for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem(), index++)
+  std::vector<vtkDataObject*> children;
+  std::vector<const char*> names;
+  for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
   {
-    vtkSmartPointer<vtkPVDataInformation> childInfo;
-    vtkDataObject* curDO = iter->GetCurrentDataObject();
-    if (curDO)
-    {
-      childInfo = vtkSmartPointer<vtkPVDataInformation>::New();
-      childInfo->CopyFromObject(curDO);
-    }
-    this->Internal->ChildrenInformation.resize(index + 1);
-    this->Internal->ChildrenInformation[index].Info = childInfo;
+    children.push_back(iter->GetCurrentDataObject());
+    const char* name = nullptr;
     if (iter->HasCurrentMetaData())
     {
       vtkInformation* info = iter->GetCurrentMetaData();
       if (info->Has(vtkCompositeDataSet::NAME()))
       {
-        const char* name = info->Get(vtkCompositeDataSet::NAME());
-        this->Internal->ChildrenInformation[index].Name = name;
-        if (childInfo)
-        {
-          childInfo->SetCompositeDataSetName(name);
-        }
+        name = info->Get(vtkCompositeDataSet::NAME());
+      }
+    }
+    names.push_back(name);
+  }
+
+  std::vector<vtkPVDataInformation*> previousInfo;
+  if (vtkPVCompositeDataInformation* prev = vtkPVCompositeDataInformation::SafeDownCast(previous))
+  {
+    for (const auto& node : prev->Internal->ChildrenInformation)
+    {
+      previousInfo.push_back(node.Info);
+    }
+  }
+
+  // the children are independent, compute their information concurrently.
+  std::vector<vtkSmartPointer<vtkPVDataInformation> > childrenInfo;
+  vtkPVDataInformation::CopyFromLeaves(children, childrenInfo, previousInfo);
+
+  this->Internal->ChildrenInformation.resize(children.size());
+  for (size_t index = 0; index < children.size(); ++index)
+  {
+    vtkPVDataInformation* childInfo = childrenInfo[index];
+    this->Internal->ChildrenInformation[index].Info = childInfo;
+    if (const char* name = names[index])
+    {
+      this->Internal->ChildrenInformation[index].Name = name;
+      if (childInfo)
+      {
+        childInfo->SetCompositeDataSetName(name);
       }
     }
   }
@@ -255,7 +280,7 @@ void vtkPVCompositeDataInformation::CopyFromAMR(vtkUniformGridAMR* amr)
 
   // we use this to "simulate" a composite tree from AMR
   vtkNew<vtkMultiPieceDataSet> tempMultiPiece;
-  vtkNew<vtkPVDataInformation> tempDSInfo;
+  std::vector<vtkDataObject*> datasets;
 
   for (unsigned int level = 0; level < this->NumberOfAMRLevels; level++)
   {
@@ -266,15 +291,12 @@ void vtkPVCompositeDataInformation::CopyFromAMR(vtkUniformGridAMR* amr)
     levelInfo->CopyFromCompositeDataSetInitialize(tempMultiPiece.GetPointer());
 
     // now fill up levelInfo with meta-data about arrays.
+    datasets.resize(num_datasets);
     for (unsigned int idx = 0; idx < num_datasets; idx++)
     {
-      vtkUniformGrid* dataset = amr->GetDataSet(level, idx);
-      if (dataset)
-      {
-        tempDSInfo->CopyFromObject(dataset);
-        levelInfo->AddInformation(tempDSInfo.GetPointer(), 1);
-      }
+      datasets[idx] = amr->GetDataSet(level, idx);
     }
+    levelInfo->AddFromLeaves(datasets);
     levelInfo->CopyFromCompositeDataSetFinalize(tempMultiPiece.GetPointer());
     this->Internal->ChildrenInformation[level].Info = levelInfo.GetPointer();
   }
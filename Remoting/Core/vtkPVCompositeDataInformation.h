@@ -46,6 +46,12 @@ public:
    */
   void CopyFromObject(vtkObject*) override;
 
+  /**
+   * Same as CopyFromObject() but reuses the information of the children from
+   * `previous` whose data has not been modified since.
+   */
+  void IncrementalCopyFromObject(vtkObject* object, vtkPVInformation* previous) override;
+
   /**
    * Merge another information object.
    */
@@ -105,12 +105,14 @@ void vtkPVDataAssemblyInformation::CopyFromStream(const vtkClientServerStream* c
 //----------------------------------------------------------------------------
 void vtkPVDataAssemblyInformation::CopyParametersToStream(vtkMultiProcessStream& str)
 {
+  this->Superclass::CopyParametersToStream(str);
   str << 828793 << this->PortNumber;
 }
 
 //----------------------------------------------------------------------------
 void vtkPVDataAssemblyInformation::CopyParametersFromStream(vtkMultiProcessStream& str)
 {
+  this->Superclass::CopyParametersFromStream(str);
   int magic_number;
   str >> magic_number >> this->PortNumber;
   if (magic_number != 828793)
@@ -29,6 +29,7 @@
 #include "vtkDataSet.h"
 #include "vtkExecutive.h"
 #include "vtkExplicitStructuredGrid.h"
+#include "vtkFieldData.h"
 #include "vtkGenericDataSet.h"
 #include "vtkGraph.h"
 #include "vtkHyperTreeGrid.h"
@@ -42,11 +43,16 @@
 #include "vtkPVArrayInformation.h"
 #include "vtkPVCompositeDataInformation.h"
 #include "vtkPVCompositeDataInformationIterator.h"
+#include "vtkPVConcurrentLeavesHelper.h"
 #include "vtkPVDataInformationHelper.h"
 #include "vtkPVDataSetAttributesInformation.h"
 #include "vtkPVInformationKeys.h"
+#include "vtkPVTemporalDataInformationCache.h"
 #include "vtkPointData.h"
+#include "vtkPointSet.h"
+#include "vtkPoints.h"
 #include "vtkRectilinearGrid.h"
+#include "vtkSMPTools.h"
 #include "vtkSelection.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStructuredGrid.h"
@@ -56,6 +62,7 @@
 #include <algorithm>
 #include <map>
 #include <set>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -63,6 +70,40 @@ vtkStandardNewMacro(vtkPVDataInformation);
 
 std::map<std::string, std::string> helpers;
 
+namespace
+{
+// Set on threads computing leaf information concurrently so that nested
+// composite datasets are processed serially instead of nesting parallel loops.
+thread_local bool InSMPScope = false;
+
+class SMPScope
+{
+public:
+  SMPScope()
+    : Previous(InSMPScope)
+  {
+    InSMPScope = true;
+  }
+  ~SMPScope() { InSMPScope = this->Previous; }
+
+private:
+  bool Previous;
+};
+
+// Returns true if information for the leaves can be computed concurrently,
+// see vtkPVConcurrentLeavesHelper.
+bool CanProcessLeavesConcurrently(const std::vector<vtkDataObject*>& leaves)
+{
+  if (InSMPScope ||
+    std::count_if(leaves.begin(), leaves.end(),
+      [](vtkDataObject* dobj) { return dobj != nullptr; }) < 2)
+  {
+    return false;
+  }
+  return vtkPVConcurrentLeavesHelper::CanProcessConcurrently(leaves);
+}
+}
+
 //----------------------------------------------------------------------------
 vtkPVDataInformation::vtkPVDataInformation()
 {
@@ -84,6 +125,9 @@ vtkPVDataInformation::vtkPVDataInformation()
       dsa->SetFieldAssociation(cc);
     }
   }
+
+  // AddInformation() is associative, so satellites can merge pairwise.
+  this->UseTreeReduction = true;
 }
 
 //----------------------------------------------------------------------------
@@ -114,12 +158,14 @@ vtkPVDataInformation::~vtkPVDataInformation()
 //----------------------------------------------------------------------------
 void vtkPVDataInformation::CopyParametersToStream(vtkMultiProcessStream& str)
 {
+  this->Superclass::CopyParametersToStream(str);
   str << 828792 << this->PortNumber;
 }
 
 //----------------------------------------------------------------------------
 void vtkPVDataInformation::CopyParametersFromStream(vtkMultiProcessStream& str)
 {
+  this->Superclass::CopyParametersFromStream(str);
   int magic_number;
   str >> magic_number >> this->PortNumber;
   if (magic_number != 828792)
@@ -240,6 +286,8 @@ vtkTypeInt64 vtkPVDataInformation::GetNumberOfElements(int type)
 //----------------------------------------------------------------------------
 void vtkPVDataInformation::Initialize()
 {
+  this->SourceDataObject = nullptr;
+  this->SourceMTime = 0;
   this->DataSetType = -1;
   this->CompositeDataSetType = -1;
   this->NumberOfPoints = 0;
@@ -336,28 +384,127 @@ void vtkPVDataInformation::DeepCopy(
 //----------------------------------------------------------------------------
 void vtkPVDataInformation::AddFromMultiPieceDataSet(vtkCompositeDataSet* data)
 {
+  std::vector<vtkDataObject*> leaves;
   vtkCompositeDataIterator* iter = data->NewIterator();
   for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
   {
-    vtkDataObject* dobj = iter->GetCurrentDataObject();
-    if (dobj)
+    leaves.push_back(iter->GetCurrentDataObject());
+  }
+  iter->Delete();
+
+  this->AddFromLeaves(leaves);
+}
+
+//----------------------------------------------------------------------------
+void vtkPVDataInformation::AddFromLeaves(const std::vector<vtkDataObject*>& leaves)
+{
+  // Computes the information for leaf `cc`, nullptr for a null leaf.
+  auto copyLeaf = [&leaves](size_t cc) -> vtkSmartPointer<vtkPVDataInformation> {
+    vtkDataObject* dobj = leaves[cc];
+    if (!dobj)
+    {
+      return nullptr;
+    }
+    auto dinf = vtkSmartPointer<vtkPVDataInformation>::New();
+    dinf->CopyFromObject(dobj);
+    dinf->SetDataClassName(dobj->GetClassName());
+    dinf->DataSetType = dobj->GetDataObjectType();
+    return dinf;
+  };
+
+  if (!::CanProcessLeavesConcurrently(leaves))
+  {
+    for (size_t cc = 0; cc < leaves.size(); ++cc)
     {
-      vtkPVDataInformation* dinf = vtkPVDataInformation::New();
-      dinf->CopyFromObject(dobj);
-      dinf->SetDataClassName(dobj->GetClassName());
-      dinf->DataSetType = dobj->GetDataObjectType();
-      this->AddInformation(dinf, /*addingParts=*/1);
-      dinf->FastDelete();
+      if (auto dinf = copyLeaf(cc))
+      {
+        this->AddInformation(dinf, /*addingParts=*/1);
+      }
+    }
+    return;
+  }
+
+  // Only scanning the leaves is done concurrently. The information of each
+  // leaf is then merged in order, exactly as the serial loop does, so that
+  // arrays are listed in the same order. The leaves are processed in batches
+  // to bound the number of information objects alive at once.
+  const size_t numThreads =
+    std::max<size_t>(1, static_cast<size_t>(vtkSMPTools::GetEstimatedNumberOfThreads()));
+  const size_t batchSize = 64 * numThreads;
+  std::vector<vtkSmartPointer<vtkPVDataInformation> > infos;
+  for (size_t batchBegin = 0; batchBegin < leaves.size(); batchBegin += batchSize)
+  {
+    const size_t batchEnd = std::min(batchBegin + batchSize, leaves.size());
+    infos.clear();
+    infos.resize(batchEnd - batchBegin);
+    vtkSMPTools::For(static_cast<vtkIdType>(batchBegin), static_cast<vtkIdType>(batchEnd),
+      [&](vtkIdType first, vtkIdType last) {
+        SMPScope scope;
+        for (vtkIdType cc = first; cc < last; ++cc)
+        {
+          infos[static_cast<size_t>(cc) - batchBegin] = copyLeaf(static_cast<size_t>(cc));
+        }
+      });
+
+    for (auto& dinf : infos)
+    {
+      if (dinf)
+      {
+        this->AddInformation(dinf, /*addingParts=*/1);
+      }
     }
   }
-  iter->Delete();
+}
+
+//----------------------------------------------------------------------------
+void vtkPVDataInformation::CopyFromLeaves(const std::vector<vtkDataObject*>& leaves,
+  std::vector<vtkSmartPointer<vtkPVDataInformation> >& infos,
+  const std::vector<vtkPVDataInformation*>& previous)
+{
+  infos.clear();
+  infos.resize(leaves.size());
+
+  auto copyRange = [&leaves, &infos, &previous](size_t begin, size_t end) {
+    for (size_t cc = begin; cc < end; ++cc)
+    {
+      vtkDataObject* dobj = leaves[cc];
+      if (!dobj)
+      {
+        continue;
+      }
+      vtkPVDataInformation* prev = cc < previous.size() ? previous[cc] : nullptr;
+      if (prev && prev->SourceDataObject == dobj && prev->SourceMTime == dobj->GetMTime())
+      {
+        // unchanged leaf, no need to scan it again.
+        infos[cc] = prev;
+      }
+      else
+      {
+        infos[cc] = vtkSmartPointer<vtkPVDataInformation>::New();
+        infos[cc]->IncrementalCopyFromObject(dobj, prev);
+      }
+    }
+  };
+
+  if (::CanProcessLeavesConcurrently(leaves))
+  {
+    vtkSMPTools::For(0, static_cast<vtkIdType>(leaves.size()), [&](vtkIdType begin, vtkIdType end) {
+      SMPScope scope;
+      copyRange(static_cast<size_t>(begin), static_cast<size_t>(end));
+    });
+  }
+  else
+  {
+    copyRange(0, leaves.size());
+  }
 }
 
 //----------------------------------------------------------------------------
 void vtkPVDataInformation::CopyFromCompositeDataSetInitialize(vtkCompositeDataSet* data)
 {
   this->Initialize();
-  this->CompositeDataInformation->CopyFromObject(data);
+  this->CompositeDataInformation->IncrementalCopyFromObject(data,
+    this->PreviousInformation ? this->PreviousInformation->CompositeDataInformation : nullptr);
 }
 
 //----------------------------------------------------------------------------
@@ -729,46 +876,11 @@ void vtkPVDataInformation::CopyFromHyperTreeGrid(vtkHyperTreeGrid* data)
 //----------------------------------------------------------------------------
 void vtkPVDataInformation::CopyFromObject(vtkObject* object)
 {
-  vtkDataObject* dobj = vtkDataObject::SafeDownCast(object);
+  vtkDataObject* dobj = nullptr;
   vtkInformation* info = nullptr;
-  // Handle the case where the a vtkAlgorithmOutput is passed instead of
-  // the data object. vtkSMPart uses vtkAlgorithmOutput.
-  if (!dobj)
+  if (!this->GetDataObject(object, dobj, info))
   {
-    vtkAlgorithmOutput* algOutput = vtkAlgorithmOutput::SafeDownCast(object);
-    vtkAlgorithm* algo = vtkAlgorithm::SafeDownCast(object);
-    if (algOutput && algOutput->GetProducer())
-    {
-      if (strcmp(algOutput->GetProducer()->GetClassName(), "vtkPVNullSource") == 0)
-      {
-        // Don't gather any data information from the hypothetical null source.
-        return;
-      }
-
-      if (algOutput->GetProducer()->IsA("vtkPVPostFilter"))
-      {
-        algOutput = algOutput->GetProducer()->GetInputConnection(0, 0);
-      }
-      info = algOutput->GetProducer()->GetOutputInformation(this->PortNumber);
-      dobj = algOutput->GetProducer()->GetOutputDataObject(algOutput->GetIndex());
-    }
-    else if (algo)
-    {
-      // We don't use vtkAlgorithm::GetOutputDataObject() since that call a
-      // UpdateDataObject() pass, which may raise errors if the algo is not
-      // fully setup yet.
-      if (strcmp(algo->GetClassName(), "vtkPVNullSource") == 0)
-      {
-        // Don't gather any data information from the hypothetical null source.
-        return;
-      }
-      info = algo->GetExecutive()->GetOutputInformation(this->PortNumber);
-      if (!info || vtkDataObject::GetData(info) == nullptr)
-      {
-        return;
-      }
-      dobj = algo->GetOutputDataObject(this->PortNumber);
-    }
+    return;
   }
 
   if (!dobj)
@@ -778,6 +890,22 @@ void vtkPVDataInformation::CopyFromObject(vtkObject* object)
     return;
   }
 
+  this->CopyFromDataObject(dobj, info);
+
+  // record the time step gathered from an algorithm output so that
+  // vtkPVTemporalDataInformation does not have to execute it again.
+  if (this->HasTime && dobj != object)
+  {
+    vtkAlgorithmOutput* output = vtkAlgorithmOutput::SafeDownCast(object);
+    vtkAlgorithm* algo = output ? output->GetProducer() : vtkAlgorithm::SafeDownCast(object);
+    vtkPVTemporalDataInformationCache::GetInstance()->AddTimeStepInformation(
+      algo, output ? output->GetIndex() : this->PortNumber, this->Time, this);
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkPVDataInformation::CopyFromDataObject(vtkDataObject* dobj, vtkInformation* info)
+{
   vtkCompositeDataSet* cds = vtkCompositeDataSet::SafeDownCast(dobj);
   if (cds)
   {
@@ -786,6 +914,11 @@ void vtkPVDataInformation::CopyFromObject(vtkObject* object)
     return;
   }
 
+  // remember where non-composite information comes from so that it can be
+  // reused by IncrementalCopyFromObject() while the data object is unchanged.
+  this->SourceDataObject = dobj;
+  this->SourceMTime = dobj->GetMTime();
+
   // vtkHyperTreeGrid inherits vtkDataSet, so we check for it first:
   vtkHyperTreeGrid* htg = vtkHyperTreeGrid::SafeDownCast(dobj);
   if (htg)
@@ -851,6 +984,114 @@ void vtkPVDataInformation::CopyFromObject(vtkObject* object)
   this->CopyCommonMetaData(dobj, info);
 }
 
+//----------------------------------------------------------------------------
+bool vtkPVDataInformation::GetDataObject(
+  vtkObject* object, vtkDataObject*& dobj, vtkInformation*& info)
+{
+  dobj = vtkDataObject::SafeDownCast(object);
+  info = nullptr;
+  // Handle the case where the a vtkAlgorithmOutput is passed instead of
+  // the data object. vtkSMPart uses vtkAlgorithmOutput.
+  if (!dobj)
+  {
+    vtkAlgorithmOutput* algOutput = vtkAlgorithmOutput::SafeDownCast(object);
+    vtkAlgorithm* algo = vtkAlgorithm::SafeDownCast(object);
+    if (algOutput && algOutput->GetProducer())
+    {
+      if (strcmp(algOutput->GetProducer()->GetClassName(), "vtkPVNullSource") == 0)
+      {
+        // Don't gather any data information from the hypothetical null source.
+        return false;
+      }
+
+      if (algOutput->GetProducer()->IsA("vtkPVPostFilter"))
+      {
+        algOutput = algOutput->GetProducer()->GetInputConnection(0, 0);
+      }
+      info = algOutput->GetProducer()->GetOutputInformation(this->PortNumber);
+      dobj = algOutput->GetProducer()->GetOutputDataObject(algOutput->GetIndex());
+    }
+    else if (algo)
+    {
+      // We don't use vtkAlgorithm::GetOutputDataObject() since that call a
+      // UpdateDataObject() pass, which may raise errors if the algo is not
+      // fully setup yet.
+      if (strcmp(algo->GetClassName(), "vtkPVNullSource") == 0)
+      {
+        // Don't gather any data information from the hypothetical null source.
+        return false;
+      }
+      info = algo->GetExecutive()->GetOutputInformation(this->PortNumber);
+      if (!info || vtkDataObject::GetData(info) == nullptr)
+      {
+        return false;
+      }
+      dobj = algo->GetOutputDataObject(this->PortNumber);
+    }
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVDataInformation::IncrementalCopyFromObject(
+  vtkObject* object, vtkPVInformation* previous)
+{
+  this->PreviousInformation = vtkPVDataInformation::SafeDownCast(previous);
+  this->CopyFromObject(object);
+  this->PreviousInformation = nullptr;
+}
+
+//----------------------------------------------------------------------------
+std::string vtkPVDataInformation::GetCacheKey(vtkObject* object)
+{
+  vtkDataObject* dobj = nullptr;
+  vtkInformation* pinfo = nullptr;
+  if (!this->GetDataObject(object, dobj, pinfo) || !dobj)
+  {
+    return std::string();
+  }
+
+  // vtkCompositeDataSet::GetMTime() does not account for its blocks.
+  vtkMTimeType mtime = dobj->GetMTime();
+  if (vtkCompositeDataSet* cds = vtkCompositeDataSet::SafeDownCast(dobj))
+  {
+    vtkSmartPointer<vtkCompositeDataIterator> iter;
+    iter.TakeReference(cds->NewIterator());
+    for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+    {
+      mtime = std::max(mtime, iter->GetCurrentDataObject()->GetMTime());
+    }
+  }
+
+  std::ostringstream key;
+  key << dobj << ":" << mtime;
+
+  // include everything CopyCommonMetaData() looks at.
+  key.precision(17);
+  vtkInformation* dinfo = dobj->GetInformation();
+  if (dinfo->Has(vtkDataObject::DATA_TIME_STEP()))
+  {
+    key << ":" << dinfo->Get(vtkDataObject::DATA_TIME_STEP());
+  }
+  if (pinfo)
+  {
+    if (pinfo->Has(vtkStreamingDemandDrivenPipeline::TIME_RANGE()))
+    {
+      double* range = pinfo->Get(vtkStreamingDemandDrivenPipeline::TIME_RANGE());
+      key << ":" << range[0] << ":" << range[1];
+    }
+    if (pinfo->Has(vtkStreamingDemandDrivenPipeline::TIME_STEPS()))
+    {
+      key << ":" << pinfo->Length(vtkStreamingDemandDrivenPipeline::TIME_STEPS());
+    }
+    if (pinfo->Has(vtkPVInformationKeys::TIME_LABEL_ANNOTATION()))
+    {
+      key << ":" << pinfo->Get(vtkPVInformationKeys::TIME_LABEL_ANNOTATION());
+    }
+  }
+  return key.str();
+}
+
 //----------------------------------------------------------------------------
 void vtkPVDataInformation::AddInformation(vtkPVInformation* pvi)
 {
@@ -927,20 +1168,8 @@ void vtkPVDataInformation::AddInformation(vtkPVInformation* pvi, int addingParts
     }
   }
 
-  // Empty data set? Ignore bounds, extent and array info.
-  if (info->GetNumberOfCells() == 0 && info->GetNumberOfPoints() == 0 &&
-    info->GetNumberOfRows() == 0 && info->GetNumberOfVertices() == 0 &&
-    info->GetNumberOfEdges() == 0)
-  {
-    return;
-  }
-
-  switch (this->DataSetType)
-  {
-    case VTK_POLY_DATA:
-      this->PolygonCount += info->GetNumberOfCells();
-      break;
-  }
+  // Empty data sets are counted too, so that the result does not depend on
+  // the order in which the information are merged.
   if (addingParts)
   {
     // Adding data information of parts
@@ -967,6 +1196,43 @@ void vtkPVDataInformation::AddInformation(vtkPVInformation* pvi, int addingParts
     }
   }
 
+  // Empty data set? Ignore bounds, extent and array info.
+  auto isEmpty = [](vtkPVDataInformation* dinfo) {
+    return dinfo->NumberOfCells == 0 && dinfo->NumberOfPoints == 0 && dinfo->NumberOfRows == 0 &&
+      dinfo->NumberOfVertices == 0 && dinfo->NumberOfEdges == 0;
+  };
+  if (isEmpty(info))
+  {
+    return;
+  }
+  if (isEmpty(this))
+  {
+    // Only empty data sets were merged so far. Like the empty data sets
+    // merged after a non-empty one, they only contribute their number and
+    // type: take everything else from the other information. This keeps
+    // merging associative, which tree reduction relies on.
+    const int dataSetType = this->DataSetType;
+    const std::string dataClassName = this->DataClassName ? this->DataClassName : "";
+    const int compositeDataSetType = this->CompositeDataSetType;
+    const std::string compositeDataClassName =
+      this->CompositeDataClassName ? this->CompositeDataClassName : "";
+    const std::string compositeDataSetName =
+      this->CompositeDataSetName ? this->CompositeDataSetName : "";
+    const int numberOfDataSets = this->NumberOfDataSets;
+    this->DeepCopy(info, false);
+    this->DataSetType = dataSetType;
+    this->SetDataClassName(dataClassName.empty() ? nullptr : dataClassName.c_str());
+    this->CompositeDataSetType = compositeDataSetType;
+    this->SetCompositeDataClassName(
+      compositeDataClassName.empty() ? nullptr : compositeDataClassName.c_str());
+    this->SetCompositeDataSetName(
+      compositeDataSetName.empty() ? nullptr : compositeDataSetName.c_str());
+    this->NumberOfDataSets = numberOfDataSets;
+    return;
+  }
+
+  this->PolygonCount += info->GetPolygonCount();
+
   vtkBoundingBox bbox;
   bbox.AddBounds(this->Bounds);
   bbox.AddBounds(info->GetBounds());
@@ -32,6 +32,9 @@
 
 #include "vtkPVInformation.h"
 #include "vtkRemotingCoreModule.h" //needed for exports
+#include "vtkSmartPointer.h"       // needed for vtkSmartPointer
+
+#include <vector> // needed for std::vector
 
 class vtkCollection;
 class vtkCompositeDataSet;
@@ -81,6 +84,20 @@ public:
    */
   void CopyFromObject(vtkObject*) override;
 
+  /**
+   * Same as CopyFromObject() but, for composite datasets, reuses the
+   * information of the leaf blocks from `previous` that have not been
+   * modified since it was computed.
+   */
+  void IncrementalCopyFromObject(vtkObject* object, vtkPVInformation* previous) override;
+
+  /**
+   * Returns a key built from the data object's MTime (including the MTime of
+   * its blocks, for composite datasets), its time and the temporal meta-data
+   * from the pipeline.
+   */
+  std::string GetCacheKey(vtkObject* object) override;
+
   /**
    * Merge another information object. Calls AddInformation(info, 0).
    */
@@ -302,7 +319,40 @@ protected:
 
   void DeepCopy(vtkPVDataInformation* dataInfo, bool copyCompositeInformation = true);
 
+  /**
+   * Computes the information of `dobj`, `info` being its pipeline information
+   * if any. Called by CopyFromObject().
+   */
+  void CopyFromDataObject(vtkDataObject* dobj, vtkInformation* info);
+
   void AddFromMultiPieceDataSet(vtkCompositeDataSet* data);
+
+  /**
+   * Merges the information for each of the non-null `leaves` into this
+   * object as parts. When the leaves do not share any points or arrays, the
+   * information of each leaf is computed concurrently using vtkSMPTools and
+   * then merged in order, so that the result matches the serial traversal.
+   */
+  void AddFromLeaves(const std::vector<vtkDataObject*>& leaves);
+
+  /**
+   * Computes the information for each of the `leaves`, concurrently when the
+   * leaves do not share any points or arrays. `infos` is resized to match
+   * `leaves`; the entry for a null leaf is left null. `previous`, if not
+   * empty, provides information computed earlier for the same leaves: entries
+   * still up to date are reused instead of scanning the leaf again.
+   */
+  static void CopyFromLeaves(const std::vector<vtkDataObject*>& leaves,
+    std::vector<vtkSmartPointer<vtkPVDataInformation> >& infos,
+    const std::vector<vtkPVDataInformation*>& previous);
+
+  /**
+   * Resolves the data object information is gathered from, when `object` is
+   * an algorithm or an algorithm output, and its output information. Returns
+   * false if no information must be gathered, e.g. for vtkPVNullSource.
+   */
+  bool GetDataObject(vtkObject* object, vtkDataObject*& dobj, vtkInformation*& info);
+
   void CopyFromCompositeDataSet(vtkCompositeDataSet* data);
   void CopyFromCompositeDataSetInitialize(vtkCompositeDataSet* data);
   void CopyFromCompositeDataSetFinalize(vtkCompositeDataSet* data);
@@ -361,8 +411,18 @@ protected:
 
   vtkPVArrayInformation* PointArrayInformation;
 
+  // Information gathered earlier from the same object, used by
+  // IncrementalCopyFromObject(). Not reference counted.
+  vtkPVDataInformation* PreviousInformation = nullptr;
+
+  // The non-composite data object this information was computed from and its
+  // MTime at that time. Only used to identify the data, never dereferenced.
+  vtkDataObject* SourceDataObject = nullptr;
+  vtkMTimeType SourceMTime = 0;
+
   friend class vtkPVDataInformationHelper;
   friend class vtkPVCompositeDataInformation;
+  friend class vtkPVTemporalDataInformationCache;
 
 private:
   vtkPVDataInformation(const vtkPVDataInformation&) = delete;
@@ -14,10 +14,13 @@
 =========================================================================*/
 #include "vtkPVInformation.h"
 
+#include "vtkMultiProcessStream.h"
+
 //----------------------------------------------------------------------------
 vtkPVInformation::vtkPVInformation()
 {
   this->RootOnly = 0;
+  this->UseTreeReduction = false;
 }
 
 //----------------------------------------------------------------------------
@@ -30,6 +33,7 @@ void vtkPVInformation::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
   os << indent << "RootOnly: " << this->RootOnly << endl;
+  os << indent << "UseTreeReduction: " << this->UseTreeReduction << endl;
 }
 
 //----------------------------------------------------------------------------
@@ -38,12 +42,38 @@ void vtkPVInformation::CopyFromObject(vtkObject*)
   vtkErrorMacro("CopyFromObject not implemented.");
 }
 
+//----------------------------------------------------------------------------
+void vtkPVInformation::IncrementalCopyFromObject(vtkObject* object, vtkPVInformation*)
+{
+  this->CopyFromObject(object);
+}
+
+//----------------------------------------------------------------------------
+std::string vtkPVInformation::GetCacheKey(vtkObject*)
+{
+  return std::string();
+}
+
 //----------------------------------------------------------------------------
 void vtkPVInformation::AddInformation(vtkPVInformation*)
 {
   vtkErrorMacro("AddInformation not implemented.");
 }
 
+//----------------------------------------------------------------------------
+void vtkPVInformation::CopyParametersToStream(vtkMultiProcessStream& str)
+{
+  str << static_cast<int>(this->UseTreeReduction);
+}
+
+//----------------------------------------------------------------------------
+void vtkPVInformation::CopyParametersFromStream(vtkMultiProcessStream& str)
+{
+  int useTreeReduction;
+  str >> useTreeReduction;
+  this->UseTreeReduction = useTreeReduction != 0;
+}
+
 //----------------------------------------------------------------------------
 void vtkPVInformation::CopyFromStream(const vtkClientServerStream*)
 {
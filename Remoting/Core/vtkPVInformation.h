@@ -25,6 +25,8 @@
 #include "vtkObject.h"
 #include "vtkRemotingCoreModule.h" //needed for exports
 
+#include <string> // needed for std::string
+
 class vtkClientServerStream;
 class vtkMultiProcessStream;
 
@@ -39,6 +41,22 @@ public:
    */
   virtual void CopyFromObject(vtkObject*);
 
+  /**
+   * Same as CopyFromObject() but may reuse parts of `previous`, information of
+   * the same class gathered earlier from the same object, that are still up to
+   * date. The default implementation simply calls CopyFromObject().
+   */
+  virtual void IncrementalCopyFromObject(vtkObject* object, vtkPVInformation* previous);
+
+  /**
+   * Returns a key identifying the state of `object` this information would be
+   * computed from, e.g. a data object's MTime and time. vtkPVSessionCore uses
+   * it to cache the gathered information: as long as the key does not change,
+   * repeated requests are served from the cache. An empty key means the
+   * information cannot be cached, which is the default.
+   */
+  virtual std::string GetCacheKey(vtkObject* object);
+
   /**
    * Merge another information object.
    */
@@ -58,9 +76,11 @@ public:
    * gathered. This are different from the ivars that constitute the gathered
    * information itself. For example, PortNumber on vtkPVDataInformation
    * controls what output port the data-information is gathered from.
+   * The base implementation serializes UseTreeReduction, subclasses must call
+   * it before adding their own parameters.
    */
-  virtual void CopyParametersToStream(vtkMultiProcessStream&){};
-  virtual void CopyParametersFromStream(vtkMultiProcessStream&){};
+  virtual void CopyParametersToStream(vtkMultiProcessStream&);
+  virtual void CopyParametersFromStream(vtkMultiProcessStream&);
   //@}
 
   //@{
@@ -70,6 +90,22 @@ public:
   vtkGetMacro(RootOnly, int);
   //@}
 
+  //@{
+  /**
+   * When set, information gathered on MPI satellites is merged using a binary
+   * tree reduction, i.e. ranks merge pairwise with AddInformation() and forward
+   * the partial result, instead of every rank sending its serialized stream
+   * to the root which then merges them one at a time. This reduces the merge
+   * cost on the root from O(P) to O(log(P)) steps and bounds the root's memory
+   * usage, but requires AddInformation() to be associative. The value on the
+   * root process determines the mode used. Subclasses that support it enable
+   * it in their constructor. Default is false.
+   */
+  vtkSetMacro(UseTreeReduction, bool);
+  vtkGetMacro(UseTreeReduction, bool);
+  vtkBooleanMacro(UseTreeReduction, bool);
+  //@}
+
 protected:
   vtkPVInformation();
   ~vtkPVInformation() override;
@@ -77,6 +113,8 @@ protected:
   int RootOnly;
   vtkSetMacro(RootOnly, int);
 
+  bool UseTreeReduction;
+
   vtkPVInformation(const vtkPVInformation&) = delete;
   void operator=(const vtkPVInformation&) = delete;
 };
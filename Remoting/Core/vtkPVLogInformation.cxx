@@ -98,12 +98,14 @@ void vtkPVLogInformation::CopyFromStream(const vtkClientServerStream* css)
 //----------------------------------------------------------------------------
 void vtkPVLogInformation::CopyParametersToStream(vtkMultiProcessStream& str)
 {
+  this->Superclass::CopyParametersToStream(str);
   str << 557499 << this->Rank;
 }
 
 //----------------------------------------------------------------------------
 void vtkPVLogInformation::CopyParametersFromStream(vtkMultiProcessStream& str)
 {
+  this->Superclass::CopyParametersFromStream(str);
   int magic_number;
   str >> magic_number >> this->Rank;
   if (magic_number != 557499)
@@ -17,12 +17,15 @@
 #include "vtkAlgorithm.h"
 #include "vtkAlgorithmOutput.h"
 #include "vtkClientServerStream.h"
+#include "vtkCommunicator.h"
 #include "vtkDataObject.h"
 #include "vtkInformation.h"
+#include "vtkMultiProcessController.h"
 #include "vtkMultiProcessStream.h"
 #include "vtkObjectFactory.h"
 #include "vtkPVDataInformation.h"
 #include "vtkPVDataSetAttributesInformation.h"
+#include "vtkPVTemporalDataInformationCache.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 
@@ -116,12 +119,14 @@ void vtkPVTemporalDataInformation::Initialize()
 //----------------------------------------------------------------------------
 void vtkPVTemporalDataInformation::CopyParametersToStream(vtkMultiProcessStream& str)
 {
+  this->Superclass::CopyParametersToStream(str);
   str << 829993 << this->PortNumber;
 }
 
 //----------------------------------------------------------------------------
 void vtkPVTemporalDataInformation::CopyParametersFromStream(vtkMultiProcessStream& str)
 {
+  this->Superclass::CopyParametersFromStream(str);
   int magic_number;
   str >> magic_number >> this->PortNumber;
   if (magic_number != 829993)
@@ -147,12 +152,13 @@ void vtkPVTemporalDataInformation::CopyFromObject(vtkObject* object)
     return;
   }
 
-  port->GetProducer()->Update();
-  vtkDataObject* dobj = port->GetProducer()->GetOutputDataObject(port->GetIndex());
+  vtkAlgorithm* producer = port->GetProducer();
+  producer->Update();
 
-  // Collect current information.
+  // Collect current information, which also records it in the cache.
   vtkSmartPointer<vtkPVDataInformation> dinfo = vtkSmartPointer<vtkPVDataInformation>::New();
-  dinfo->CopyFromObject(dobj);
+  dinfo->SetPortNumber(port->GetIndex());
+  dinfo->CopyFromObject(port);
   this->AddInformation(dinfo);
 
   if (!dinfo->GetHasTime() || dinfo->GetTimeSpan()[0] == dinfo->GetTimeSpan()[1])
@@ -186,7 +192,6 @@ void vtkPVTemporalDataInformation::CopyFromObject(vtkObject* object)
     this->NumberOfTimeSteps = 0;
   }
 
-  std::vector<double>::iterator iter;
   vtkStreamingDemandDrivenPipeline* sddp =
     vtkStreamingDemandDrivenPipeline::SafeDownCast(port->GetProducer()->GetExecutive());
   if (!sddp)
@@ -195,20 +200,47 @@ void vtkPVTemporalDataInformation::CopyFromObject(vtkObject* object)
     return;
   }
 
+  // only the time steps missing from the cache are executed.
+  vtkPVTemporalDataInformationCache* cache = vtkPVTemporalDataInformationCache::GetInstance();
   double current_time = dinfo->GetTime();
-  for (iter = timesteps.begin(); iter != timesteps.end(); ++iter)
+  const int numTimeSteps = static_cast<int>(timesteps.size());
+  std::vector<vtkSmartPointer<vtkPVDataInformation> > cached(numTimeSteps);
+  std::vector<int> missing(numTimeSteps, 0);
+  for (int cc = 0; cc < numTimeSteps; ++cc)
   {
-    if (*iter == current_time)
+    if (timesteps[cc] != current_time)
+    {
+      cached[cc] = cache->GetTimeStepInformation(producer, port->GetIndex(), timesteps[cc]);
+      missing[cc] = cached[cc] ? 0 : 1;
+    }
+  }
+
+  // the caches of the processes may differ. A time step missing on any
+  // process is executed on all of them, since the pipeline may communicate.
+  vtkMultiProcessController* controller = vtkMultiProcessController::GetGlobalController();
+  if (controller && controller->GetNumberOfProcesses() > 1 && numTimeSteps > 0)
+  {
+    std::vector<int> localMissing(missing);
+    controller->AllReduce(&localMissing[0], &missing[0], numTimeSteps, vtkCommunicator::MAX_OP);
+  }
+
+  for (int cc = 0; cc < numTimeSteps; ++cc)
+  {
+    if (timesteps[cc] == current_time)
     {
       // skip the timestep already seen.
       continue;
     }
-    pipelineInfo->Set(sddp->UPDATE_TIME_STEP(), *iter);
+    if (!missing[cc])
+    {
+      this->AddInformation(cached[cc]);
+      continue;
+    }
+    pipelineInfo->Set(sddp->UPDATE_TIME_STEP(), timesteps[cc]);
     sddp->Update(port->GetIndex());
 
-    dobj = port->GetProducer()->GetOutputDataObject(port->GetIndex());
     dinfo->Initialize();
-    dinfo->CopyFromObject(dobj);
+    dinfo->CopyFromObject(port);
     this->AddInformation(dinfo);
   }
 }
@@ -0,0 +1,184 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    vtkPVTemporalDataInformationCache.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkPVTemporalDataInformationCache.h"
+
+#include "vtkAlgorithm.h"
+#include "vtkDemandDrivenPipeline.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPVDataInformation.h"
+#include "vtkSmartPointer.h"
+#include "vtkWeakPointer.h"
+
+#include <map>
+#include <mutex>
+#include <utility>
+
+class vtkPVTemporalDataInformationCache::vtkInternals
+{
+public:
+  struct OutputTimeSteps
+  {
+    // to detect that the algorithm was deleted and its address reused.
+    vtkWeakPointer<vtkAlgorithm> Algorithm;
+    vtkMTimeType PipelineMTime = 0;
+    std::map<double, vtkSmartPointer<vtkPVDataInformation> > TimeSteps;
+  };
+
+  typedef std::map<std::pair<vtkAlgorithm*, int>, OutputTimeSteps> OutputsType;
+  OutputsType Outputs;
+  std::mutex Mutex;
+
+  static vtkMTimeType GetPipelineMTime(vtkAlgorithm* algorithm)
+  {
+    vtkDemandDrivenPipeline* ddp =
+      vtkDemandDrivenPipeline::SafeDownCast(algorithm->GetExecutive());
+    return ddp ? ddp->GetPipelineMTime() : algorithm->GetMTime();
+  }
+
+  // Returns the time steps of the output, emptied if they are out of date,
+  // or nullptr if the output has none.
+  OutputTimeSteps* Find(vtkAlgorithm* algorithm, int port)
+  {
+    auto iter = this->Outputs.find(std::make_pair(algorithm, port));
+    if (iter == this->Outputs.end())
+    {
+      return nullptr;
+    }
+    OutputTimeSteps& output = iter->second;
+    if (output.Algorithm.GetPointer() != algorithm)
+    {
+      this->Outputs.erase(iter);
+      return nullptr;
+    }
+    const vtkMTimeType mtime = vtkInternals::GetPipelineMTime(algorithm);
+    if (output.PipelineMTime != mtime)
+    {
+      output.TimeSteps.clear();
+      output.PipelineMTime = mtime;
+    }
+    return &output;
+  }
+
+  // Removes the outputs of deleted algorithms.
+  void Prune()
+  {
+    for (auto iter = this->Outputs.begin(); iter != this->Outputs.end();)
+    {
+      if (iter->second.Algorithm.GetPointer() == nullptr)
+      {
+        iter = this->Outputs.erase(iter);
+      }
+      else
+      {
+        ++iter;
+      }
+    }
+  }
+};
+
+vtkStandardNewMacro(vtkPVTemporalDataInformationCache);
+//----------------------------------------------------------------------------
+vtkPVTemporalDataInformationCache::vtkPVTemporalDataInformationCache()
+  : Enabled(true)
+  , Internals(new vtkPVTemporalDataInformationCache::vtkInternals())
+{
+}
+
+//----------------------------------------------------------------------------
+vtkPVTemporalDataInformationCache::~vtkPVTemporalDataInformationCache()
+{
+}
+
+//----------------------------------------------------------------------------
+vtkPVTemporalDataInformationCache* vtkPVTemporalDataInformationCache::GetInstance()
+{
+  // initialization of function-local statics is thread safe.
+  static vtkSmartPointer<vtkPVTemporalDataInformationCache> Instance =
+    vtkSmartPointer<vtkPVTemporalDataInformationCache>::New();
+  return Instance;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVTemporalDataInformationCache::AddTimeStepInformation(
+  vtkAlgorithm* algorithm, int port, double time, vtkPVDataInformation* info)
+{
+  if (!this->Enabled || !algorithm || !info)
+  {
+    return;
+  }
+
+  // the information of the blocks of composite datasets is not needed for
+  // temporal information and may be large.
+  vtkNew<vtkPVDataInformation> copy;
+  copy->DeepCopy(info, false);
+
+  auto& internals = (*this->Internals);
+  std::lock_guard<std::mutex> lock(internals.Mutex);
+  vtkInternals::OutputTimeSteps* output = internals.Find(algorithm, port);
+  if (!output)
+  {
+    internals.Prune();
+    output = &internals.Outputs[std::make_pair(algorithm, port)];
+    output->Algorithm = algorithm;
+    output->PipelineMTime = vtkInternals::GetPipelineMTime(algorithm);
+  }
+  output->TimeSteps[time] = copy.Get();
+}
+
+//----------------------------------------------------------------------------
+vtkPVDataInformation* vtkPVTemporalDataInformationCache::GetTimeStepInformation(
+  vtkAlgorithm* algorithm, int port, double time)
+{
+  if (!this->Enabled || !algorithm)
+  {
+    return nullptr;
+  }
+
+  auto& internals = (*this->Internals);
+  std::lock_guard<std::mutex> lock(internals.Mutex);
+  vtkInternals::OutputTimeSteps* output = internals.Find(algorithm, port);
+  if (!output)
+  {
+    return nullptr;
+  }
+  auto iter = output->TimeSteps.find(time);
+  return iter != output->TimeSteps.end() ? iter->second.GetPointer() : nullptr;
+}
+
+//----------------------------------------------------------------------------
+int vtkPVTemporalDataInformationCache::GetNumberOfTimeSteps(vtkAlgorithm* algorithm, int port)
+{
+  auto& internals = (*this->Internals);
+  std::lock_guard<std::mutex> lock(internals.Mutex);
+  vtkInternals::OutputTimeSteps* output = algorithm ? internals.Find(algorithm, port) : nullptr;
+  return output ? static_cast<int>(output->TimeSteps.size()) : 0;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVTemporalDataInformationCache::RemoveAllTimeSteps()
+{
+  auto& internals = (*this->Internals);
+  std::lock_guard<std::mutex> lock(internals.Mutex);
+  internals.Outputs.clear();
+}
+
+//----------------------------------------------------------------------------
+void vtkPVTemporalDataInformationCache::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Enabled: " << this->Enabled << endl;
+  os << indent << "Number of outputs: " << this->Internals->Outputs.size() << endl;
+}
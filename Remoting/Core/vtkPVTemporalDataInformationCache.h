@@ -0,0 +1,109 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    vtkPVTemporalDataInformationCache.h
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkPVTemporalDataInformationCache
+ * @brief   data information of each time step of pipeline outputs.
+ *
+ * vtkPVTemporalDataInformationCache keeps, for each algorithm output port,
+ * the data information (array ranges, bounds, number of points and cells,
+ * etc.) of the time steps it produced. The information of a time step is
+ * recorded whenever vtkPVDataInformation is gathered from the output, i.e.
+ * whenever the time step was executed for any reason, and may also be added
+ * by code that knows it without executing the pipeline, e.g. from file
+ * metadata. vtkPVTemporalDataInformation then only executes the time steps
+ * missing from the cache.
+ *
+ * The information of an output is discarded as soon as the pipeline MTime of
+ * its algorithm changes, that is when the algorithm or anything upstream of
+ * it is modified. The information of composite datasets is kept without the
+ * information of their blocks.
+ *
+ * There is one cache per process, see GetInstance(). A time step missing from
+ * the cache of any process of the global controller is executed on all of
+ * them, so the caches do not have to agree.
+ */
+
+#ifndef vtkPVTemporalDataInformationCache_h
+#define vtkPVTemporalDataInformationCache_h
+
+#include "vtkObject.h"
+#include "vtkRemotingCoreModule.h" //needed for exports
+
+#include <memory> // for std::unique_ptr
+
+class vtkAlgorithm;
+class vtkPVDataInformation;
+
+class VTKREMOTINGCORE_EXPORT vtkPVTemporalDataInformationCache : public vtkObject
+{
+public:
+  static vtkPVTemporalDataInformationCache* New();
+  vtkTypeMacro(vtkPVTemporalDataInformationCache, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Returns the cache of this process.
+   */
+  static vtkPVTemporalDataInformationCache* GetInstance();
+
+  //@{
+  /**
+   * When false, no information is recorded nor returned. Default is true.
+   */
+  vtkSetMacro(Enabled, bool);
+  vtkGetMacro(Enabled, bool);
+  vtkBooleanMacro(Enabled, bool);
+  //@}
+
+  /**
+   * Records the information of output `port` of `algorithm` at `time`. The
+   * information is copied.
+   */
+  void AddTimeStepInformation(
+    vtkAlgorithm* algorithm, int port, double time, vtkPVDataInformation* info);
+
+  /**
+   * Returns the information recorded for output `port` of `algorithm` at
+   * `time`, or nullptr if there is none or if the pipeline was modified since
+   * it was recorded.
+   */
+  vtkPVDataInformation* GetTimeStepInformation(vtkAlgorithm* algorithm, int port, double time);
+
+  /**
+   * Returns the number of time steps recorded for output `port` of
+   * `algorithm`, after discarding them if the pipeline was modified.
+   */
+  int GetNumberOfTimeSteps(vtkAlgorithm* algorithm, int port);
+
+  /**
+   * Removes the information of all the outputs.
+   */
+  void RemoveAllTimeSteps();
+
+protected:
+  vtkPVTemporalDataInformationCache();
+  ~vtkPVTemporalDataInformationCache() override;
+
+  bool Enabled;
+
+private:
+  vtkPVTemporalDataInformationCache(const vtkPVTemporalDataInformationCache&) = delete;
+  void operator=(const vtkPVTemporalDataInformationCache&) = delete;
+
+  class vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
+};
+
+#endif
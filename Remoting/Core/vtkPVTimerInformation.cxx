@@ -21,8 +21,15 @@
 #include "vtkObjectFactory.h"
 #include "vtkTimerLog.h"
 
+#include <atomic>
 #include <sstream>
 
+namespace
+{
+std::atomic<vtkTypeInt64> InformationCacheHitCount(0);
+std::atomic<vtkTypeInt64> InformationCacheMissCount(0);
+}
+
 //----------------------------------------------------------------------------
 vtkStandardNewMacro(vtkPVTimerInformation);
 
@@ -32,6 +39,8 @@ vtkPVTimerInformation::vtkPVTimerInformation()
   this->NumberOfLogs = 0;
   this->Logs = NULL;
   this->LogThreshold = 0;
+  this->InformationCacheHits = 0;
+  this->InformationCacheMisses = 0;
 }
 
 //----------------------------------------------------------------------------
@@ -59,12 +68,14 @@ vtkPVTimerInformation::~vtkPVTimerInformation()
 //----------------------------------------------------------------------------
 void vtkPVTimerInformation::CopyParametersToStream(vtkMultiProcessStream& str)
 {
+  this->Superclass::CopyParametersToStream(str);
   str << 828793 << this->LogThreshold;
 }
 
 //----------------------------------------------------------------------------
 void vtkPVTimerInformation::CopyParametersFromStream(vtkMultiProcessStream& str)
 {
+  this->Superclass::CopyParametersFromStream(str);
   int magic_number;
   str >> magic_number >> this->LogThreshold;
   if (magic_number != 828793)
@@ -130,6 +141,19 @@ void vtkPVTimerInformation::Reallocate(int num)
   this->NumberOfLogs = num;
 }
 
+//----------------------------------------------------------------------------
+void vtkPVTimerInformation::RecordInformationCacheAccess(bool hit)
+{
+  if (hit)
+  {
+    ++InformationCacheHitCount;
+  }
+  else
+  {
+    ++InformationCacheMissCount;
+  }
+}
+
 //----------------------------------------------------------------------------
 // This ignores the object, and gets the log from the timer.
 void vtkPVTimerInformation::CopyFromObject(vtkObject*)
@@ -137,6 +161,9 @@ void vtkPVTimerInformation::CopyFromObject(vtkObject*)
   int length;
   float threshold = this->LogThreshold;
 
+  this->InformationCacheHits = InformationCacheHitCount;
+  this->InformationCacheMisses = InformationCacheMissCount;
+
   length = vtkTimerLog::GetNumberOfEvents() * 40;
   if (length > 0)
   {
@@ -194,6 +221,9 @@ void vtkPVTimerInformation::AddInformation(vtkPVInformation* info)
 
   pdInfo = vtkPVTimerInformation::SafeDownCast(info);
 
+  this->InformationCacheHits += pdInfo->InformationCacheHits;
+  this->InformationCacheMisses += pdInfo->InformationCacheMisses;
+
   oldNum = this->NumberOfLogs;
   num = pdInfo->GetNumberOfLogs();
   if (num <= 0)
@@ -225,6 +255,7 @@ void vtkPVTimerInformation::CopyToStream(vtkClientServerStream* css)
   {
     *css << (const char*)this->Logs[idx];
   }
+  *css << this->InformationCacheHits << this->InformationCacheMisses;
   *css << vtkClientServerStream::End;
 }
 
@@ -254,6 +285,12 @@ void vtkPVTimerInformation::CopyFromStream(const vtkClientServerStream* css)
     }
     this->Logs[idx] = strcpy(new char[strlen(log) + 1], log);
   }
+  if (!css->GetArgument(0, this->NumberOfLogs + 1, &this->InformationCacheHits) ||
+    !css->GetArgument(0, this->NumberOfLogs + 2, &this->InformationCacheMisses))
+  {
+    vtkErrorMacro("Error parsing information cache statistics from message.");
+    return;
+  }
 }
 
 //----------------------------------------------------------------------------
@@ -277,6 +314,8 @@ void vtkPVTimerInformation::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
 
+  os << indent << "InformationCacheHits: " << this->InformationCacheHits << endl;
+  os << indent << "InformationCacheMisses: " << this->InformationCacheMisses << endl;
   os << indent << "NumberOfLogs: " << this->NumberOfLogs << endl;
   int idx;
   for (idx = 0; idx < this->NumberOfLogs; ++idx)
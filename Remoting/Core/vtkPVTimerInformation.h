@@ -49,6 +49,22 @@ public:
   char* GetLog(int proc);
   //@}
 
+  //@{
+  /**
+   * Number of information requests that were served from (hits) or missed
+   * (misses) the information cache of vtkPVSessionCore, summed over all the
+   * processes the timer information was gathered from.
+   */
+  vtkGetMacro(InformationCacheHits, vtkTypeInt64);
+  vtkGetMacro(InformationCacheMisses, vtkTypeInt64);
+  //@}
+
+  /**
+   * Records an access to the information cache of this process. Used by
+   * vtkPVSessionCore.
+   */
+  static void RecordInformationCacheAccess(bool hit);
+
   //@{
   /**
    * Transfer information about a single object into
@@ -91,6 +107,8 @@ protected:
   double LogThreshold;
   int NumberOfLogs;
   char** Logs;
+  vtkTypeInt64 InformationCacheHits;
+  vtkTypeInt64 InformationCacheMisses;
 
   vtkPVTimerInformation(const vtkPVTimerInformation&) = delete;
   void operator=(const vtkPVTimerInformation&) = delete;
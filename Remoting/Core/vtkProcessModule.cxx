@@ -27,6 +27,7 @@
 #include "vtkOutputWindow.h"
 #include "vtkPSystemTools.h"
 #include "vtkPVConfig.h"
+#include "vtkPVLogger.h"
 #include "vtkPVOptions.h"
 #include "vtkPolyData.h"
 #include "vtkSessionIterator.h"
@@ -303,6 +304,37 @@ bool vtkProcessModule::Finalize()
   // destroy the process-module.
   vtkProcessModule::Singleton = NULL;
 
+  // write the events recorded by all the ranks, see vtkPVLogger. The client
+  // and the servers each write their own file.
+  const char* eventsFile = vtksys::SystemTools::GetEnv("PARAVIEW_LOG_EVENTS_FILE");
+  if (eventsFile != nullptr && vtkPVLogger::GetEventRecording())
+  {
+    const char* processName = "batch";
+    switch (vtkProcessModule::ProcessType)
+    {
+      case PROCESS_CLIENT:
+        processName = "client";
+        break;
+      case PROCESS_SERVER:
+        processName = "server";
+        break;
+      case PROCESS_DATA_SERVER:
+        processName = "dataserver";
+        break;
+      case PROCESS_RENDER_SERVER:
+        processName = "renderserver";
+        break;
+      default:
+        break;
+    }
+    const std::string path = vtksys::SystemTools::GetFilenamePath(eventsFile);
+    const std::string fileName =
+      vtksys::SystemTools::GetFilenameWithoutLastExtension(eventsFile) + "." + processName +
+      vtksys::SystemTools::GetFilenameLastExtension(eventsFile);
+    vtkPVLogger::WriteEvents(
+      path.empty() ? fileName : path + "/" + fileName, vtkProcessModule::GlobalController);
+  }
+
   // We don't really need to call SetGlobalController(NULL) since
   // it's really stored with a weak pointer.  We set it to null anyways
   // in case it gets changed later to reference counting the pointer
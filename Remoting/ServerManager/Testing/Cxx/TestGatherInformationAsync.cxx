@@ -0,0 +1,98 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestGatherInformationAsync.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Tests vtkSMSession::GatherInformationAsync() and
+// vtkSMOutputPort::RequestDataInformation() in a builtin session.
+
+#include "vtkInitializationHelper.h"
+#include "vtkNew.h"
+#include "vtkPVDataInformation.h"
+#include "vtkProcessModule.h"
+#include "vtkSMOutputPort.h"
+#include "vtkSMPropertyHelper.h"
+#include "vtkSMSession.h"
+#include "vtkSMSessionProxyManager.h"
+#include "vtkSMSourceProxy.h"
+#include "vtkSmartPointer.h"
+
+#include <vector>
+
+namespace
+{
+class EventRecorder
+{
+public:
+  std::vector<vtkTypeUInt32> RequestIds;
+
+  void OnInformationGathered(vtkObject*, unsigned long, void* calldata)
+  {
+    this->RequestIds.push_back(*reinterpret_cast<vtkTypeUInt32*>(calldata));
+  }
+};
+}
+
+int TestGatherInformationAsync(int, char* argv[])
+{
+  vtkInitializationHelper::Initialize(argv[0], vtkProcessModule::PROCESS_CLIENT);
+
+  int exitCode = EXIT_SUCCESS;
+  {
+    vtkNew<vtkSMSession> session;
+    vtkSMSessionProxyManager* pxm = session->GetSessionProxyManager();
+
+    vtkSmartPointer<vtkSMSourceProxy> sphereSource;
+    sphereSource.TakeReference(
+      vtkSMSourceProxy::SafeDownCast(pxm->NewProxy("sources", "SphereSource")));
+    vtkSMPropertyHelper(sphereSource, "ThetaResolution").Set(8);
+    sphereSource->UpdateVTKObjects();
+    sphereSource->UpdatePipeline();
+
+    EventRecorder recorder;
+    session->AddObserver(
+      vtkSMSession::InformationGatheredEvent, &recorder, &EventRecorder::OnInformationGathered);
+
+    vtkNew<vtkPVDataInformation> info;
+    info->SetPortNumber(0);
+    const vtkTypeUInt32 requestId =
+      session->GatherInformationAsync(vtkPVSession::CLIENT, info, sphereSource->GetGlobalID());
+    if (requestId == 0 || !session->WaitForInformation(requestId) ||
+      session->GetIsInformationPending(requestId) || recorder.RequestIds.size() != 1 ||
+      recorder.RequestIds[0] != requestId)
+    {
+      cerr << "ERROR: InformationGatheredEvent was not fired for the request." << endl;
+      exitCode = EXIT_FAILURE;
+    }
+
+    vtkSMOutputPort* port = sphereSource->GetOutputPort(0u);
+    if (info->GetNumberOfPoints() != port->GetDataInformation()->GetNumberOfPoints())
+    {
+      cerr << "ERROR: mismatched information gathered asynchronously." << endl;
+      exitCode = EXIT_FAILURE;
+    }
+
+    // a modified source must invalidate the data information, requesting it
+    // again completes right away in builtin sessions.
+    vtkSMPropertyHelper(sphereSource, "ThetaResolution").Set(16);
+    sphereSource->UpdateVTKObjects();
+    sphereSource->UpdatePipeline();
+    if (!port->RequestDataInformation() ||
+      port->GetDataInformation()->GetNumberOfPoints() == info->GetNumberOfPoints())
+    {
+      cerr << "ERROR: data information requested was not updated." << endl;
+      exitCode = EXIT_FAILURE;
+    }
+  }
+  vtkInitializationHelper::Finalize();
+  return exitCode;
+}
@@ -0,0 +1,89 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestInformationCache.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkInitializationHelper.h"
+#include "vtkNew.h"
+#include "vtkPVDataInformation.h"
+#include "vtkPVSession.h"
+#include "vtkPVTimerInformation.h"
+#include "vtkProcessModule.h"
+#include "vtkSMPropertyHelper.h"
+#include "vtkSMSession.h"
+#include "vtkSMSessionProxyManager.h"
+#include "vtkSMSourceProxy.h"
+#include "vtkSmartPointer.h"
+
+namespace
+{
+void GetCacheStatistics(vtkSMSession* session, vtkTypeInt64& hits, vtkTypeInt64& misses)
+{
+  vtkNew<vtkPVTimerInformation> timerInfo;
+  session->GatherInformation(vtkPVSession::CLIENT, timerInfo, 0);
+  hits = timerInfo->GetInformationCacheHits();
+  misses = timerInfo->GetInformationCacheMisses();
+}
+
+vtkTypeInt64 GetNumberOfPoints(vtkSMSession* session, vtkSMProxy* proxy)
+{
+  vtkNew<vtkPVDataInformation> info;
+  info->SetPortNumber(0);
+  session->GatherInformation(vtkPVSession::CLIENT, info, proxy->GetGlobalID());
+  return info->GetNumberOfPoints();
+}
+}
+
+int TestInformationCache(int, char* argv[])
+{
+  vtkInitializationHelper::Initialize(argv[0], vtkProcessModule::PROCESS_CLIENT);
+
+  int exitCode = EXIT_SUCCESS;
+  {
+    vtkNew<vtkSMSession> session;
+    vtkSMSessionProxyManager* pxm = session->GetSessionProxyManager();
+
+    vtkSmartPointer<vtkSMSourceProxy> sphereSource;
+    sphereSource.TakeReference(
+      vtkSMSourceProxy::SafeDownCast(pxm->NewProxy("sources", "SphereSource")));
+    vtkSMPropertyHelper(sphereSource, "ThetaResolution").Set(8);
+    sphereSource->UpdateVTKObjects();
+    sphereSource->UpdatePipeline();
+
+    vtkTypeInt64 hits0, misses0, hits1, misses1, hits2, misses2;
+    GetCacheStatistics(session, hits0, misses0);
+
+    const vtkTypeInt64 numPts = GetNumberOfPoints(session, sphereSource);
+    const vtkTypeInt64 numPtsCached = GetNumberOfPoints(session, sphereSource);
+    GetCacheStatistics(session, hits1, misses1);
+    if (numPts != numPtsCached || hits1 <= hits0 || misses1 <= misses0)
+    {
+      cerr << "ERROR: repeated request should have been served from the cache." << endl;
+      exitCode = EXIT_FAILURE;
+    }
+
+    // modifying the source must invalidate the cached information.
+    vtkSMPropertyHelper(sphereSource, "ThetaResolution").Set(16);
+    sphereSource->UpdateVTKObjects();
+    sphereSource->UpdatePipeline();
+    const vtkTypeInt64 newNumPts = GetNumberOfPoints(session, sphereSource);
+    GetCacheStatistics(session, hits2, misses2);
+    if (newNumPts == numPts || misses2 <= misses1)
+    {
+      cerr << "ERROR: cached information was not invalidated (hits: " << hits2
+           << ", misses: " << misses2 << ")." << endl;
+      exitCode = EXIT_FAILURE;
+    }
+  }
+  vtkInitializationHelper::Finalize();
+  return exitCode;
+}
@@ -0,0 +1,118 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestInterpreterDispatch.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Micro-benchmark for vtkClientServerInterpreter command dispatch. A stream
+// similar to the one produced when loading a state, i.e. setting properties
+// defined at various levels of the class hierarchy, is replayed many times
+// and the number of messages processed per second is reported.
+//
+// Usage: TestInterpreterDispatch [--iterations N]
+
+#include "vtkClientServerInterpreter.h"
+#include "vtkClientServerInterpreterInitializer.h"
+#include "vtkClientServerStream.h"
+#include "vtkInitializationHelper.h"
+#include "vtkNew.h"
+#include "vtkProcessModule.h"
+#include "vtkSmartPointer.h"
+#include "vtkTimerLog.h"
+
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+void RecordStream(vtkObjectBase* sphere, vtkObjectBase* elevation, vtkClientServerStream& stream)
+{
+  double center[3] = { 1, 2, 3 };
+
+  // methods defined by the classes themselves.
+  stream << vtkClientServerStream::Invoke << sphere << "SetRadius" << 2.5
+         << vtkClientServerStream::End;
+  stream << vtkClientServerStream::Invoke << sphere << "SetThetaResolution" << 32
+         << vtkClientServerStream::End;
+  stream << vtkClientServerStream::Invoke << sphere << "SetPhiResolution" << 32
+         << vtkClientServerStream::End;
+  stream << vtkClientServerStream::Invoke << sphere << "SetCenter"
+         << vtkClientServerStream::InsertArray(center, 3) << vtkClientServerStream::End;
+  stream << vtkClientServerStream::Invoke << elevation << "SetLowPoint" << 0.0 << 0.0 << -1.0
+         << vtkClientServerStream::End;
+  stream << vtkClientServerStream::Invoke << elevation << "SetHighPoint" << 0.0 << 0.0 << 1.0
+         << vtkClientServerStream::End;
+
+  // methods defined by superclasses.
+  stream << vtkClientServerStream::Invoke << sphere << "SetReleaseDataFlag" << 0
+         << vtkClientServerStream::End;
+  stream << vtkClientServerStream::Invoke << elevation << "SetAbortExecute" << 0
+         << vtkClientServerStream::End;
+  stream << vtkClientServerStream::Invoke << sphere << "Modified" << vtkClientServerStream::End;
+  stream << vtkClientServerStream::Invoke << elevation << "GetMTime"
+         << vtkClientServerStream::End;
+}
+}
+
+int TestInterpreterDispatch(int argc, char* argv[])
+{
+  int iterations = 10000;
+  for (int cc = 1; cc + 1 < argc; ++cc)
+  {
+    if (strcmp(argv[cc], "--iterations") == 0)
+    {
+      iterations = atoi(argv[cc + 1]);
+    }
+  }
+
+  vtkInitializationHelper::Initialize(argv[0], vtkProcessModule::PROCESS_CLIENT);
+
+  int exitCode = EXIT_SUCCESS;
+  {
+    vtkSmartPointer<vtkClientServerInterpreter> interp;
+    interp.TakeReference(vtkClientServerInterpreterInitializer::GetInitializer()->NewInterpreter());
+
+    vtkSmartPointer<vtkObjectBase> sphere;
+    sphere.TakeReference(interp->NewInstance("vtkSphereSource"));
+    vtkSmartPointer<vtkObjectBase> elevation;
+    elevation.TakeReference(interp->NewInstance("vtkElevationFilter"));
+    if (!sphere || !elevation)
+    {
+      cerr << "ERROR: failed to create objects using the interpreter." << endl;
+      exitCode = EXIT_FAILURE;
+    }
+    else
+    {
+      vtkClientServerStream stream;
+      RecordStream(sphere, elevation, stream);
+
+      vtkNew<vtkTimerLog> timer;
+      timer->StartTimer();
+      for (int cc = 0; cc < iterations && exitCode == EXIT_SUCCESS; ++cc)
+      {
+        if (!interp->ProcessStream(stream))
+        {
+          cerr << "ERROR: failed to process stream." << endl;
+          exitCode = EXIT_FAILURE;
+        }
+      }
+      timer->StopTimer();
+
+      const double elapsed = timer->GetElapsedTime();
+      const double numMessages =
+        static_cast<double>(iterations) * static_cast<double>(stream.GetNumberOfMessages());
+      cout << "Processed " << numMessages << " messages in " << elapsed << " s ("
+           << (elapsed > 0 ? numMessages / elapsed : 0.0) << " messages/s)" << endl;
+    }
+  }
+  vtkInitializationHelper::Finalize();
+  return exitCode;
+}
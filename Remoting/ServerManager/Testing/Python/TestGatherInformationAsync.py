@@ -0,0 +1,94 @@
+"""
+    This test checks that the information requests made with
+    vtkSMSession::GatherInformationAsync() prepare the progress like the
+    synchronous gathers do and that the progress is cleaned up once all the
+    replies have been received, including when a synchronous request is made
+    while replies are pending.
+"""
+
+from paraview import servermanager
+from paraview import smtesting
+from paraview.simple import *
+from paraview.modules.vtkRemotingCore import vtkPVDataInformation, vtkPVSession
+
+# Make sure the test driver know that process has properly started
+print ("Process started")
+
+smtesting.ProcessCommandLineArguments()
+
+url = servermanager.vtkProcessModule.GetProcessModule().GetOptions().GetServerURL()
+Connect(url.split(':')[1][2:], int(url.split(':')[2]))
+session = servermanager.ActiveConnection.Session
+
+# counts the progress brackets sent to the progress handler.
+brackets = { "start" : 0, "end" : 0 }
+def onStart(caller, event):
+    brackets["start"] += 1
+def onEnd(caller, event):
+    brackets["end"] += 1
+handler = session.GetProgressHandler()
+handler.AddObserver("StartEvent", onStart)
+handler.AddObserver("EndEvent", onEnd)
+
+sphere = Sphere(ThetaResolution=32, PhiResolution=16)
+shrink = Shrink(Input=sphere)
+shrink.UpdatePipeline()
+proxy = shrink.SMProxy
+
+def gatherSync():
+    info = vtkPVDataInformation()
+    session.GatherInformation(vtkPVSession.DATA_SERVER, info, proxy.GetGlobalID())
+    return info
+
+def sameInformation(a, b):
+    return a.GetNumberOfPoints() == b.GetNumberOfPoints() and \
+        a.GetNumberOfCells() == b.GetNumberOfCells() and \
+        a.GetBounds() == b.GetBounds()
+
+reference = gatherSync()
+assert reference.GetNumberOfCells() > 0
+assert not session.GetPendingProgress()
+
+# a single request, the progress is pending until its reply is received.
+start = brackets["start"]
+end = brackets["end"]
+info = vtkPVDataInformation()
+requestId = session.GatherInformationAsync(vtkPVSession.DATA_SERVER, info, proxy.GetGlobalID())
+if session.GetIsInformationPending(requestId):
+    assert session.GetPendingProgress()
+assert session.WaitForInformation(requestId)
+assert not session.GetIsInformationPending(requestId)
+assert not session.GetPendingProgress()
+assert session.GetNumberOfPendingInformationRequests() == 0
+assert sameInformation(info, reference)
+assert brackets["start"] == start + 1
+assert brackets["end"] == end + 1
+
+# several requests share one progress bracket, closed by the last reply. A
+# synchronous request made in between does not close it.
+start = brackets["start"]
+end = brackets["end"]
+infos = [vtkPVDataInformation() for i in range(3)]
+requestIds = [session.GatherInformationAsync(vtkPVSession.DATA_SERVER, i, proxy.GetGlobalID())
+    for i in infos]
+assert sameInformation(gatherSync(), reference)
+shrink.UpdatePipeline()
+if session.GetNumberOfPendingInformationRequests() > 0:
+    assert session.GetPendingProgress()
+for requestId in requestIds:
+    assert session.WaitForInformation(requestId)
+assert not session.GetPendingProgress()
+assert session.GetNumberOfPendingInformationRequests() == 0
+for i in infos:
+    assert sameInformation(i, reference)
+assert brackets["start"] == start + 1
+assert brackets["end"] == end + 1
+
+# the synchronous path is unchanged.
+start = brackets["start"]
+shrink.UpdatePipeline(1.0)
+assert brackets["start"] > start
+assert brackets["end"] == brackets["start"]
+assert not session.GetPendingProgress()
+
+Disconnect()
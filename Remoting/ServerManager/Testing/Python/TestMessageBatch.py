@@ -0,0 +1,82 @@
+"""
+    This test checks that the messages sent to the server within a message
+    batch are delivered in order: property values pushed in a batch, and the
+    state loaded with vtkSMStateLoader (which uses a batch), must give the same
+    results as the messages sent one by one.
+"""
+
+from paraview import servermanager
+from paraview import smtesting
+from paraview.simple import *
+from os.path import join, isfile
+import os
+
+# Make sure the test driver know that process has properly started
+print ("Process started")
+
+smtesting.ProcessCommandLineArguments()
+assert smtesting.TempDir
+statefile = join(smtesting.TempDir, "TestMessageBatch.pvsm")
+if isfile(statefile):
+    os.remove(statefile)
+
+url = servermanager.vtkProcessModule.GetProcessModule().GetOptions().GetServerURL()
+Connect(url.split(':')[1][2:], int(url.split(':')[2]))
+session = servermanager.ActiveConnection.Session
+assert not session.GetInMessageBatch()
+
+# Reference, every property is pushed on its own.
+reference = Sphere(registrationName="reference")
+reference.ThetaResolution = 20
+reference.PhiResolution = 12
+referenceShrink = Shrink(registrationName="referenceShrink", Input=reference)
+referenceShrink.ShrinkFactor = 0.25
+referenceShrink.UpdatePipeline()
+numberOfCells = referenceShrink.GetDataInformation().GetNumberOfCells()
+bounds = referenceShrink.GetDataInformation().GetBounds()
+
+with servermanager.MessageBatch():
+    assert session.GetInMessageBatch()
+    sphere = Sphere(registrationName="batched")
+    # batches nest, the inner one must not send the queued messages.
+    with servermanager.MessageBatch():
+        sphere.ThetaResolution = 8
+        sphere.PhiResolution = 12
+    assert session.GetInMessageBatch()
+    # the last value pushed wins.
+    sphere.ThetaResolution = 20
+    shrink = Shrink(registrationName="batchedShrink", Input=sphere)
+    shrink.ShrinkFactor = 0.25
+
+    # updating needs a reply, the queued messages must be sent first.
+    shrink.UpdatePipeline()
+    assert shrink.GetDataInformation().GetNumberOfCells() == numberOfCells
+    assert session.GetInMessageBatch()
+assert not session.GetInMessageBatch()
+
+shrink.UpdatePipeline()
+assert shrink.GetDataInformation().GetNumberOfCells() == numberOfCells
+assert shrink.GetDataInformation().GetBounds() == bounds
+
+# Save the state and load it back, the state loader batches the messages.
+SaveState(statefile)
+for name in ("batchedShrink", "batched", "referenceShrink", "reference"):
+    Delete(FindSource(name))
+assert FindSource("batchedShrink") == None
+
+assert isfile(statefile)
+LoadState(statefile)
+assert not session.GetInMessageBatch()
+
+for name in ("batchedShrink", "referenceShrink"):
+    loaded = FindSource(name)
+    assert loaded != None
+    assert loaded.ShrinkFactor == 0.25
+    assert loaded.Input.ThetaResolution == 20
+    assert loaded.Input.PhiResolution == 12
+    loaded.UpdatePipeline()
+    assert loaded.GetDataInformation().GetNumberOfCells() == numberOfCells
+    assert loaded.GetDataInformation().GetBounds() == bounds
+
+os.remove(statefile)
+Disconnect()
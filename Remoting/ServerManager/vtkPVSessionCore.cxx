@@ -29,6 +29,7 @@
 #include "vtkPVOptions.h"
 #include "vtkPVSession.h"
 #include "vtkPVSessionCoreInterpreterHelper.h"
+#include "vtkPVTimerInformation.h"
 #include "vtkProcessModule.h"
 #include "vtkReservedRemoteObjectIds.h"
 #include "vtkSIProxy.h"
@@ -39,9 +40,11 @@
 #include "vtksys/FStream.hxx"
 
 #include <assert.h>
+#include <map>
 #include <set>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #define LOG(x)                                                                                     \
   if (this->LogStream)                                                                             \
@@ -140,6 +143,11 @@ public:
       {
         iter->second->UnRegister(NULL);
       }
+      if (!iter->second)
+      {
+        // SIObject is gone, so is the information gathered from it.
+        this->InformationCache.erase(globalUniqueId);
+      }
     }
   }
   //---------------------------------------------------------------------------
@@ -240,6 +248,17 @@ public:
   unsigned long InterpreterObserverID;
   std::map<vtkTypeUInt32, vtkSMMessage> MessageCacheMap;
   std::set<int> KnownClients;
+
+  // Information cached per global id. The inner map is keyed by the
+  // information class name and its serialized parameters.
+  struct InformationCacheEntry
+  {
+    std::string Key;
+    vtkClientServerStream Stream;
+    vtkSmartPointer<vtkPVInformation> Information;
+  };
+  std::map<vtkTypeUInt32, std::map<std::string, InformationCacheEntry> > InformationCache;
+
   // Used for collaboration as client may trigger invalid server request when
   // they are in a transitional state.
   bool DisableErrorMacro;
@@ -255,6 +274,7 @@ vtkPVSessionCore::vtkPVSessionCore()
   this->Interpreter = vtkClientServerInterpreterInitializer::GetInitializer()->NewInterpreter();
   this->MPIMToNSocketConnection = NULL;
   this->SymmetricMPIMode = false;
+  this->CacheInformation = true;
 
   vtkPVSessionCoreInterpreterHelper* helper = vtkPVSessionCoreInterpreterHelper::New();
   helper->SetCore(this);
@@ -797,17 +817,44 @@ bool vtkPVSessionCore::GatherInformationInternal(
     return false;
   }
 
+  // gather information from the VTK object, or from the SIObject itself if it
+  // is not a proxy.
   vtkSIProxy* siProxy = vtkSIProxy::SafeDownCast(siObject);
-  if (siProxy /*&& !information->GetUseSIObject()*/)
+  vtkObject* object =
+    siProxy ? vtkObject::SafeDownCast(siProxy->GetVTKObject()) : static_cast<vtkObject*>(siObject);
+
+  const std::string key = this->CacheInformation ? information->GetCacheKey(object) : std::string();
+  if (key.empty())
   {
-    vtkObject* object = vtkObject::SafeDownCast(siProxy->GetVTKObject());
     information->CopyFromObject(object);
+    return true;
   }
-  else
+
+  // the parameters identify what is being asked for e.g. the output port.
+  vtkMultiProcessStream parameters;
+  information->CopyParametersToStream(parameters);
+  std::vector<unsigned char> rawParameters;
+  parameters.GetRawData(rawParameters);
+  std::string slot = information->GetClassName();
+  slot.append(rawParameters.begin(), rawParameters.end());
+
+  auto& entry = this->Internals->InformationCache[globalid][slot];
+  const bool hit = (entry.Information != nullptr && entry.Key == key);
+  vtkPVTimerInformation::RecordInformationCacheAccess(hit);
+  if (!hit)
   {
-    // gather information from SIObject itself.
-    information->CopyFromObject(siObject);
+    // compute into a new instance since `information` is going to be merged
+    // with information from other processes. The previous entry lets
+    // composite data only rescan the blocks that changed.
+    vtkSmartPointer<vtkPVInformation> fresh;
+    fresh.TakeReference(information->NewInstance());
+    fresh->CopyParametersFromStream(parameters);
+    fresh->IncrementalCopyFromObject(object, entry.Information);
+    fresh->CopyToStream(&entry.Stream);
+    entry.Key = key;
+    entry.Information = fresh;
   }
+  information->CopyFromStream(&entry.Stream);
   return true;
 }
 
@@ -847,7 +894,8 @@ bool vtkPVSessionCore::GatherInformation(
     this->ParallelController->TriggerRMIOnAllChildren(&type, 1, ROOT_SATELLITE_RMI_TAG);
 
     vtkMultiProcessStream stream;
-    stream << information->GetClassName() << globalid;
+    stream << information->GetClassName() << globalid
+           << static_cast<int>(information->GetUseTreeReduction());
 
     // serialize information parameters so all processes have the same ivars.
     information->CopyParametersToStream(stream);
@@ -855,6 +903,10 @@ bool vtkPVSessionCore::GatherInformation(
     this->ParallelController->Broadcast(stream, 0);
   }
 
+  if (information->GetUseTreeReduction())
+  {
+    return this->ReduceInformation(information);
+  }
   return this->CollectInformation(information);
 }
 
@@ -866,7 +918,8 @@ void vtkPVSessionCore::GatherInformationStatelliteCallback()
 
   std::string classname;
   vtkTypeUInt32 globalid;
-  stream >> classname >> globalid;
+  int useTreeReduction;
+  stream >> classname >> globalid >> useTreeReduction;
 
   vtkSmartPointer<vtkObjectBase> o;
   o.TakeReference(vtkClientServerStreamInstantiator::CreateInstance(classname.c_str()));
@@ -874,14 +927,23 @@ void vtkPVSessionCore::GatherInformationStatelliteCallback()
   if (info)
   {
     info->CopyParametersFromStream(stream);
+    // the root decides which reduction is used.
+    info->SetUseTreeReduction(useTreeReduction != 0);
     this->GatherInformationInternal(info, globalid);
-    this->CollectInformation(info);
   }
   else
   {
     vtkErrorMacro("Could not gather information on Satellite.");
-    // let the parent know, otherwise root will hang.
-    this->CollectInformation(NULL);
+  }
+
+  // let the parent know even on failure, otherwise root will hang.
+  if (useTreeReduction)
+  {
+    this->ReduceInformation(info);
+  }
+  else
+  {
+    this->CollectInformation(info);
   }
 }
 
@@ -989,6 +1051,79 @@ bool vtkPVSessionCore::CollectInformation(vtkPVInformation* info)
   return true;
 }
 
+//----------------------------------------------------------------------------
+bool vtkPVSessionCore::ReduceInformation(vtkPVInformation* info)
+{
+  const int rank = this->ParallelController->GetLocalProcessId();
+  const int nranks = this->ParallelController->GetNumberOfProcesses();
+  if (nranks == 1)
+  {
+    /* short-circuit */
+    return true;
+  }
+
+  // Binomial tree: at each level, ranks that are a multiple of 2*step receive
+  // the partial result accumulated by `rank + step` and merge it in. Since
+  // `rank + step` always holds the merged information for the contiguous rank
+  // range following the one held by `rank`, the merge order matches the order
+  // used by CollectInformation().
+  for (int step = 1; step < nranks; step *= 2)
+  {
+    if (rank % (2 * step) == 0)
+    {
+      const int child = rank + step;
+      if (child >= nranks)
+      {
+        continue;
+      }
+
+      vtkIdType length = 0;
+      this->ParallelController->Receive(&length, 1, child, ROOT_SATELLITE_INFO_TAG);
+      if (length <= 0)
+      {
+        // child failed to gather information; nothing to merge.
+        continue;
+      }
+
+      std::vector<unsigned char> buffer(length);
+      this->ParallelController->Receive(&buffer[0], length, child, ROOT_SATELLITE_INFO_TAG);
+      if (info)
+      {
+        vtkClientServerStream rcvStream;
+        rcvStream.SetData(&buffer[0], buffer.size());
+        vtkSmartPointer<vtkPVInformation> tempInfo;
+        tempInfo.TakeReference(info->NewInstance());
+        tempInfo->CopyFromStream(&rcvStream);
+        info->AddInformation(tempInfo);
+      }
+    }
+    else
+    {
+      // forward the partial result to the parent and we're done.
+      const int parent = rank - step;
+      vtkClientServerStream stream;
+      const unsigned char* data = nullptr;
+      size_t length = 0;
+      if (info)
+      {
+        info->CopyToStream(&stream);
+        stream.GetData(&data, &length);
+      }
+      vtkIdType local_length = static_cast<vtkIdType>(length);
+      this->ParallelController->Send(&local_length, 1, parent, ROOT_SATELLITE_INFO_TAG);
+      if (local_length > 0)
+      {
+        this->ParallelController->Send(data, local_length, parent, ROOT_SATELLITE_INFO_TAG);
+      }
+      break;
+    }
+  }
+
+  // Keep the same synchronization semantics as CollectInformation().
+  this->ParallelController->Barrier();
+  return true;
+}
+
 //----------------------------------------------------------------------------
 void vtkPVSessionCore::RegisterRemoteObject(vtkTypeUInt32 gid, vtkObject* obj)
 {
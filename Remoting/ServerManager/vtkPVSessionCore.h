@@ -127,6 +127,19 @@ public:
   virtual bool GatherInformation(
     vtkTypeUInt32 location, vtkPVInformation* information, vtkTypeUInt32 globalid);
 
+  //@{
+  /**
+   * When enabled (default), information that supports it (see
+   * vtkPVInformation::GetCacheKey()) is cached per object on each process.
+   * Repeated requests for an object that has not changed since are then
+   * served from the cached serialized information instead of being recomputed.
+   * Cache hits and misses are reported by vtkPVTimerInformation.
+   */
+  vtkSetMacro(CacheInformation, bool);
+  vtkGetMacro(CacheInformation, bool);
+  vtkBooleanMacro(CacheInformation, bool);
+  //@}
+
   /**
    * Returns the number of processes. This simply calls the
    * GetNumberOfProcesses() on this->ParallelController
@@ -215,6 +228,15 @@ protected:
    */
   bool CollectInformation(vtkPVInformation*);
 
+  /**
+   * Gather information across MPI satellites using a binary tree reduction.
+   * Each rank merges the information of its children with
+   * vtkPVInformation::AddInformation() and forwards the partial result to its
+   * parent, so the root only performs log(P) merges. Used when
+   * vtkPVInformation::GetUseTreeReduction() is true on the root.
+   */
+  bool ReduceInformation(vtkPVInformation*);
+
   /**
    * Increment reference count of a local vtkSIObject.
    */
@@ -242,6 +264,7 @@ protected:
   vtkWeakPointer<vtkMultiProcessController> ParallelController;
   vtkClientServerInterpreter* Interpreter;
   vtkMPIMToNSocketConnection* MPIMToNSocketConnection;
+  bool CacheInformation;
 
 private:
   vtkPVSessionCore(const vtkPVSessionCore&) = delete;
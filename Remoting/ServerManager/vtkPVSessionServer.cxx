@@ -608,6 +608,39 @@ void vtkPVSessionServer::OnClientServerMessageRMI(void* message, int message_len
     }
     break;
 
+    case vtkPVSessionServer::EXECUTE_STREAM_INLINE:
+    {
+      // same as EXECUTE_STREAM except that the stream data is part of the
+      // message, this is used for streams sent within a BATCH.
+      int ignore_errors;
+      unsigned char* css_data = nullptr;
+      unsigned int size = 0;
+      stream >> ignore_errors;
+      stream.Pop(css_data, size);
+      vtkClientServerStream cssStream;
+      cssStream.SetData(css_data, size);
+      this->ExecuteStream(vtkPVSession::CLIENT_AND_SERVERS, cssStream, ignore_errors != 0);
+      delete[] css_data;
+    }
+    break;
+
+    case vtkPVSessionServer::BATCH:
+    {
+      // messages queued by the client in a message batch (see
+      // vtkSMSession::BeginMessageBatch), process them in order.
+      int count;
+      stream >> count;
+      for (int cc = 0; cc < count; ++cc)
+      {
+        unsigned char* data = nullptr;
+        unsigned int size = 0;
+        stream.Pop(data, size);
+        this->OnClientServerMessageRMI(data, static_cast<int>(size));
+        delete[] data;
+      }
+    }
+    break;
+
     case vtkPVSessionServer::LAST_RESULT:
     {
       this->SendLastResultToClient();
@@ -622,6 +655,16 @@ void vtkPVSessionServer::OnClientServerMessageRMI(void* message, int message_len
       this->GatherInformationInternal(location, classname.c_str(), globalid, stream);
     }
     break;
+
+    case vtkPVSessionServer::GATHER_INFORMATION_ASYNC:
+    {
+      std::string classname;
+      vtkTypeUInt32 requestId, location, globalid;
+      stream >> requestId >> location >> classname >> globalid;
+      this->GatherInformationAsyncInternal(
+        requestId, location, classname.c_str(), globalid, stream);
+    }
+    break;
   }
 }
 
@@ -642,23 +685,37 @@ void vtkPVSessionServer::SendLastResultToClient()
 }
 
 //----------------------------------------------------------------------------
-void vtkPVSessionServer::GatherInformationInternal(vtkTypeUInt32 location, const char* classname,
-  vtkTypeUInt32 globalid, vtkMultiProcessStream& stream)
+bool vtkPVSessionServer::GatherInformationToStream(vtkTypeUInt32 location,
+  const char* classname, vtkTypeUInt32 globalid, vtkMultiProcessStream& stream,
+  vtkClientServerStream& css)
 {
   vtkSmartPointer<vtkObjectBase> o;
   o.TakeReference(vtkClientServerStreamInstantiator::CreateInstance(classname));
 
   vtkPVInformation* info = vtkPVInformation::SafeDownCast(o);
-  if (info)
+  if (!info)
   {
-    // ensures that the vtkPVInformation has the same ivars locally as on the
-    // client.
-    info->CopyParametersFromStream(stream);
+    vtkErrorMacro(
+      "Could not create information object: `" << (classname ? classname : "(nullptr)") << "`.");
+    return false;
+  }
 
-    this->GatherInformation(location, info, globalid);
+  // ensures that the vtkPVInformation has the same ivars locally as on the
+  // client.
+  info->CopyParametersFromStream(stream);
 
-    vtkClientServerStream css;
-    info->CopyToStream(&css);
+  this->GatherInformation(location, info, globalid);
+  info->CopyToStream(&css);
+  return true;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVSessionServer::GatherInformationInternal(vtkTypeUInt32 location, const char* classname,
+  vtkTypeUInt32 globalid, vtkMultiProcessStream& stream)
+{
+  vtkClientServerStream css;
+  if (this->GatherInformationToStream(location, classname, globalid, stream, css))
+  {
     size_t length;
     const unsigned char* data;
     css.GetData(&data, &length);
@@ -670,8 +727,6 @@ void vtkPVSessionServer::GatherInformationInternal(vtkTypeUInt32 location, const
   }
   else
   {
-    vtkErrorMacro(
-      "Could not create information object: `" << (classname ? classname : "(nullptr)") << "`.");
     // let client know that gather failed.
     int len = 0;
     this->Internal->GetActiveController()->Send(
@@ -679,6 +734,35 @@ void vtkPVSessionServer::GatherInformationInternal(vtkTypeUInt32 location, const
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkPVSessionServer::GatherInformationAsyncInternal(vtkTypeUInt32 requestId,
+  vtkTypeUInt32 location, const char* classname, vtkTypeUInt32 globalid,
+  vtkMultiProcessStream& stream)
+{
+  // the client prepares the progress before sending the request and cleans it
+  // up when the reply arrives, so the progress of the gather is reported as
+  // for GatherInformationInternal().
+  vtkClientServerStream css;
+  const bool success =
+    this->GatherInformationToStream(location, classname, globalid, stream, css);
+
+  // the reply is sent as a RMI so that the client does not have to wait for
+  // it, the client processes it along with the server notifications.
+  vtkMultiProcessStream reply;
+  reply << requestId << static_cast<int>(success);
+  if (success)
+  {
+    size_t length;
+    const unsigned char* data;
+    css.GetData(&data, &length);
+    reply.Push(const_cast<unsigned char*>(data), static_cast<unsigned int>(length));
+  }
+  std::vector<unsigned char> raw_message;
+  reply.GetRawData(raw_message);
+  this->Internal->GetActiveController()->TriggerRMI(1, &raw_message[0],
+    static_cast<int>(raw_message.size()), vtkPVSessionServer::REPLY_GATHER_INFORMATION_RMI);
+}
+
 //----------------------------------------------------------------------------
 void vtkPVSessionServer::OnCloseSessionRMI()
 {
@@ -83,13 +83,17 @@ public:
     REGISTER_SI = 16,
     UNREGISTER_SI = 17,
     LAST_RESULT = 18,
+    BATCH = 19,
+    EXECUTE_STREAM_INLINE = 20,
+    GATHER_INFORMATION_ASYNC = 21,
     SERVER_NOTIFICATION_MESSAGE_RMI = 55624,
     CLIENT_SERVER_MESSAGE_RMI = 55625,
     CLOSE_SESSION = 55626,
     REPLY_GATHER_INFORMATION_TAG = 55627,
     REPLY_PULL = 55628,
     REPLY_LAST_RESULT = 55629,
-    EXECUTE_STREAM_TAG = 55630
+    EXECUTE_STREAM_TAG = 55630,
+    REPLY_GATHER_INFORMATION_RMI = 55631
   };
 
   //@{
@@ -146,6 +150,20 @@ protected:
   void GatherInformationInternal(
     vtkTypeUInt32 location, const char* classname, vtkTypeUInt32 globalid, vtkMultiProcessStream&);
 
+  /**
+   * Called when client triggers GatherInformationAsync(). The reply is sent
+   * to the client as a REPLY_GATHER_INFORMATION_RMI.
+   */
+  void GatherInformationAsyncInternal(vtkTypeUInt32 requestId, vtkTypeUInt32 location,
+    const char* classname, vtkTypeUInt32 globalid, vtkMultiProcessStream&);
+
+  /**
+   * Gathers the information and serializes it in \c css. Returns false if the
+   * information object could not be created.
+   */
+  bool GatherInformationToStream(vtkTypeUInt32 location, const char* classname,
+    vtkTypeUInt32 globalid, vtkMultiProcessStream&, vtkClientServerStream& css);
+
   /**
    * Sends the last result to client.
    */
@@ -227,6 +227,7 @@ void vtkSISourceProxy::UpdatePipeline(int port, double time, bool doTime)
 
   vtkVLogScopeF(PARAVIEW_LOG_PIPELINE_VERBOSITY(), "%s: update pipeline(%d, %f, %s) ",
     this->GetLogNameOrDefault(), port, time, (doTime ? "true" : "false"));
+  PARAVIEW_LOG_EVENT_SCOPE(PIPELINE, this->GetLogNameOrDefault());
 
   vtkAlgorithm* algo = output_port->GetProducer();
   assert(algo);
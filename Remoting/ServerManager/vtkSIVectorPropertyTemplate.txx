@@ -36,6 +36,7 @@ struct HelperTraits<int, ForceIdType>
 {
   static int size(const Variant& variant) { return variant.integer_size(); }
   static int get(const Variant& variant, int idx) { return variant.integer(idx); }
+  static const int* data(const Variant& variant) { return variant.integer().data(); }
   static Variant_Type variant_type() { return Variant::INT; }
   static void append(Variant& variant, int value) { variant.add_integer(value); }
 };
@@ -45,6 +46,7 @@ struct HelperTraits<double, ForceIdType>
 {
   static int size(const Variant& variant) { return variant.float64_size(); }
   static double get(const Variant& variant, int idx) { return variant.float64(idx); }
+  static const double* data(const Variant& variant) { return variant.float64().data(); }
   static Variant_Type variant_type() { return Variant::FLOAT64; }
   static void append(Variant& variant, double value) { variant.add_float64(value); }
 };
@@ -54,6 +56,8 @@ struct HelperTraits<vtkIdType, bool>
 {
   static int size(const Variant& variant) { return variant.idtype_size(); }
   static vtkIdType get(const Variant& variant, int idx) { return variant.idtype(idx); }
+  // the message stores 64-bit integers which may not be vtkIdType, always copy.
+  static const vtkIdType* data(const Variant&) { return nullptr; }
   static Variant_Type variant_type() { return Variant::IDTYPE; }
   static void append(Variant& variant, vtkIdType value) { variant.add_idtype(value); }
 };
@@ -146,9 +150,20 @@ bool vtkSIVectorPropertyTemplate<T, force_idtype>::Push(vtkSMMessage* message, i
   this->SaveValueToCache(message, offset);
 
   const Variant* variant = &prop->value();
+
+  // Push the values straight from the message when it stores them in the
+  // right type to avoid copying large values (point lists, transfer
+  // functions, etc.) before they are written to the stream.
+  const int num_elems = HelperTraits<T, force_idtype>::size(*variant);
+  if (const T* data = HelperTraits<T, force_idtype>::data(*variant))
+  {
+    return this->Push(num_elems > 0 ? data : nullptr, num_elems);
+  }
+
   std::vector<T> values = VariantToVector<T, force_idtype>(*variant);
-  return (values.size() > 0) ? this->Push(&values[0], static_cast<int>(values.size()))
-                             : this->Push(static_cast<T*>(NULL), static_cast<int>(values.size()));
+  return (values.size() > 0)
+    ? this->Push(&values[0], static_cast<int>(values.size()))
+    : this->Push(static_cast<const T*>(nullptr), static_cast<int>(values.size()));
 }
 
 //---------------------------------------------------------------------------
@@ -210,14 +225,18 @@ bool vtkSIVectorPropertyTemplate<T, force_idtype>::Pull(vtkSMMessage* message)
 
 //---------------------------------------------------------------------------
 template <class T, class force_idtype>
-bool vtkSIVectorPropertyTemplate<T, force_idtype>::Push(T* values, int number_of_elements)
+bool vtkSIVectorPropertyTemplate<T, force_idtype>::Push(const T* values, int number_of_elements)
 {
   if (this->InformationOnly || !this->Command)
   {
     return true;
   }
 
+  // Reserve space for the values up-front so that large values are not
+  // copied again each time the stream grows.
   vtkClientServerStream stream;
+  stream.Reserve(
+    1024 + static_cast<size_t>(number_of_elements) * (sizeof(T) + sizeof(vtkTypeUInt32)));
   vtkObjectBase* object = this->GetVTKObject();
 
   if (this->CleanCommand)
@@ -15,6 +15,7 @@
 #include "vtkSMOutputPort.h"
 
 #include "vtkAlgorithm.h"
+#include "vtkClientServerStream.h"
 #include "vtkCollection.h"
 #include "vtkCollectionIterator.h"
 #include "vtkCommand.h"
@@ -50,11 +51,15 @@ vtkSMOutputPort::vtkSMOutputPort()
   this->SourceProxy = 0;
   this->CompoundSourceProxy = 0;
   this->ObjectsCreated = 1;
+  this->DataInformationRequestId = 0;
+  this->DataAssemblyInformationRequestId = 0;
+  this->RequestObserverId = 0;
 }
 
 //----------------------------------------------------------------------------
 vtkSMOutputPort::~vtkSMOutputPort()
 {
+  this->CancelDataInformationRequest();
   this->SetSourceProxy(0);
   this->ClassNameInformation->Delete();
   this->DataInformation->Delete();
@@ -76,6 +81,111 @@ vtkPVDataInformation* vtkSMOutputPort::GetDataInformation()
   return this->DataInformation;
 }
 
+//----------------------------------------------------------------------------
+bool vtkSMOutputPort::RequestDataInformation()
+{
+  if (this->DataInformationValid)
+  {
+    return true;
+  }
+  if (this->DataInformationRequestId != 0 || this->DataAssemblyInformationRequestId != 0)
+  {
+    // already waiting for the reply.
+    return false;
+  }
+
+  vtkSMSourceProxy* source = this->SourceProxy;
+  vtkSMSession* session = source ? source->GetSession() : nullptr;
+  if (!session || source->GetLocation() == 0)
+  {
+    this->GetDataInformation();
+    return this->DataInformationValid;
+  }
+
+  // ensure that the proxy is created.
+  source->CreateVTKObjects();
+
+  this->PendingDataInformation = vtkSmartPointer<vtkPVDataInformation>::New();
+  this->PendingDataInformation->SetPortNumber(this->PortIndex);
+  this->PendingDataAssemblyInformation = vtkSmartPointer<vtkPVDataAssemblyInformation>::New();
+  this->PendingDataAssemblyInformation->SetPortNumber(this->PortIndex);
+
+  const vtkTypeUInt32 dataRequestId = session->GatherInformationAsync(
+    source->GetLocation(), this->PendingDataInformation, source->GetGlobalID());
+  const vtkTypeUInt32 assemblyRequestId = session->GatherInformationAsync(
+    source->GetLocation(), this->PendingDataAssemblyInformation, source->GetGlobalID());
+
+  // requests may be completed right away e.g. in builtin sessions.
+  this->DataInformationRequestId =
+    session->GetIsInformationPending(dataRequestId) ? dataRequestId : 0;
+  this->DataAssemblyInformationRequestId =
+    session->GetIsInformationPending(assemblyRequestId) ? assemblyRequestId : 0;
+  if (this->DataInformationRequestId == 0 && this->DataAssemblyInformationRequestId == 0)
+  {
+    this->CompleteDataInformationRequest();
+    return true;
+  }
+
+  this->RequestSession = session;
+  this->RequestObserverId = session->AddObserver(
+    vtkSMSession::InformationGatheredEvent, this, &vtkSMOutputPort::OnInformationGathered);
+  return false;
+}
+
+//----------------------------------------------------------------------------
+void vtkSMOutputPort::OnInformationGathered(vtkObject*, unsigned long, void* calldata)
+{
+  const vtkTypeUInt32 requestId = *reinterpret_cast<vtkTypeUInt32*>(calldata);
+  if (requestId == this->DataInformationRequestId)
+  {
+    this->DataInformationRequestId = 0;
+  }
+  else if (requestId == this->DataAssemblyInformationRequestId)
+  {
+    this->DataAssemblyInformationRequestId = 0;
+  }
+  else
+  {
+    return;
+  }
+
+  if (this->DataInformationRequestId == 0 && this->DataAssemblyInformationRequestId == 0)
+  {
+    this->CompleteDataInformationRequest();
+    this->InvokeEvent(vtkCommand::UpdateInformationEvent);
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkSMOutputPort::CompleteDataInformationRequest()
+{
+  // copy the information using its serialization rather than swapping the
+  // objects since callers may hold on to the pointers.
+  vtkClientServerStream css;
+  this->PendingDataInformation->CopyToStream(&css);
+  this->DataInformation->CopyFromStream(&css);
+  css.Reset();
+  this->PendingDataAssemblyInformation->CopyToStream(&css);
+  this->DataAssemblyInformation->CopyFromStream(&css);
+  this->DataInformationValid = true;
+  this->CancelDataInformationRequest();
+}
+
+//----------------------------------------------------------------------------
+void vtkSMOutputPort::CancelDataInformationRequest()
+{
+  if (this->RequestSession && this->RequestObserverId != 0)
+  {
+    this->RequestSession->RemoveObserver(this->RequestObserverId);
+  }
+  this->RequestSession = nullptr;
+  this->RequestObserverId = 0;
+  this->DataInformationRequestId = 0;
+  this->DataAssemblyInformationRequestId = 0;
+  this->PendingDataInformation = nullptr;
+  this->PendingDataAssemblyInformation = nullptr;
+}
+
 //----------------------------------------------------------------------------
 vtkPVTemporalDataInformation* vtkSMOutputPort::GetTemporalDataInformation()
 {
@@ -115,6 +225,8 @@ const char* vtkSMOutputPort::GetDataClassName()
 //----------------------------------------------------------------------------
 void vtkSMOutputPort::InvalidateDataInformation()
 {
+  // replies to a pending request are out of date.
+  this->CancelDataInformationRequest();
   this->DataInformationValid = false;
   this->ClassNameInformationValid = false;
   this->TemporalDataInformationValid = false;
@@ -129,6 +241,7 @@ void vtkSMOutputPort::GatherDataInformation()
     return;
   }
 
+  this->CancelDataInformationRequest();
   this->SourceProxy->GetSession()->PrepareProgress();
   this->DataInformation->Initialize();
   this->DataInformation->SetPortNumber(this->PortIndex);
@@ -32,7 +32,8 @@
 
 #include "vtkRemotingServerManagerModule.h" //needed for exports
 #include "vtkSMProxy.h"
-#include "vtkWeakPointer.h" // needed by SourceProxy pointer
+#include "vtkSmartPointer.h" // needed for vtkSmartPointer
+#include "vtkWeakPointer.h"  // needed by SourceProxy pointer
 
 class vtkCollection;
 class vtkDataAssembly;
@@ -58,6 +59,16 @@ public:
    */
   virtual vtkPVDataInformation* GetDataInformation();
 
+  /**
+   * Non-blocking alternative to GetDataInformation(). Returns true if the data
+   * information is valid and hence GetDataInformation() returns without
+   * communicating with the servers. Otherwise, the data information is
+   * requested using vtkSMSession::GatherInformationAsync() and false is
+   * returned. vtkCommand::UpdateInformationEvent is fired once the data
+   * information has been received.
+   */
+  bool RequestDataInformation();
+
   /**
    * Returns data information collected over all timesteps provided by the
    * pipeline. If the data information is not valid, this results iterating over
@@ -120,6 +131,23 @@ protected:
    */
   virtual void GatherDataInformation();
 
+  /**
+   * Called when a reply for a request made by RequestDataInformation() is
+   * received.
+   */
+  void OnInformationGathered(vtkObject*, unsigned long, void* calldata);
+
+  /**
+   * Copies the information received for the request made by
+   * RequestDataInformation() and marks the data information valid.
+   */
+  void CompleteDataInformationRequest();
+
+  /**
+   * Discards the pending request made by RequestDataInformation(), if any.
+   */
+  void CancelDataInformationRequest();
+
   /**
    * Get temporal information from the server.
    */
@@ -155,6 +183,14 @@ protected:
   vtkPVTemporalDataInformation* TemporalDataInformation;
   bool TemporalDataInformationValid;
 
+  // State for the request made by RequestDataInformation().
+  vtkSmartPointer<vtkPVDataInformation> PendingDataInformation;
+  vtkSmartPointer<vtkPVDataAssemblyInformation> PendingDataAssemblyInformation;
+  vtkTypeUInt32 DataInformationRequestId;
+  vtkTypeUInt32 DataAssemblyInformationRequestId;
+  vtkWeakPointer<vtkSMSession> RequestSession;
+  unsigned long RequestObserverId;
+
 private:
   vtkSMOutputPort(const vtkSMOutputPort&) = delete;
   void operator=(const vtkSMOutputPort&) = delete;
@@ -72,6 +72,8 @@ vtkSMSession::vtkSMSession(
   this->SessionProxyManager = NULL;
   this->StateLocator = vtkSMStateLocator::New();
   this->IsAutoMPI = false;
+  this->MessageBatchCount = 0;
+  this->LastInformationRequestId = 0;
 
   // Create and setup deserializer for the local ProxyLocator
   vtkNew<vtkSMDeserializerProtobuf> deserializer;
@@ -131,6 +133,54 @@ void vtkSMSession::PushState(vtkSMMessage* msg)
   this->Superclass::PushState(msg);
 }
 
+//----------------------------------------------------------------------------
+void vtkSMSession::BeginMessageBatch()
+{
+  ++this->MessageBatchCount;
+}
+
+//----------------------------------------------------------------------------
+void vtkSMSession::EndMessageBatch()
+{
+  if (this->MessageBatchCount <= 0)
+  {
+    vtkErrorMacro("BeginMessageBatch and EndMessageBatch mismatch!");
+    this->MessageBatchCount = 0;
+    return;
+  }
+  if (--this->MessageBatchCount == 0)
+  {
+    this->FlushPendingMessages();
+  }
+}
+
+//----------------------------------------------------------------------------
+vtkTypeUInt32 vtkSMSession::GatherInformationAsync(
+  vtkTypeUInt32 location, vtkPVInformation* information, vtkTypeUInt32 globalid)
+{
+  vtkTypeUInt32 requestId = this->GetNextInformationRequestId();
+  this->GatherInformation(location, information, globalid);
+  this->InvokeEvent(vtkSMSession::InformationGatheredEvent, &requestId);
+  return requestId;
+}
+
+//----------------------------------------------------------------------------
+bool vtkSMSession::WaitForInformation(vtkTypeUInt32 vtkNotUsed(requestId))
+{
+  return true;
+}
+
+//----------------------------------------------------------------------------
+vtkTypeUInt32 vtkSMSession::GetNextInformationRequestId()
+{
+  // 0 is never used as a request id.
+  if (++this->LastInformationRequestId == 0)
+  {
+    ++this->LastInformationRequestId;
+  }
+  return this->LastInformationRequestId;
+}
+
 //----------------------------------------------------------------------------
 void vtkSMSession::UpdateStateHistory(vtkSMMessage* msg)
 {
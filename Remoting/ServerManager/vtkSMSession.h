@@ -155,6 +155,83 @@ public:
    */
   void NotifyOtherClients(const vtkSMMessage*) override { /* nothing to do. */}
 
+  //@{
+  /**
+   * Begin/end a batch of messages sent to the servers. Between these calls,
+   * the states pushed and the streams executed on remote servers are queued
+   * and sent to each server as a single message when the outermost batch
+   * ends, or earlier if a reply from the servers is needed. Calls can be
+   * nested. This has no effect on builtin sessions.
+   */
+  void BeginMessageBatch();
+  void EndMessageBatch();
+  //@}
+
+  /**
+   * Returns true if the session is within a BeginMessageBatch() and
+   * EndMessageBatch() block.
+   */
+  bool GetInMessageBatch() const { return this->MessageBatchCount > 0; }
+
+  //---------------------------------------------------------------------------
+  // API for asynchronous information requests
+  //---------------------------------------------------------------------------
+
+  enum
+  {
+    /**
+     * Fired when a request made using GatherInformationAsync() has been sent
+     * to the servers. Applications can use it to start processing the server
+     * notifications. The call data is a pointer to the request id
+     * (vtkTypeUInt32*).
+     */
+    InformationRequestedEvent = 9870,
+
+    /**
+     * Fired when the reply for a request made using GatherInformationAsync()
+     * has been received. The call data is a pointer to the request id
+     * (vtkTypeUInt32*).
+     */
+    InformationGatheredEvent = 9871
+  };
+
+  /**
+   * Asynchronous variant of GatherInformation(). The request is sent to the
+   * servers and the method returns without waiting for the reply. Returns the
+   * id for the request. Once the reply has been received, \c information is
+   * updated and InformationGatheredEvent is fired. The session keeps a
+   * reference to \c information until then.
+   *
+   * Replies are received when the application processes the server
+   * notifications i.e. when vtkNetworkAccessManager::ProcessEvents() is
+   * called, or in WaitForInformation(). The implementation provided by this
+   * class gathers the information right away and fires
+   * InformationGatheredEvent before returning. Remote sessions prepare the
+   * progress for each request (see vtkPVSession::PrepareProgress()) and clean
+   * it up when the reply is received, GetPendingProgress() returns true in
+   * the meantime.
+   */
+  virtual vtkTypeUInt32 GatherInformationAsync(
+    vtkTypeUInt32 location, vtkPVInformation* information, vtkTypeUInt32 globalid);
+
+  /**
+   * Blocks until the reply for the request with the given id has been
+   * received. Returns false if the connection was lost before that.
+   */
+  virtual bool WaitForInformation(vtkTypeUInt32 requestId);
+
+  /**
+   * Returns the number of requests made using GatherInformationAsync() that
+   * are waiting for a reply.
+   */
+  virtual int GetNumberOfPendingInformationRequests() { return 0; }
+
+  /**
+   * Returns true if the request with the given id, made using
+   * GatherInformationAsync(), is waiting for a reply.
+   */
+  virtual bool GetIsInformationPending(vtkTypeUInt32 vtkNotUsed(requestId)) { return false; }
+
   //---------------------------------------------------------------------------
   // API for Collaboration management
   //---------------------------------------------------------------------------
@@ -281,6 +358,18 @@ protected:
    */
   void UpdateStateHistory(vtkSMMessage* msg);
 
+  /**
+   * Send the messages queued since BeginMessageBatch() to the servers. Called
+   * when the outermost message batch ends. The default implementation does
+   * nothing since builtin sessions do not queue messages.
+   */
+  virtual void FlushPendingMessages() {}
+
+  /**
+   * Returns a new id for a request made using GatherInformationAsync().
+   */
+  vtkTypeUInt32 GetNextInformationRequestId();
+
   vtkSMSessionProxyManager* SessionProxyManager;
   vtkSMStateLocator* StateLocator;
   vtkSMProxyLocator* ProxyLocator;
@@ -293,6 +382,9 @@ private:
 
   // AutoMPI helper class
   static vtkSmartPointer<vtkProcessModuleAutoMPI> AutoMPI;
+
+  int MessageBatchCount;
+  vtkTypeUInt32 LastInformationRequestId;
 };
 
 #endif
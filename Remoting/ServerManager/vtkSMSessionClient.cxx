@@ -40,6 +40,7 @@
 #include "vtkSMServerStateLocator.h"
 #include "vtkSMSessionProxyManager.h"
 #include "vtkSMSettings.h"
+#include "vtkSmartPointer.h"
 #include "vtkSocketCommunicator.h"
 
 #include <sstream>
@@ -47,7 +48,9 @@
 #include <vtksys/RegularExpression.hxx>
 
 #include <assert.h>
+#include <map>
 #include <set>
+#include <vector>
 
 //****************************************************************************/
 //                    Internal Classes and typedefs
@@ -60,7 +63,57 @@ void RMICallback(
   vtkSMSessionClient* self = reinterpret_cast<vtkSMSessionClient*>(localArg);
   self->OnServerNotificationMessageRMI(remoteArg, remoteArgLength);
 }
+
+void InformationReplyRMICallback(
+  void* localArg, void* remoteArg, int remoteArgLength, int vtkNotUsed(remoteProcessId))
+{
+  vtkSMSessionClient* self = reinterpret_cast<vtkSMSessionClient*>(localArg);
+  self->OnInformationReplyRMI(remoteArg, remoteArgLength);
+}
+};
+//****************************************************************************/
+// Messages queued within a message batch for each server.
+class vtkSMSessionClient::vtkPendingMessages
+{
+public:
+  struct QueueType
+  {
+    vtkMultiProcessController* Controller;
+    std::vector<std::vector<unsigned char> > Messages;
+  };
+  std::vector<QueueType> Queues;
+
+  void Enqueue(vtkMultiProcessController* controller, const unsigned char* message, int length)
+  {
+    std::vector<QueueType>::iterator iter = this->Queues.begin();
+    while (iter != this->Queues.end() && iter->Controller != controller)
+    {
+      ++iter;
+    }
+    if (iter == this->Queues.end())
+    {
+      QueueType queue;
+      queue.Controller = controller;
+      iter = this->Queues.insert(this->Queues.end(), queue);
+    }
+    iter->Messages.push_back(std::vector<unsigned char>(message, message + length));
+  }
 };
+
+//****************************************************************************/
+// Requests made using GatherInformationAsync() waiting for a reply.
+class vtkSMSessionClient::vtkPendingInformationRequests
+{
+public:
+  struct RequestType
+  {
+    vtkSmartPointer<vtkPVInformation> Information;
+    // when true, the reply is added to the information gathered locally.
+    bool AddToLocalInformation;
+  };
+  std::map<vtkTypeUInt32, RequestType> Requests;
+};
+
 //****************************************************************************/
 vtkStandardNewMacro(vtkSMSessionClient);
 vtkCxxSetObjectMacro(vtkSMSessionClient, RenderServerController, vtkMultiProcessController);
@@ -92,6 +145,8 @@ vtkSMSessionClient::vtkSMSessionClient()
   // Default value
   this->NoMoreDelete = false;
   this->NotBusy = 0;
+  this->PendingMessages = new vtkPendingMessages();
+  this->PendingInformationRequests = new vtkPendingInformationRequests();
 }
 
 //----------------------------------------------------------------------------
@@ -101,6 +156,13 @@ vtkSMSessionClient::~vtkSMSessionClient()
   {
     this->DataServerController->RemoveAllRMICallbacks(
       vtkPVSessionServer::SERVER_NOTIFICATION_MESSAGE_RMI);
+    this->DataServerController->RemoveAllRMICallbacks(
+      vtkPVSessionServer::REPLY_GATHER_INFORMATION_RMI);
+  }
+  if (this->RenderServerController)
+  {
+    this->RenderServerController->RemoveAllRMICallbacks(
+      vtkPVSessionServer::REPLY_GATHER_INFORMATION_RMI);
   }
   if (this->GetIsAlive())
   {
@@ -120,11 +182,21 @@ vtkSMSessionClient::~vtkSMSessionClient()
 
   delete this->ServerLastInvokeResult;
   this->ServerLastInvokeResult = NULL;
+
+  delete this->PendingMessages;
+  this->PendingMessages = NULL;
+
+  delete this->PendingInformationRequests;
+  this->PendingInformationRequests = NULL;
 }
 
 //----------------------------------------------------------------------------
 vtkMultiProcessController* vtkSMSessionClient::GetController(ServerFlags processType)
 {
+  // the caller may communicate with the server directly, make sure it sees
+  // all the messages sent so far.
+  this->FlushPendingMessages();
+
   switch (processType)
   {
     case CLIENT:
@@ -272,6 +344,8 @@ bool vtkSMSessionClient::Connect(const char* url, int timeout)
       vtkCommand::ErrorEvent, this, &vtkSMSessionClient::OnConnectionLost);
     dcontroller->AddRMICallback(
       &RMICallback, this, vtkPVSessionServer::SERVER_NOTIFICATION_MESSAGE_RMI);
+    dcontroller->AddRMICallback(
+      &InformationReplyRMICallback, this, vtkPVSessionServer::REPLY_GATHER_INFORMATION_RMI);
     dcontroller->Delete();
   }
   if (rcontroller)
@@ -281,6 +355,8 @@ bool vtkSMSessionClient::Connect(const char* url, int timeout)
       vtkCommand::WrongTagEvent, this, &vtkSMSessionClient::OnWrongTagEvent);
     rcontroller->GetCommunicator()->AddObserver(
       vtkCommand::ErrorEvent, this, &vtkSMSessionClient::OnConnectionLost);
+    rcontroller->AddRMICallback(
+      &InformationReplyRMICallback, this, vtkPVSessionServer::REPLY_GATHER_INFORMATION_RMI);
     rcontroller->Delete();
   }
 
@@ -447,6 +523,15 @@ bool vtkSMSessionClient::IsMPIInitialized(vtkTypeUInt32 servers)
 //----------------------------------------------------------------------------
 void vtkSMSessionClient::CloseSession()
 {
+  this->FlushPendingMessages();
+  // replies for pending information requests will never be received, clean up
+  // the progress prepared for each of them.
+  const size_t numberOfPendingRequests = this->PendingInformationRequests->Requests.size();
+  this->PendingInformationRequests->Requests.clear();
+  for (size_t cc = 0; cc < numberOfPendingRequests; ++cc)
+  {
+    this->CleanupPendingProgress();
+  }
   if (this->DataServerController)
   {
     this->DataServerController->TriggerRMIOnAllChildren(vtkPVSessionServer::CLOSE_SESSION);
@@ -517,11 +602,8 @@ void vtkSMSessionClient::PushState(vtkSMMessage* message)
     stream << message->SerializeAsString();
     std::vector<unsigned char> raw_message;
     stream.GetRawData(raw_message);
-    for (int cc = 0; cc < num_controllers; cc++)
-    {
-      controllers[cc]->TriggerRMIOnAllChildren(&raw_message[0],
-        static_cast<int>(raw_message.size()), vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
-    }
+    this->SendMessageToServers(
+      controllers, num_controllers, &raw_message[0], static_cast<int>(raw_message.size()));
   }
 
   if ((location & vtkPVSession::CLIENT) != 0)
@@ -557,8 +639,8 @@ void vtkSMSessionClient::PushState(vtkSMMessage* message)
         stream << msg.SerializeAsString();
         std::vector<unsigned char> raw_message;
         stream.GetRawData(raw_message);
-        this->DataServerController->TriggerRMIOnAllChildren(&raw_message[0],
-          static_cast<int>(raw_message.size()), vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
+        this->SendMessageToServers(&this->DataServerController, 1, &raw_message[0],
+          static_cast<int>(raw_message.size()));
       }
       else if (!remoteObject)
       {
@@ -583,6 +665,7 @@ void vtkSMSessionClient::PushState(vtkSMMessage* message)
 //----------------------------------------------------------------------------
 void vtkSMSessionClient::PullState(vtkSMMessage* message)
 {
+  this->FlushPendingMessages();
   this->StartBusyWork();
   vtkTypeUInt32 location = this->GetRealLocation(message->location());
   message->set_location(location);
@@ -658,18 +741,33 @@ void vtkSMSessionClient::ExecuteStream(
     size_t size;
     cssstream.GetData(&data, &size);
 
-    vtkMultiProcessStream stream;
-    stream << static_cast<int>(vtkPVSessionServer::EXECUTE_STREAM)
-           << static_cast<int>(ignore_errors) << static_cast<int>(size);
-    std::vector<unsigned char> raw_message;
-    stream.GetRawData(raw_message);
-
-    for (int cc = 0; cc < num_controllers; cc++)
+    if (this->GetInMessageBatch())
     {
-      controllers[cc]->TriggerRMIOnAllChildren(&raw_message[0],
-        static_cast<int>(raw_message.size()), vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
-      controllers[cc]->Send(
-        data, static_cast<int>(size), 1, vtkPVSessionServer::EXECUTE_STREAM_TAG);
+      // the stream data is made part of the message so that it can be queued.
+      vtkMultiProcessStream stream;
+      stream << static_cast<int>(vtkPVSessionServer::EXECUTE_STREAM_INLINE)
+             << static_cast<int>(ignore_errors);
+      stream.Push(const_cast<unsigned char*>(data), static_cast<unsigned int>(size));
+      std::vector<unsigned char> raw_message;
+      stream.GetRawData(raw_message);
+      this->SendMessageToServers(
+        controllers, num_controllers, &raw_message[0], static_cast<int>(raw_message.size()));
+    }
+    else
+    {
+      vtkMultiProcessStream stream;
+      stream << static_cast<int>(vtkPVSessionServer::EXECUTE_STREAM)
+             << static_cast<int>(ignore_errors) << static_cast<int>(size);
+      std::vector<unsigned char> raw_message;
+      stream.GetRawData(raw_message);
+
+      for (int cc = 0; cc < num_controllers; cc++)
+      {
+        controllers[cc]->TriggerRMIOnAllChildren(&raw_message[0],
+          static_cast<int>(raw_message.size()), vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
+        controllers[cc]->Send(
+          data, static_cast<int>(size), 1, vtkPVSessionServer::EXECUTE_STREAM_TAG);
+      }
     }
   }
 
@@ -682,6 +780,7 @@ void vtkSMSessionClient::ExecuteStream(
 //----------------------------------------------------------------------------
 const vtkClientServerStream& vtkSMSessionClient::GetLastResult(vtkTypeUInt32 location)
 {
+  this->FlushPendingMessages();
   this->StartBusyWork();
   location = this->GetRealLocation(location);
 
@@ -730,21 +829,9 @@ const vtkClientServerStream& vtkSMSessionClient::GetLastResult(vtkTypeUInt32 loc
 bool vtkSMSessionClient::GatherInformation(
   vtkTypeUInt32 location, vtkPVInformation* information, vtkTypeUInt32 globalid)
 {
+  this->FlushPendingMessages();
   this->StartBusyWork();
-  if (this->RenderServerController == NULL)
-  {
-    // re-route all render-server messages to data-server.
-    if (location & vtkPVSession::RENDER_SERVER)
-    {
-      location |= vtkPVSession::DATA_SERVER;
-      location &= ~vtkPVSession::RENDER_SERVER;
-    }
-    if (location & vtkPVSession::RENDER_SERVER_ROOT)
-    {
-      location |= vtkPVSession::DATA_SERVER_ROOT;
-      location &= ~vtkPVSession::RENDER_SERVER_ROOT;
-    }
-  }
+  location = this->GetInformationLocation(location);
 
   bool add_local_info = false;
   if ((location & vtkPVSession::CLIENT) != 0)
@@ -765,21 +852,7 @@ bool vtkSMSessionClient::GatherInformation(
   std::vector<unsigned char> raw_message;
   stream.GetRawData(raw_message);
 
-  vtkMultiProcessController* controller = NULL;
-
-  if ((location & vtkPVSession::DATA_SERVER) != 0 ||
-    (location & vtkPVSession::DATA_SERVER_ROOT) != 0)
-  {
-    controller = this->DataServerController;
-  }
-
-  else if (this->RenderServerController != NULL &&
-    ((location & vtkPVSession::RENDER_SERVER) != 0 ||
-             (location & vtkPVSession::RENDER_SERVER_ROOT) != 0))
-  {
-    controller = this->RenderServerController;
-  }
-
+  vtkMultiProcessController* controller = this->GetInformationController(location);
   if (controller)
   {
     controller->TriggerRMIOnAllChildren(&raw_message[0], static_cast<int>(raw_message.size()),
@@ -821,6 +894,169 @@ bool vtkSMSessionClient::GatherInformation(
   return false;
 }
 
+//----------------------------------------------------------------------------
+vtkTypeUInt32 vtkSMSessionClient::GatherInformationAsync(
+  vtkTypeUInt32 location, vtkPVInformation* information, vtkTypeUInt32 globalid)
+{
+  this->FlushPendingMessages();
+  location = this->GetInformationLocation(location);
+  vtkTypeUInt32 requestId = this->GetNextInformationRequestId();
+
+  bool add_local_info = false;
+  if ((location & vtkPVSession::CLIENT) != 0)
+  {
+    this->vtkSMSession::GatherInformation(location, information, globalid);
+    if (information->GetRootOnly())
+    {
+      this->InvokeEvent(vtkSMSession::InformationGatheredEvent, &requestId);
+      return requestId;
+    }
+    add_local_info = true;
+  }
+
+  vtkMultiProcessController* controller = this->GetInformationController(location);
+  if (!controller)
+  {
+    // nothing to request from the servers.
+    this->InvokeEvent(vtkSMSession::InformationGatheredEvent, &requestId);
+    return requestId;
+  }
+
+  // the progress is prepared like for the synchronous gathers, the reply
+  // cleans it up. The stream preparing it may be batched, flush it before the
+  // request.
+  this->PrepareProgress();
+  this->FlushPendingMessages();
+
+  vtkMultiProcessStream stream;
+  stream << static_cast<int>(vtkPVSessionServer::GATHER_INFORMATION_ASYNC) << requestId
+         << location << information->GetClassName() << globalid;
+  information->CopyParametersToStream(stream);
+  std::vector<unsigned char> raw_message;
+  stream.GetRawData(raw_message);
+
+  vtkPendingInformationRequests::RequestType& request =
+    this->PendingInformationRequests->Requests[requestId];
+  request.Information = information;
+  request.AddToLocalInformation = add_local_info;
+
+  controller->TriggerRMIOnAllChildren(&raw_message[0], static_cast<int>(raw_message.size()),
+    vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
+  this->InvokeEvent(vtkSMSession::InformationRequestedEvent, &requestId);
+  return requestId;
+}
+
+//----------------------------------------------------------------------------
+bool vtkSMSessionClient::WaitForInformation(vtkTypeUInt32 requestId)
+{
+  vtkNetworkAccessManager* nam = vtkProcessModule::GetProcessModule()->GetNetworkAccessManager();
+  while (this->GetIsInformationPending(requestId))
+  {
+    if (nam->ProcessEvents(100) == -1 || !this->GetIsAlive())
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+int vtkSMSessionClient::GetNumberOfPendingInformationRequests()
+{
+  return static_cast<int>(this->PendingInformationRequests->Requests.size());
+}
+
+//----------------------------------------------------------------------------
+bool vtkSMSessionClient::GetIsInformationPending(vtkTypeUInt32 requestId)
+{
+  return this->PendingInformationRequests->Requests.find(requestId) !=
+    this->PendingInformationRequests->Requests.end();
+}
+
+//----------------------------------------------------------------------------
+void vtkSMSessionClient::OnInformationReplyRMI(void* message, int message_length)
+{
+  vtkMultiProcessStream stream;
+  stream.SetRawData(reinterpret_cast<const unsigned char*>(message), message_length);
+
+  vtkTypeUInt32 requestId;
+  int success;
+  stream >> requestId >> success;
+
+  auto iter = this->PendingInformationRequests->Requests.find(requestId);
+  if (iter == this->PendingInformationRequests->Requests.end())
+  {
+    // the request was discarded e.g. when the session was closed.
+    return;
+  }
+  vtkPendingInformationRequests::RequestType request = iter->second;
+  this->PendingInformationRequests->Requests.erase(iter);
+
+  if (success)
+  {
+    unsigned char* data = nullptr;
+    unsigned int size = 0;
+    stream.Pop(data, size);
+    vtkClientServerStream csstream;
+    csstream.SetData(data, size);
+    if (request.AddToLocalInformation)
+    {
+      vtkSmartPointer<vtkPVInformation> tempInfo;
+      tempInfo.TakeReference(request.Information->NewInstance());
+      tempInfo->CopyFromStream(&csstream);
+      request.Information->AddInformation(tempInfo);
+    }
+    else
+    {
+      request.Information->CopyFromStream(&csstream);
+    }
+    delete[] data;
+  }
+  else
+  {
+    vtkErrorMacro("Server failed to gather information.");
+  }
+  this->CleanupPendingProgress();
+  this->InvokeEvent(vtkSMSession::InformationGatheredEvent, &requestId);
+}
+
+//----------------------------------------------------------------------------
+vtkTypeUInt32 vtkSMSessionClient::GetInformationLocation(vtkTypeUInt32 location)
+{
+  if (this->RenderServerController == NULL)
+  {
+    // re-route all render-server messages to data-server.
+    if (location & vtkPVSession::RENDER_SERVER)
+    {
+      location |= vtkPVSession::DATA_SERVER;
+      location &= ~vtkPVSession::RENDER_SERVER;
+    }
+    if (location & vtkPVSession::RENDER_SERVER_ROOT)
+    {
+      location |= vtkPVSession::DATA_SERVER_ROOT;
+      location &= ~vtkPVSession::RENDER_SERVER_ROOT;
+    }
+  }
+  return location;
+}
+
+//----------------------------------------------------------------------------
+vtkMultiProcessController* vtkSMSessionClient::GetInformationController(vtkTypeUInt32 location)
+{
+  if ((location & vtkPVSession::DATA_SERVER) != 0 ||
+    (location & vtkPVSession::DATA_SERVER_ROOT) != 0)
+  {
+    return this->DataServerController;
+  }
+  else if (this->RenderServerController != NULL &&
+    ((location & vtkPVSession::RENDER_SERVER) != 0 ||
+             (location & vtkPVSession::RENDER_SERVER_ROOT) != 0))
+  {
+    return this->RenderServerController;
+  }
+  return NULL;
+}
+
 //----------------------------------------------------------------------------
 void vtkSMSessionClient::UnRegisterSIObject(vtkSMMessage* message)
 {
@@ -850,11 +1086,8 @@ void vtkSMSessionClient::UnRegisterSIObject(vtkSMMessage* message)
     stream << message->SerializeAsString();
     std::vector<unsigned char> raw_message;
     stream.GetRawData(raw_message);
-    for (int cc = 0; cc < num_controllers; cc++)
-    {
-      controllers[cc]->TriggerRMIOnAllChildren(&raw_message[0],
-        static_cast<int>(raw_message.size()), vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
-    }
+    this->SendMessageToServers(
+      controllers, num_controllers, &raw_message[0], static_cast<int>(raw_message.size()));
   }
 
   if ((location & vtkPVSession::CLIENT) != 0)
@@ -891,14 +1124,8 @@ void vtkSMSessionClient::RegisterSIObject(vtkSMMessage* message)
     stream << message->SerializeAsString();
     std::vector<unsigned char> raw_message;
     stream.GetRawData(raw_message);
-    for (int cc = 0; cc < num_controllers; cc++)
-    {
-      if (controllers[cc] != NULL)
-      {
-        controllers[cc]->TriggerRMIOnAllChildren(&raw_message[0],
-          static_cast<int>(raw_message.size()), vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
-      }
-    }
+    this->SendMessageToServers(
+      controllers, num_controllers, &raw_message[0], static_cast<int>(raw_message.size()));
   }
 
   if ((location & vtkPVSession::CLIENT) != 0)
@@ -907,6 +1134,63 @@ void vtkSMSessionClient::RegisterSIObject(vtkSMMessage* message)
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkSMSessionClient::SendMessageToServers(vtkMultiProcessController* controllers[],
+  int num_controllers, const unsigned char* message, int message_length)
+{
+  for (int cc = 0; cc < num_controllers; cc++)
+  {
+    if (controllers[cc] == NULL)
+    {
+      continue;
+    }
+    if (this->GetInMessageBatch())
+    {
+      this->PendingMessages->Enqueue(controllers[cc], message, message_length);
+    }
+    else
+    {
+      controllers[cc]->TriggerRMIOnAllChildren(const_cast<unsigned char*>(message),
+        message_length, vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkSMSessionClient::FlushPendingMessages()
+{
+  if (this->PendingMessages->Queues.empty())
+  {
+    return;
+  }
+
+  // clear the queues first, sending may cause more messages to be flushed.
+  std::vector<vtkPendingMessages::QueueType> queues;
+  queues.swap(this->PendingMessages->Queues);
+  for (auto& queue : queues)
+  {
+    if (queue.Messages.size() == 1)
+    {
+      std::vector<unsigned char>& raw_message = queue.Messages[0];
+      queue.Controller->TriggerRMIOnAllChildren(&raw_message[0],
+        static_cast<int>(raw_message.size()), vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
+      continue;
+    }
+
+    vtkMultiProcessStream stream;
+    stream << static_cast<int>(vtkPVSessionServer::BATCH)
+           << static_cast<int>(queue.Messages.size());
+    for (auto& message : queue.Messages)
+    {
+      stream.Push(&message[0], static_cast<unsigned int>(message.size()));
+    }
+    std::vector<unsigned char> raw_message;
+    stream.GetRawData(raw_message);
+    queue.Controller->TriggerRMIOnAllChildren(&raw_message[0],
+      static_cast<int>(raw_message.size()), vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
+  }
+}
+
 //----------------------------------------------------------------------------
 void vtkSMSessionClient::PrintSelf(ostream& os, vtkIndent indent)
 {
@@ -961,18 +1245,20 @@ void vtkSMSessionClient::OnServerNotificationMessageRMI(void* message, int messa
 }
 //-----------------------------------------------------------------------------
 bool vtkSMSessionClient::OnWrongTagEvent(
-  vtkObject* vtkNotUsed(obj), unsigned long vtkNotUsed(event), void* calldata)
+  vtkObject* obj, unsigned long vtkNotUsed(event), void* calldata)
 {
   int tag = -1;
   const char* data = reinterpret_cast<const char*>(calldata);
   const char* ptr = data;
   memcpy(&tag, ptr, sizeof(tag));
 
-  // Just buffer RMI_TAG's
-  if (tag == vtkMultiProcessController::RMI_TAG || tag == vtkMultiProcessController::RMI_ARG_TAG)
+  // Just buffer RMI_TAG's. These may arrive from the render-server as well
+  // e.g. replies to GatherInformationAsync().
+  vtkSocketCommunicator* communicator = vtkSocketCommunicator::SafeDownCast(obj);
+  if (communicator &&
+    (tag == vtkMultiProcessController::RMI_TAG || tag == vtkMultiProcessController::RMI_ARG_TAG))
   {
-    vtkSocketCommunicator::SafeDownCast(this->DataServerController->GetCommunicator())
-      ->BufferCurrentMessage();
+    communicator->BufferCurrentMessage();
   }
   else
   {
@@ -132,6 +132,18 @@ public:
   bool GatherInformation(
     vtkTypeUInt32 location, vtkPVInformation* information, vtkTypeUInt32 globalid) override;
 
+  //@{
+  /**
+   * Overridden to send the request to the servers without waiting for the
+   * reply. The reply is processed in OnInformationReplyRMI().
+   */
+  vtkTypeUInt32 GatherInformationAsync(
+    vtkTypeUInt32 location, vtkPVInformation* information, vtkTypeUInt32 globalid) override;
+  bool WaitForInformation(vtkTypeUInt32 requestId) override;
+  int GetNumberOfPendingInformationRequests() override;
+  bool GetIsInformationPending(vtkTypeUInt32 requestId) override;
+  //@}
+
   /**
    * Returns the number of processes on the given server/s. If more than 1
    * server is identified, than it returns the maximum number of processes e.g.
@@ -213,6 +225,7 @@ public:
   vtkTypeUInt32 GetNextChunkGlobalUniqueIdentifier(vtkTypeUInt32 chunkSize) override;
 
   void OnServerNotificationMessageRMI(void* message, int message_length);
+  void OnInformationReplyRMI(void* message, int message_length);
 
 protected:
   vtkSMSessionClient();
@@ -239,6 +252,34 @@ protected:
    */
   vtkTypeUInt32 GetRealLocation(vtkTypeUInt32);
 
+  /**
+   * Translates the location for a GatherInformation request, render-server
+   * requests are sent to the data-server if no separate render-server exists.
+   */
+  vtkTypeUInt32 GetInformationLocation(vtkTypeUInt32 location);
+
+  /**
+   * Returns the controller to send a GatherInformation request for the
+   * location to, if any.
+   */
+  vtkMultiProcessController* GetInformationController(vtkTypeUInt32 location);
+
+  /**
+   * Triggers the client-server message RMI with the given message on the
+   * controllers. Within a message batch, the message is queued instead and
+   * sent by FlushPendingMessages().
+   */
+  void SendMessageToServers(vtkMultiProcessController* controllers[], int num_controllers,
+    const unsigned char* message, int message_length);
+
+  /**
+   * Sends the queued messages to the servers, all messages queued for a
+   * server are sent as a single message. This is called when the outermost
+   * message batch ends and before any call that needs a reply from the
+   * servers.
+   */
+  void FlushPendingMessages() override;
+
   // Both maybe the same when connected to pvserver.
   vtkMultiProcessController* RenderServerController;
   vtkMultiProcessController* DataServerController;
@@ -279,6 +320,11 @@ private:
 
   int NotBusy;
   vtkTypeUInt32 LastGlobalID;
+
+  class vtkPendingMessages;
+  vtkPendingMessages* PendingMessages;
+  class vtkPendingInformationRequests;
+  vtkPendingInformationRequests* PendingInformationRequests;
   vtkTypeUInt32 LastGlobalIDAvailable;
 };
 
@@ -988,6 +988,24 @@ void vtkSMSessionProxyManager::UpdateProxyInOrder(vtkSMProxy* proxy)
   this->UpdateInputProxies = 0;
 }
 
+//---------------------------------------------------------------------------
+void vtkSMSessionProxyManager::BeginMessageBatch()
+{
+  if (vtkSMSession* session = this->GetSession())
+  {
+    session->BeginMessageBatch();
+  }
+}
+
+//---------------------------------------------------------------------------
+void vtkSMSessionProxyManager::EndMessageBatch()
+{
+  if (vtkSMSession* session = this->GetSession())
+  {
+    session->EndMessageBatch();
+  }
+}
+
 //---------------------------------------------------------------------------
 int vtkSMSessionProxyManager::GetNumberOfLinks()
 {
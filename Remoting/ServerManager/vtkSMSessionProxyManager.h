@@ -328,6 +328,20 @@ public:
   void UpdateProxyInOrder(vtkSMProxy* proxy);
   //@}
 
+  //@{
+  /**
+   * Begin/end a batch of proxy creations and property pushes. The messages
+   * that these send to the servers are queued and sent together when the
+   * outermost batch ends, or earlier when a reply from the servers is
+   * needed, reducing the number of round trips. Calls can be nested, every
+   * BeginMessageBatch() must be matched by an EndMessageBatch().
+   * vtkSMStateLoader uses this when loading a state.
+   * @sa vtkSMSession::BeginMessageBatch
+   */
+  void BeginMessageBatch();
+  void EndMessageBatch();
+  //@}
+
   /**
    * Get the number of registered links with the server manager.
    */
@@ -540,7 +540,11 @@ int vtkSMStateLoader::LoadState(vtkPVXMLElement* elem, bool keepOriginalId)
   }
 
   this->ProxyLocator->SetDeserializer(this);
+  // send the proxy creations and property pushes in as few messages as
+  // possible, this makes a big difference on high-latency connections.
+  pxm->BeginMessageBatch();
   int ret = this->LoadStateInternal(elem);
+  pxm->EndMessageBatch();
   this->ProxyLocator->SetDeserializer(0);
 
   // BUG #10650. When animation scene time ranges are read from the state, they
@@ -0,0 +1,132 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestSpreadSheetViewCache.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Tests the blocks cache of vtkSpreadSheetView: requests served from the cache
+// are counted as hits and prefetching follows the scrolling direction.
+
+#include "vtkInitializationHelper.h"
+#include "vtkNew.h"
+#include "vtkProcessModule.h"
+#include "vtkSMParaViewPipelineControllerWithRendering.h"
+#include "vtkSMSession.h"
+#include "vtkSMSessionProxyManager.h"
+#include "vtkSMSourceProxy.h"
+#include "vtkSMViewProxy.h"
+#include "vtkSmartPointer.h"
+#include "vtkSpreadSheetView.h"
+
+namespace
+{
+bool CheckStatistics(vtkSpreadSheetView* view, vtkIdType hits, vtkIdType misses,
+  vtkIdType prefetched, vtkIdType prefetchHits)
+{
+  if (view->GetNumberOfCacheHits() != hits || view->GetNumberOfCacheMisses() != misses ||
+    view->GetNumberOfPrefetchedBlocks() != prefetched ||
+    view->GetNumberOfPrefetchHits() != prefetchHits)
+  {
+    cerr << "ERROR: unexpected cache statistics (hits: " << view->GetNumberOfCacheHits()
+         << ", misses: " << view->GetNumberOfCacheMisses()
+         << ", prefetched: " << view->GetNumberOfPrefetchedBlocks()
+         << ", prefetch hits: " << view->GetNumberOfPrefetchHits() << ")." << endl;
+    return false;
+  }
+  return true;
+}
+
+int PrefetchAll(vtkSpreadSheetView* view)
+{
+  int count = 0;
+  while (view->PrefetchBlock())
+  {
+    ++count;
+  }
+  return count;
+}
+}
+
+int TestSpreadSheetViewCache(int, char* argv[])
+{
+  vtkInitializationHelper::Initialize(argv[0], vtkProcessModule::PROCESS_CLIENT);
+
+  int exitCode = EXIT_SUCCESS;
+  {
+    vtkNew<vtkSMParaViewPipelineControllerWithRendering> controller;
+    vtkNew<vtkSMSession> session;
+    vtkProcessModule::GetProcessModule()->RegisterSession(session);
+    controller->InitializeSession(session);
+    vtkSMSessionProxyManager* pxm = session->GetSessionProxyManager();
+
+    vtkSmartPointer<vtkSMViewProxy> view;
+    view.TakeReference(vtkSMViewProxy::SafeDownCast(pxm->NewProxy("views", "SpreadSheetView")));
+    controller->InitializeProxy(view);
+    view->UpdateVTKObjects();
+    controller->RegisterViewProxy(view);
+
+    // 9261 points, i.e. 10 blocks of 1024 rows.
+    vtkSmartPointer<vtkSMSourceProxy> wavelet;
+    wavelet.TakeReference(
+      vtkSMSourceProxy::SafeDownCast(pxm->NewProxy("sources", "RTAnalyticSource")));
+    controller->InitializeProxy(wavelet);
+    wavelet->UpdateVTKObjects();
+    controller->RegisterPipelineProxy(wavelet);
+
+    controller->Show(wavelet, 0, view);
+    view->Update();
+    view->StillRender();
+
+    auto ssview = vtkSpreadSheetView::SafeDownCast(view->GetClientSideObject());
+    ssview->ResetCacheStatistics();
+
+    // first request fetches the block, the next one is a hit.
+    ssview->GetValue(0, 0);
+    ssview->GetValue(10, 0);
+    if (!CheckStatistics(ssview, 1, 1, 0, 0))
+    {
+      exitCode = EXIT_FAILURE;
+    }
+
+    // only the blocks following the first one can be prefetched.
+    if (PrefetchAll(ssview) != 2 || !ssview->IsAvailable(2048) || ssview->IsAvailable(3072))
+    {
+      cerr << "ERROR: expected blocks 1 and 2 to be prefetched." << endl;
+      exitCode = EXIT_FAILURE;
+    }
+    ssview->GetValue(1024, 0);
+    if (!CheckStatistics(ssview, 2, 1, 2, 1))
+    {
+      exitCode = EXIT_FAILURE;
+    }
+
+    // scrolling up prefetches the blocks above first, then the ones below.
+    ssview->GetValue(6 * 1024, 0);
+    ssview->GetValue(5 * 1024, 0);
+    if (PrefetchAll(ssview) != 3 || !ssview->IsAvailable(3 * 1024) ||
+      !ssview->IsAvailable(4 * 1024) || !ssview->IsAvailable(7 * 1024) ||
+      ssview->IsAvailable(8 * 1024))
+    {
+      cerr << "ERROR: expected blocks 4, 3 and 7 to be prefetched." << endl;
+      exitCode = EXIT_FAILURE;
+    }
+    if (!CheckStatistics(ssview, 2, 3, 5, 1))
+    {
+      exitCode = EXIT_FAILURE;
+    }
+
+    controller->UnRegisterProxy(wavelet);
+    controller->UnRegisterProxy(view);
+    vtkProcessModule::GetProcessModule()->UnRegisterSession(session);
+  }
+  vtkInitializationHelper::Finalize();
+  return exitCode;
+}
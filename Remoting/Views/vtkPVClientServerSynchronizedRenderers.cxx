@@ -20,9 +20,7 @@
 #include "vtkObjectFactory.h"
 #include "vtkOpenGLRenderer.h"
 #include "vtkPVConfig.h"
-#include "vtkSquirtCompressor.h"
 #include "vtkUnsignedCharArray.h"
-#include "vtkZlibImageCompressor.h"
 #if VTK_MODULE_ENABLE_ParaView_nvpipe
 #include "vtkNvPipeCompressor.h"
 #endif
@@ -160,19 +158,7 @@ void vtkPVClientServerSynchronizedRenderers::ConfigureCompressor(const char* str
   if (this->Compressor == nullptr || !this->Compressor->IsA(className.c_str()))
   {
     vtkImageCompressor* comp = 0;
-    if (className == "vtkSquirtCompressor")
-    {
-      comp = vtkSquirtCompressor::New();
-    }
-    else if (className == "vtkZlibImageCompressor")
-    {
-      comp = vtkZlibImageCompressor::New();
-    }
-    else if (className == "vtkLZ4Compressor")
-    {
-      comp = vtkLZ4Compressor::New();
-    }
-    else if (className == "vtkNvPipeCompressor" && this->NVPipeSupport)
+    if (className == "vtkNvPipeCompressor" && this->NVPipeSupport)
     {
 #if VTK_MODULE_ENABLE_ParaView_nvpipe
       comp = vtkNvPipeCompressor::New();
@@ -194,6 +180,10 @@ void vtkPVClientServerSynchronizedRenderers::ConfigureCompressor(const char* str
       this->SetCompressor(0);
       return;
     }
+    else
+    {
+      comp = vtkImageCompressor::NewCompressor(className.c_str());
+    }
 
     if (comp == 0)
     {
@@ -261,6 +261,11 @@ void vtkPVDataDeliveryManager::Deliver(int low_res, unsigned int size, unsigned
       }
       vtkVLogScopeF(
         PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "move-data: %s", repr->GetLogName().c_str());
+      // the memory size walks composite datasets, only compute it when recording.
+      vtkPVLogger::EventScope eventScope(vtkPVLogger::DATA_MOVEMENT, repr->GetLogName().c_str(),
+        vtkPVLogger::GetEventRecording()
+          ? static_cast<vtkTypeInt64>(data->GetActualMemorySize()) * 1024
+          : -1);
       this->MoveData(repr, low_res != 0, port);
     }
   }
@@ -1396,6 +1396,7 @@ void vtkPVRenderView::UpdateLOD()
 void vtkPVRenderView::StillRender()
 {
   vtkVLogScopeF(PARAVIEW_LOG_RENDERING_VERBOSITY(), "%s: StillRender", this->GetLogName().c_str());
+  PARAVIEW_LOG_EVENT_SCOPE(RENDERING, "still render");
 
   vtkTimerLog::MarkStartEvent("Still Render");
   this->GetRenderWindow()->SetDesiredUpdateRate(0.002);
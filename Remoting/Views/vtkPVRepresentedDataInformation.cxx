@@ -43,6 +43,14 @@ void vtkPVRepresentedDataInformation::CopyFromObject(vtkObject* object)
   }
 }
 
+//----------------------------------------------------------------------------
+std::string vtkPVRepresentedDataInformation::GetCacheKey(vtkObject* object)
+{
+  vtkPVDataRepresentation* repr = vtkPVDataRepresentation::SafeDownCast(object);
+  vtkDataObject* dobj = repr ? repr->GetRenderedDataObject(0) : nullptr;
+  return dobj ? this->Superclass::GetCacheKey(dobj) : std::string();
+}
+
 //----------------------------------------------------------------------------
 void vtkPVRepresentedDataInformation::PrintSelf(ostream& os, vtkIndent indent)
 {
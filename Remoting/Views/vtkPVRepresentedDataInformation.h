@@ -37,6 +37,11 @@ public:
    */
   void CopyFromObject(vtkObject*) override;
 
+  /**
+   * Returns the cache key for the rendered data object.
+   */
+  std::string GetCacheKey(vtkObject*) override;
+
 protected:
   vtkPVRepresentedDataInformation();
   ~vtkPVRepresentedDataInformation() override;
@@ -446,6 +446,7 @@ void vtkPVView::CleanupAfterScreenshot()
 void vtkPVView::Update()
 {
   vtkVLogScopeF(PARAVIEW_LOG_RENDERING_VERBOSITY(), "%s: update view", this->GetLogName().c_str());
+  PARAVIEW_LOG_EVENT_SCOPE(RENDERING, "update view");
 
   // Propagate update time.
   const int num_reprs = this->GetNumberOfRepresentations();
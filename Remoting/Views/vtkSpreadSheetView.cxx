@@ -48,9 +48,11 @@
 #include <algorithm>
 #include <cstring>
 #include <iterator>
+#include <list>
 #include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace
@@ -329,16 +331,50 @@ class vtkSpreadSheetView::vtkInternals
   {
   public:
     vtkSmartPointer<vtkTable> Dataobject;
-    vtkTimeStamp RecentUseTime;
+    std::list<vtkIdType>::iterator RecentUse;
+    unsigned long MemorySize; // in KiB
+    bool Prefetched;
   };
 
-  typedef std::map<vtkIdType, CacheInfo> CacheType;
+  typedef std::unordered_map<vtkIdType, CacheInfo> CacheType;
   CacheType CachedBlocks;
 
+  // Cached block ids, the most recently used first.
+  std::list<vtkIdType> RecentlyUsedBlocks;
+  unsigned long CachedMemorySize = 0; // in KiB
+
+  void RemoveFromCache(CacheType::iterator iter)
+  {
+    this->CachedMemorySize -= iter->second.MemorySize;
+    this->RecentlyUsedBlocks.erase(iter->second.RecentUse);
+    this->CachedBlocks.erase(iter);
+  }
+
+  /**
+   * Returns true if a block using `size` KiB can be cached without exceeding
+   * `maxSize` and without releasing any of the blocks in [first, last].
+   */
+  bool CanCacheWithout(vtkIdType first, vtkIdType last, unsigned long size, unsigned long maxSize)
+  {
+    unsigned long total = this->CachedMemorySize + size;
+    for (auto iter = this->RecentlyUsedBlocks.rbegin();
+         total > maxSize && iter != this->RecentlyUsedBlocks.rend(); ++iter)
+    {
+      if (*iter >= first && *iter <= last)
+      {
+        return false;
+      }
+      total -= this->CachedBlocks[*iter].MemorySize;
+    }
+    return total <= maxSize;
+  }
+
 public:
   void ClearCache()
   {
     this->CachedBlocks.clear();
+    this->RecentlyUsedBlocks.clear();
+    this->CachedMemorySize = 0;
     this->ColumnMetaData.clear();
     this->ColumnIndexMap.clear();
   }
@@ -388,34 +424,86 @@ public:
     CacheType::iterator iter = this->CachedBlocks.find(blockId);
     if (iter != this->CachedBlocks.end())
     {
-      iter->second.RecentUseTime.Modified();
+      this->RecentlyUsedBlocks.splice(
+        this->RecentlyUsedBlocks.begin(), this->RecentlyUsedBlocks, iter->second.RecentUse);
       this->MostRecentlyAccessedBlock = blockId;
       return iter->second.Dataobject.GetPointer();
     }
     return NULL;
   }
 
-  vtkTable* AddToCache(vtkIdType blockId, vtkTable* data, vtkIdType max)
+  /**
+   * Called when a block is requested to show its rows. Keeps track of the
+   * scrolling direction and returns the cached block, if any. `prefetched` is
+   * set to true if the block was cached by prefetching and not requested
+   * before.
+   */
+  vtkTable* RequestBlock(vtkIdType blockId, bool& prefetched)
   {
-    CacheType::iterator iter = this->CachedBlocks.find(blockId);
-    if (iter != this->CachedBlocks.end())
+    if (this->LastRequestedBlock >= 0 && blockId != this->LastRequestedBlock)
+    {
+      this->ScrollDirection = blockId > this->LastRequestedBlock ? 1 : -1;
+    }
+    this->LastRequestedBlock = blockId;
+
+    prefetched = false;
+    vtkTable* table = this->GetDataObject(blockId);
+    if (table)
+    {
+      CacheInfo& info = this->CachedBlocks[blockId];
+      prefetched = info.Prefetched;
+      info.Prefetched = false;
+    }
+    return table;
+  }
+
+  /**
+   * Returns the next block to prefetch, or -1 if there is none. These are the
+   * `count` blocks following the last requested block in the scrolling
+   * direction, then the `count` blocks preceding it. A block is only
+   * prefetched if the cache can hold it without releasing any of these.
+   */
+  vtkIdType GetBlockToPrefetch(vtkIdType numberOfBlocks, int count, unsigned long maxSize)
+  {
+    const vtkIdType current = this->LastRequestedBlock;
+    auto currentIter = this->CachedBlocks.find(current);
+    if (current < 0 || currentIter == this->CachedBlocks.end())
     {
-      this->CachedBlocks.erase(iter);
+      return -1;
     }
 
-    if (static_cast<vtkIdType>(this->CachedBlocks.size()) == max)
+    for (int side = 0; side < 2; ++side)
     {
-      // remove least-recent-used block.
-      iter = this->CachedBlocks.begin();
-      CacheType::iterator iterToRemove = this->CachedBlocks.begin();
-      for (; iter != this->CachedBlocks.end(); ++iter)
+      const vtkIdType direction = side == 0 ? this->ScrollDirection : -this->ScrollDirection;
+      for (int cc = 1; cc <= count; ++cc)
       {
-        if (iterToRemove->second.RecentUseTime > iter->second.RecentUseTime)
+        const vtkIdType blockId = current + direction * cc;
+        if (blockId < 0 || blockId >= numberOfBlocks ||
+          this->CachedBlocks.find(blockId) != this->CachedBlocks.end())
         {
-          iterToRemove = iter;
+          continue;
         }
+        // blocks have about the same size, use the current one as estimate.
+        return this->CanCacheWithout(
+                 current - count, current + count, currentIter->second.MemorySize, maxSize)
+          ? blockId
+          : -1;
       }
-      this->CachedBlocks.erase(iterToRemove);
+    }
+    return -1;
+  }
+
+  /**
+   * Add a block to the cache, releasing the least recently used blocks when
+   * the blocks use more than `maxSize` KiB. The block just added is never
+   * released.
+   */
+  vtkTable* AddToCache(vtkIdType blockId, vtkTable* data, unsigned long maxSize, bool prefetched)
+  {
+    CacheType::iterator iter = this->CachedBlocks.find(blockId);
+    if (iter != this->CachedBlocks.end())
+    {
+      this->RemoveFromCache(iter);
     }
 
     CacheInfo info;
@@ -446,9 +534,24 @@ public:
     }
     info.Dataobject = clone;
     clone->FastDelete();
-    info.RecentUseTime.Modified();
+    info.MemorySize = clone->GetActualMemorySize();
+    info.Prefetched = prefetched;
+
+    // release least-recent-used blocks.
+    while (!this->RecentlyUsedBlocks.empty() &&
+      this->CachedMemorySize + info.MemorySize > maxSize)
+    {
+      this->RemoveFromCache(this->CachedBlocks.find(this->RecentlyUsedBlocks.back()));
+    }
+
+    this->RecentlyUsedBlocks.push_front(blockId);
+    info.RecentUse = this->RecentlyUsedBlocks.begin();
+    this->CachedMemorySize += info.MemorySize;
     this->CachedBlocks[blockId] = info;
-    this->MostRecentlyAccessedBlock = blockId;
+    if (!prefetched)
+    {
+      this->MostRecentlyAccessedBlock = blockId;
+    }
     if (this->CachedBlocks.size() == 1)
     {
       this->UpdateColumnMetaData(clone);
@@ -480,6 +583,8 @@ public:
   }
 
   vtkIdType MostRecentlyAccessedBlock;
+  vtkIdType LastRequestedBlock = -1;
+  vtkIdType ScrollDirection = 1;
   vtkWeakPointer<vtkSpreadSheetRepresentation> ActiveRepresentation;
   vtkCommand* Observer;
 
@@ -581,6 +686,12 @@ vtkSpreadSheetView::vtkSpreadSheetView()
 
   this->Internals = new vtkInternals();
   this->Internals->MostRecentlyAccessedBlock = -1;
+  this->CacheSize = 64;
+  this->NumberOfBlocksToPrefetch = 2;
+  this->NumberOfCacheHits = 0;
+  this->NumberOfCacheMisses = 0;
+  this->NumberOfPrefetchedBlocks = 0;
+  this->NumberOfPrefetchHits = 0;
 
   this->Internals->Observer =
     vtkMakeMemberFunctionCommand(*this, &vtkSpreadSheetView::OnRepresentationUpdated);
@@ -720,6 +831,12 @@ bool vtkSpreadSheetView::IsColumnInternal(const char* columnName)
 void vtkSpreadSheetView::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "CacheSize: " << this->CacheSize << endl;
+  os << indent << "NumberOfBlocksToPrefetch: " << this->NumberOfBlocksToPrefetch << endl;
+  os << indent << "NumberOfCacheHits: " << this->NumberOfCacheHits << endl;
+  os << indent << "NumberOfCacheMisses: " << this->NumberOfCacheMisses << endl;
+  os << indent << "NumberOfPrefetchedBlocks: " << this->NumberOfPrefetchedBlocks << endl;
+  os << indent << "NumberOfPrefetchHits: " << this->NumberOfPrefetchHits << endl;
 }
 
 //----------------------------------------------------------------------------
@@ -820,18 +937,60 @@ void vtkSpreadSheetView::OnRepresentationUpdated()
 //----------------------------------------------------------------------------
 vtkTable* vtkSpreadSheetView::FetchBlock(vtkIdType blockindex)
 {
-  vtkTable* block = this->Internals->GetDataObject(blockindex);
-  if (!block)
+  bool prefetched;
+  vtkTable* block = this->Internals->RequestBlock(blockindex, prefetched);
+  if (block)
   {
+    this->NumberOfCacheHits++;
+    this->NumberOfPrefetchHits += prefetched ? 1 : 0;
+  }
+  else
+  {
+    this->NumberOfCacheMisses++;
     block = this->FetchBlockCallback(blockindex);
     // use the block returned from the AddToCache since that is cleaned up
     // to have columns in correct order.
-    block = this->Internals->AddToCache(blockindex, block, 10);
+    block = this->Internals->AddToCache(
+      blockindex, block, static_cast<unsigned long>(this->CacheSize) * 1024, false);
     this->InvokeEvent(vtkCommand::UpdateEvent, &blockindex);
   }
   return block;
 }
 
+//----------------------------------------------------------------------------
+bool vtkSpreadSheetView::PrefetchBlock()
+{
+  if (!this->Internals->ActiveRepresentation || this->NumberOfBlocksToPrefetch <= 0)
+  {
+    return false;
+  }
+
+  const unsigned long maxSize = static_cast<unsigned long>(this->CacheSize) * 1024;
+  const vtkIdType blockSize = this->TableStreamer->GetBlockSize();
+  const vtkIdType numBlocks = (this->GetNumberOfRows() + blockSize - 1) / blockSize;
+  vtkIdType blockindex =
+    this->Internals->GetBlockToPrefetch(numBlocks, this->NumberOfBlocksToPrefetch, maxSize);
+  if (blockindex < 0)
+  {
+    return false;
+  }
+
+  vtkTable* block = this->FetchBlockCallback(blockindex);
+  this->Internals->AddToCache(blockindex, block, maxSize, true);
+  this->NumberOfPrefetchedBlocks++;
+  this->InvokeEvent(vtkCommand::UpdateEvent, &blockindex);
+  return true;
+}
+
+//----------------------------------------------------------------------------
+void vtkSpreadSheetView::ResetCacheStatistics()
+{
+  this->NumberOfCacheHits = 0;
+  this->NumberOfCacheMisses = 0;
+  this->NumberOfPrefetchedBlocks = 0;
+  this->NumberOfPrefetchHits = 0;
+}
+
 //----------------------------------------------------------------------------
 vtkTable* vtkSpreadSheetView::FetchBlockCallback(vtkIdType blockindex)
 {
@@ -212,6 +212,52 @@ public:
    */
   void SetBlockSize(vtkIdType val);
 
+  //@{
+  /**
+   * Get/Set the maximum memory used by the blocks cached on the client, in
+   * MiB. The least recently used blocks are released first, the block being
+   * shown is always kept. Default is 64.
+   * \note CallOnClient
+   */
+  vtkSetClampMacro(CacheSize, int, 1, VTK_INT_MAX / 1024);
+  vtkGetMacro(CacheSize, int);
+  //@}
+
+  //@{
+  /**
+   * Get/Set the number of blocks PrefetchBlock() fetches ahead of the last
+   * requested block, in the scrolling direction. Once available, as many
+   * blocks are fetched in the other direction. Set to 0 to disable
+   * prefetching. Default is 2.
+   * \note CallOnClient
+   */
+  vtkSetClampMacro(NumberOfBlocksToPrefetch, int, 0, VTK_INT_MAX);
+  vtkGetMacro(NumberOfBlocksToPrefetch, int);
+  //@}
+
+  /**
+   * Fetch one of the blocks likely to be requested next, if it is not cached
+   * yet. Returns false when there is nothing left to prefetch. Like any
+   * fetch, this involves collective operations; applications call it when
+   * idle, after the requested rows have been shown.
+   * \note CallOnClient
+   */
+  virtual bool PrefetchBlock();
+
+  //@{
+  /**
+   * Statistics about the blocks cache, useful to tune the cache size and the
+   * number of blocks to prefetch. Hits and misses count the blocks requested
+   * to get values, prefetch hits count the requests served by a prefetched
+   * block.
+   */
+  vtkGetMacro(NumberOfCacheHits, vtkIdType);
+  vtkGetMacro(NumberOfCacheMisses, vtkIdType);
+  vtkGetMacro(NumberOfPrefetchedBlocks, vtkIdType);
+  vtkGetMacro(NumberOfPrefetchHits, vtkIdType);
+  void ResetCacheStatistics();
+  //@}
+
   /**
    * Export the contents of this view using the exporter.
    */
@@ -250,6 +296,13 @@ protected:
   vtkClientServerMoveData* DeliveryFilter;
   vtkIdType NumberOfRows;
 
+  int CacheSize;
+  int NumberOfBlocksToPrefetch;
+  vtkIdType NumberOfCacheHits;
+  vtkIdType NumberOfCacheMisses;
+  vtkIdType NumberOfPrefetchedBlocks;
+  vtkIdType NumberOfPrefetchHits;
+
   unsigned long CRMICallbackTag;
   unsigned long PRMICallbackTag;
   vtkTypeUInt32 Identifier;
@@ -542,6 +542,72 @@ void outputFunction(FILE* fp, ClassInfo* data)
 #endif
 }
 
+/* Hash of a method name, must match vtkClientServerInterpreter::GetMethodNameHash */
+static unsigned long methodNameHash(const char* name)
+{
+  /* 32-bit FNV-1a */
+  unsigned long hash = 2166136261ul;
+  for (; *name; ++name)
+  {
+    hash = ((hash ^ (unsigned char)*name) * 16777619ul) & 0xfffffffful;
+  }
+  return hash;
+}
+
+/* whether outputFunction generates code for the function */
+static int isWrappedFunction(FunctionInfo* curFunction, ClassInfo* data)
+{
+  return !notWrappable(curFunction) && managableArguments(curFunction) &&
+    strcmp(data->Name, curFunction->Name) && strcmp(data->Name, curFunction->Name + 1);
+}
+
+/*
+ * Output the code for all the methods of the class.  The methods are
+ * dispatched with a switch on the hash of the method name instead of
+ * comparing the name with the name of every method.  Methods whose names
+ * share a hash, including overloads, are tested in declaration order.
+ */
+void outputFunctions(FILE* fp, ClassInfo* data)
+{
+  int i, j;
+  unsigned long hash;
+  int* done;
+
+  if (data->NumberOfFunctions == 0)
+  {
+    return;
+  }
+
+  done = (int*)calloc(data->NumberOfFunctions, sizeof(int));
+  fprintf(fp, "  switch (vtkClientServerInterpreter::GetMethodNameHash(method))\n"
+              "    {\n");
+  for (i = 0; i < data->NumberOfFunctions; i++)
+  {
+    if (done[i] || !isWrappedFunction(data->Functions[i], data))
+    {
+      continue;
+    }
+
+    hash = methodNameHash(data->Functions[i]->Name);
+    fprintf(fp, "    case 0x%08lxu:\n", hash);
+    for (j = i; j < data->NumberOfFunctions; j++)
+    {
+      if (!done[j] && isWrappedFunction(data->Functions[j], data) &&
+        methodNameHash(data->Functions[j]->Name) == hash)
+      {
+        done[j] = 1;
+        currentFunction = data->Functions[j];
+        outputFunction(fp, data);
+      }
+    }
+    fprintf(fp, "    break;\n");
+  }
+  fprintf(fp, "    default:\n"
+              "    break;\n"
+              "    }\n");
+  free(done);
+}
+
 //--------------------------------------------------------------------------nix
 /*
  * This structure is used internally to sort+collect individual functions.
@@ -1415,11 +1481,7 @@ int main(int argc, char* argv[])
   /*fprintf(fp,"  vtkClientServerStream resultStream;\n");*/
 
   /* insert function handling code here */
-  for (i = 0; i < data->NumberOfFunctions; i++)
-  {
-    currentFunction = data->Functions[i];
-    outputFunction(fp, data);
-  }
+  outputFunctions(fp, data);
 
   /* try superclasses */
   for (i = 0; i < data->NumberOfSuperClasses; i++)
@@ -1427,9 +1489,8 @@ int main(int argc, char* argv[])
     fprintf(fp, "\n"
                 "  {\n"
                 "    const char* commandName = \"%s\";\n"
-                "    if (arlu->HasCommandFunction(commandName) &&\n"
-                "        arlu->CallCommandFunction(commandName, op, method, msg, resultStream)) { "
-                "return 1; }\n"
+                "    if (arlu->CallCommandFunctionIfAvailable(\n"
+                "          commandName, op, method, msg, resultStream)) { return 1; }\n"
                 "  }\n",
       data->SuperClasses[i]);
   }
@@ -0,0 +1,247 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestAMRDualOverlappedCommunication.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Tests that vtkAMRDualContour and vtkAMRDualClip produce the same output on
+// every rank with EnableOverlappedCommunication on and off. The input is a two
+// level AMR whose blocks are dealt to the ranks in turn, so the degenerate
+// regions between the levels are exchanged between processes.
+
+#include "vtkAMRDualClip.h"
+#include "vtkAMRDualContour.h"
+#include "vtkCellData.h"
+#include "vtkCompositeDataIterator.h"
+#include "vtkDoubleArray.h"
+#include "vtkIdList.h"
+#include "vtkLogger.h"
+#include "vtkMPIController.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkNonOverlappingAMR.h"
+#include "vtkPointSet.h"
+#include "vtkSmartPointer.h"
+#include "vtkUniformGrid.h"
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace
+{
+// Cells in a block, without ghost cells, along each axis.
+const int BlockCells = 4;
+// Blocks of level 0 along each axis. The center one is refined.
+const int RootBlocks = 3;
+const double Center = 0.5 * BlockCells * RootBlocks;
+const double IsoValue = 3.5;
+
+// Creates the block at the given grid index of a level. Ghost cells are added
+// on the sides that are not on the domain boundary, like the SpyPlot reader.
+vtkSmartPointer<vtkUniformGrid> NewBlock(int level, const int index[3])
+{
+  const double spacing = 1.0 / (1 << level);
+  const int domainCells = BlockCells * RootBlocks * (1 << level);
+  int lo[3];
+  int dims[3];
+  for (int axis = 0; axis < 3; ++axis)
+  {
+    lo[axis] = index[axis] * BlockCells;
+    int hi = lo[axis] + BlockCells;
+    lo[axis] -= lo[axis] > 0 ? 1 : 0;
+    hi += hi < domainCells ? 1 : 0;
+    dims[axis] = hi - lo[axis] + 1;
+  }
+
+  auto block = vtkSmartPointer<vtkUniformGrid>::New();
+  block->SetOrigin(lo[0] * spacing, lo[1] * spacing, lo[2] * spacing);
+  block->SetSpacing(spacing, spacing, spacing);
+  block->SetDimensions(dims);
+
+  vtkNew<vtkDoubleArray> scalars;
+  scalars->SetName("distance");
+  scalars->SetNumberOfTuples(block->GetNumberOfCells());
+  vtkIdType cellId = 0;
+  for (int kk = 0; kk < dims[2] - 1; ++kk)
+  {
+    for (int jj = 0; jj < dims[1] - 1; ++jj)
+    {
+      for (int ii = 0; ii < dims[0] - 1; ++ii)
+      {
+        const double x = (lo[0] + ii + 0.5) * spacing - Center;
+        const double y = (lo[1] + jj + 0.5) * spacing - Center;
+        const double z = (lo[2] + kk + 0.5) * spacing - Center;
+        scalars->SetValue(cellId++, std::sqrt(x * x + y * y + z * z));
+      }
+    }
+  }
+  block->GetCellData()->AddArray(scalars);
+  return block;
+}
+
+// Level 0 covers the domain but its center block, which level 1 refines in
+// 2x2x2 blocks. Each rank only keeps the blocks it owns.
+vtkSmartPointer<vtkNonOverlappingAMR> NewInput(int rank, int numRanks)
+{
+  std::vector<std::vector<std::vector<int> > > indices(2);
+  for (int kk = 0; kk < RootBlocks; ++kk)
+  {
+    for (int jj = 0; jj < RootBlocks; ++jj)
+    {
+      for (int ii = 0; ii < RootBlocks; ++ii)
+      {
+        if (ii == 1 && jj == 1 && kk == 1)
+        {
+          continue;
+        }
+        indices[0].push_back({ ii, jj, kk });
+      }
+    }
+  }
+  for (int kk = 2; kk < 4; ++kk)
+  {
+    for (int jj = 2; jj < 4; ++jj)
+    {
+      for (int ii = 2; ii < 4; ++ii)
+      {
+        indices[1].push_back({ ii, jj, kk });
+      }
+    }
+  }
+
+  auto amr = vtkSmartPointer<vtkNonOverlappingAMR>::New();
+  int blocksPerLevel[2] = { static_cast<int>(indices[0].size()),
+    static_cast<int>(indices[1].size()) };
+  amr->Initialize(2, blocksPerLevel);
+  int flatIndex = 0;
+  for (unsigned int level = 0; level < 2; ++level)
+  {
+    for (unsigned int cc = 0; cc < indices[level].size(); ++cc, ++flatIndex)
+    {
+      if (flatIndex % numRanks == rank)
+      {
+        amr->SetDataSet(level, cc, NewBlock(level, indices[level][cc].data()));
+      }
+    }
+  }
+  return amr;
+}
+
+// Flattens the points and cells of all the leaves of the output.
+std::vector<double> Flatten(vtkMultiBlockDataSet* output)
+{
+  std::vector<double> values;
+  vtkNew<vtkIdList> ptIds;
+  vtkSmartPointer<vtkCompositeDataIterator> iter;
+  iter.TakeReference(output->NewIterator());
+  for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+  {
+    auto leaf = vtkPointSet::SafeDownCast(iter->GetCurrentDataObject());
+    if (!leaf)
+    {
+      continue;
+    }
+    values.push_back(static_cast<double>(leaf->GetNumberOfPoints()));
+    values.push_back(static_cast<double>(leaf->GetNumberOfCells()));
+    for (vtkIdType ptId = 0; ptId < leaf->GetNumberOfPoints(); ++ptId)
+    {
+      double pt[3];
+      leaf->GetPoint(ptId, pt);
+      values.insert(values.end(), pt, pt + 3);
+    }
+    for (vtkIdType cellId = 0; cellId < leaf->GetNumberOfCells(); ++cellId)
+    {
+      leaf->GetCellPoints(cellId, ptIds);
+      values.push_back(static_cast<double>(ptIds->GetNumberOfIds()));
+      for (vtkIdType cc = 0; cc < ptIds->GetNumberOfIds(); ++cc)
+      {
+        values.push_back(static_cast<double>(ptIds->GetId(cc)));
+      }
+    }
+  }
+  return values;
+}
+
+template <class FilterT>
+std::vector<double> Run(vtkMultiProcessController* contr, vtkNonOverlappingAMR* input,
+  bool overlapped, vtkIdType& numCells)
+{
+  vtkNew<FilterT> filter;
+  filter->SetController(contr);
+  filter->SetInputData(input);
+  filter->SetInputArrayToProcess(0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_CELLS, "distance");
+  filter->SetIsoValue(IsoValue);
+  // off by default for the clip filter.
+  filter->EnableMultiProcessCommunicationOn();
+  filter->SetEnableOverlappedCommunication(overlapped ? 1 : 0);
+  filter->Update();
+
+  numCells = 0;
+  vtkSmartPointer<vtkCompositeDataIterator> iter;
+  iter.TakeReference(filter->GetOutput()->NewIterator());
+  for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+  {
+    if (auto leaf = vtkDataSet::SafeDownCast(iter->GetCurrentDataObject()))
+    {
+      numCells += leaf->GetNumberOfCells();
+    }
+  }
+  return Flatten(filter->GetOutput());
+}
+
+template <class FilterT>
+bool RunCase(vtkMultiProcessController* contr, vtkNonOverlappingAMR* input, const std::string& label)
+{
+  vtkIdType blockingCells = 0;
+  vtkIdType overlappedCells = 0;
+  const auto blocking = Run<FilterT>(contr, input, false, blockingCells);
+  const auto overlapped = Run<FilterT>(contr, input, true, overlappedCells);
+
+  bool success = true;
+  if (blocking != overlapped)
+  {
+    vtkLogF(ERROR, "%s: rank %d has %d cells with overlapped communication, %d without",
+      label.c_str(), contr->GetLocalProcessId(), static_cast<int>(overlappedCells),
+      static_cast<int>(blockingCells));
+    success = false;
+  }
+
+  vtkIdType totalCells = 0;
+  contr->AllReduce(&blockingCells, &totalCells, 1, vtkCommunicator::SUM_OP);
+  if (totalCells == 0)
+  {
+    vtkLogF(ERROR, "%s: the output is empty", label.c_str());
+    success = false;
+  }
+  return success;
+}
+}
+
+int TestAMRDualOverlappedCommunication(int argc, char* argv[])
+{
+  vtkMPIController* contr = vtkMPIController::New();
+  contr->Initialize(&argc, &argv);
+  vtkMultiProcessController::SetGlobalController(contr);
+
+  auto input = NewInput(contr->GetLocalProcessId(), contr->GetNumberOfProcesses());
+  bool success = RunCase<vtkAMRDualContour>(contr, input, "contour");
+  success = RunCase<vtkAMRDualClip>(contr, input, "clip") && success;
+
+  int localSuccess = success ? 1 : 0;
+  int allSuccess = 0;
+  contr->AllReduce(&localSuccess, &allSuccess, 1, vtkCommunicator::LOGICAL_AND_OP);
+
+  vtkMultiProcessController::SetGlobalController(nullptr);
+  contr->Finalize();
+  contr->Delete();
+  return allSuccess ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -18,6 +18,7 @@
 #include "vtkInformationVector.h"
 #include "vtkObject.h"
 #include "vtkObjectFactory.h"
+#include "vtkPVUnionFind.h"
 
 #include "vtkAMRDualGridHelper.h"
 #include "vtkCell.h"
@@ -42,142 +43,68 @@
 #include "vtkMPIController.h"
 #endif
 
+#include <algorithm>
 #include <list>
-#include <map>
+#include <unordered_map>
+#include <vector>
 
 vtkStandardNewMacro(vtkAMRConnectivity);
 
+// Region ids are sparse, they are mapped to consecutive members of a
+// union-find structure (see vtkPVUnionFind).
 class vtkAMRConnectivityEquivalence
 {
 public:
-  vtkAMRConnectivityEquivalence()
-  {
-    set_to_min_id = vtkSmartPointer<vtkIntArray>::New();
-    set_to_min_id->SetNumberOfComponents(1);
-    set_to_min_id->SetNumberOfTuples(0);
-  }
+  vtkAMRConnectivityEquivalence() {}
 
   ~vtkAMRConnectivityEquivalence() {}
 
+  // Returns 0 if the ids were already equivalent.
   int AddEquivalence(int id1, int id2)
   {
-    int min_id;
-    if (id1 < id2)
-    {
-      min_id = id1;
-    }
-    else
-    {
-      min_id = id2;
-    }
-
-    std::map<int, int>::iterator iter;
-
-    iter = id_to_set.find(id1);
-    int set1 = (iter == id_to_set.end() ? -1 : iter->second);
-    iter = id_to_set.find(id2);
-    int set2 = (iter == id_to_set.end() ? -1 : iter->second);
-
-    if (set1 >= 0 && set_to_min_id->GetValue(set1) < 0)
-    {
-      set1 = -1;
-    }
-    if (set2 >= 0 && set_to_min_id->GetValue(set2) < 0)
-    {
-      set2 = -1;
-    }
-
-    if (set1 >= 0 && set2 >= 0 && set1 == set2)
+    // GetMember may grow Parents, look both members up before taking data().
+    int member1 = this->GetMember(id1);
+    int member2 = this->GetMember(id2);
+    int root1 = vtkPVUnionFind::Find(this->Parents.data(), member1);
+    int root2 = vtkPVUnionFind::Find(this->Parents.data(), member2);
+    if (root1 == root2)
     {
       return 0;
     }
-    else if (set1 >= 0 && set2 >= 0)
-    {
-      // merge sets
-      int min_set, max_set;
-      if (set1 < set2)
-      {
-        min_set = set1;
-        max_set = set2;
-      }
-      else
-      {
-        min_set = set2;
-        max_set = set1;
-      }
-      for (iter = id_to_set.begin(); iter != id_to_set.end(); iter++)
-      {
-        if (iter->second == max_set)
-        {
-          id_to_set[iter->first] = min_set;
-        }
-      }
-      int max_set_min = set_to_min_id->GetValue(max_set);
-      int min_set_min = set_to_min_id->GetValue(min_set);
-      // pick the smallest of the two mins to represent the set.
-      if (max_set_min < min_set_min)
-      {
-        set_to_min_id->SetValue(min_set, max_set_min);
-      }
-      set_to_min_id->SetValue(max_set, -1);
-    }
-    else if (set1 >= 0)
-    {
-      id_to_set[id2] = set1;
-      if (id2 < set_to_min_id->GetValue(set1))
-      {
-        set_to_min_id->SetValue(set1, id2);
-      }
-    }
-    else if (set2 >= 0)
-    {
-      id_to_set[id1] = set2;
-      if (id1 < set_to_min_id->GetValue(set2))
-      {
-        set_to_min_id->SetValue(set2, id1);
-      }
-    }
-    else
-    {
-      // find an empty set.
-      int first_empty = -1;
-      for (int i = 0; i < set_to_min_id->GetNumberOfTuples(); i++)
-      {
-        if (set_to_min_id->GetValue(i) < 0)
-        {
-          first_empty = i;
-          break;
-        }
-      }
-      if (first_empty < 0)
-      {
-        first_empty = set_to_min_id->InsertNextValue(-1);
-      }
-
-      id_to_set[id1] = first_empty;
-      id_to_set[id2] = first_empty;
-      set_to_min_id->SetValue(first_empty, min_id);
-      // return zero here because its not values we've previously cared about.
-    }
+    vtkPVUnionFind::Union(this->Parents.data(), root1, root2);
+    // pick the smallest of the two mins to represent the set.
+    int root = std::min(root1, root2);
+    this->MinimumIds[root] = std::min(this->MinimumIds[root1], this->MinimumIds[root2]);
     return 1;
   }
 
   int GetMinimumSetId(int id)
   {
-    std::map<int, int>::iterator iter = id_to_set.find(id);
-    if (iter == id_to_set.end())
+    std::unordered_map<int, int>::iterator iter = this->Members.find(id);
+    if (iter == this->Members.end())
     {
-      // vtkErrorWithObjectMacro (id_to_set, << "ID out of range " << id << " (expected 0 <= x < "
-      // << id_to_set->GetNumberOfTuples () << ")");
       return -1;
     }
-    int set = id_to_set[id];
-    return (set >= 0 ? set_to_min_id->GetValue(set) : -1);
+    return this->MinimumIds[vtkPVUnionFind::Find(this->Parents.data(), iter->second)];
   }
 
 private:
-  std::map<int, int> id_to_set;
-  vtkSmartPointer<vtkIntArray> set_to_min_id;
+  int GetMember(int id)
+  {
+    std::pair<std::unordered_map<int, int>::iterator, bool> inserted =
+      this->Members.insert(std::make_pair(id, static_cast<int>(this->Parents.size())));
+    if (inserted.second)
+    {
+      this->Parents.push_back(inserted.first->second);
+      this->MinimumIds.push_back(id);
+    }
+    return inserted.first->second;
+  }
+
+  std::unordered_map<int, int> Members;
+  std::vector<int> Parents;
+  // Smallest region id of the sets, indexed by root member.
+  std::vector<int> MinimumIds;
 };
 
 #if VTK_MODULE_ENABLE_VTK_ParallelMPI
@@ -1030,6 +1030,7 @@ vtkAMRDualClip::vtkAMRDualClip()
   this->EnableDegenerateCells = 1;
   this->EnableMultiProcessCommunication = 0;
   this->EnableMergePoints = 0;
+  this->EnableOverlappedCommunication = 0;
 
   this->Controller = NULL;
   this->SetController(vtkMultiProcessController::GetGlobalController());
@@ -1064,6 +1065,8 @@ void vtkAMRDualClip::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "EnableInternalDecimation: " << this->EnableInternalDecimation << endl;
   os << indent << "EnableDegenerateCells: " << this->EnableDegenerateCells << endl;
   os << indent << "EnableMergePoints: " << this->EnableMergePoints << endl;
+  os << indent << "EnableOverlappedCommunication: " << this->EnableOverlappedCommunication
+     << endl;
   os << indent << "Controller: " << this->Controller << endl;
 }
 
@@ -1166,6 +1169,7 @@ vtkMultiBlockDataSet* vtkAMRDualClip::DoRequestData(
 
   this->Helper = vtkAMRDualGridHelper::New();
   this->Helper->SetEnableDegenerateCells(this->EnableDegenerateCells);
+  this->Helper->SetEnableOverlappedCommunication(this->EnableOverlappedCommunication);
   if (this->EnableMultiProcessCommunication)
   {
     this->Helper->SetController(this->Controller);
@@ -1210,6 +1214,10 @@ vtkMultiBlockDataSet* vtkAMRDualClip::DoRequestData(
   // Add each block.
   for (int level = 0; level < numLevels; ++level)
   {
+    // The level masks of blocks are initialized from the level masks and
+    // ghost values of neighbors in lower or equal levels, which may still be
+    // in flight (overlapped communication).
+    this->Helper->FinishRegionRemoteCopiesToLevel(level);
     numBlocks = this->Helper->GetNumberOfBlocksInLevel(level);
     for (blockId = 0; blockId < numBlocks; ++blockId)
     {
@@ -1217,6 +1225,7 @@ vtkMultiBlockDataSet* vtkAMRDualClip::DoRequestData(
       this->ProcessBlock(block, blockId, arrayNameToProcess);
     }
   }
+  this->Helper->FinishRegionRemoteCopyQueue();
 
   this->BlockIdCellArray->Delete();
   this->BlockIdCellArray = 0;
@@ -1444,6 +1453,9 @@ void vtkAMRDualClip::ShareLevelMask(vtkAMRDualGridHelperBlock* block)
             // was copied to this block already.
             if (neighbor && neighbor->Image && neighbor->RegionBits[1][1][1] != 0)
             {
+              // Remote level masks are copied into the neighbor first, as
+              // when the exchange is blocking (overlapped communication).
+              this->Helper->FinishRegionRemoteCopiesToBlock(neighbor);
               neighborLocator = vtkAMRDualClipGetBlockLocator(neighbor);
               neighborLocator->CopyNeighborLevelMask(neighbor, block);
             }
@@ -2013,6 +2025,9 @@ void vtkAMRDualClip::DistributeLevelMasks()
                     vtkDataArray* scalars;
                     vtkDataArray* neighborLevelMaskArray = 0;
                     vtkDataArray* blockLevelMaskArray = 0;
+                    // Ghost values may still be in flight.
+                    this->Helper->FinishRegionRemoteCopiesToBlock(block);
+                    this->Helper->FinishRegionRemoteCopiesToBlock(neighborBlock);
                     if (block->Image)
                     {
                       scalars = block->Image->GetCellData()->GetArray(arrayName);
@@ -2043,7 +2058,9 @@ void vtkAMRDualClip::DistributeLevelMasks()
     }               // loop over receiving blocks in level
   }                 // loop over all levels
 
-  this->Helper->ProcessRegionRemoteCopyQueue(true);
+  // With overlapped communication, the masks are copied into the blocks
+  // while they are processed.
+  this->Helper->StartRegionRemoteCopyQueue(true);
 }
 
 //----------------------------------------------------------------------------
@@ -85,6 +85,18 @@ public:
   vtkBooleanMacro(EnableMergePoints, int);
   //@}
 
+  //@{
+  /**
+   * When on, blocks are processed while the ghost values of other blocks are
+   * still being received from other processes, see
+   * vtkAMRDualGridHelper::SetEnableOverlappedCommunication().  This is off by
+   * default.
+   */
+  vtkSetMacro(EnableOverlappedCommunication, int);
+  vtkGetMacro(EnableOverlappedCommunication, int);
+  vtkBooleanMacro(EnableOverlappedCommunication, int);
+  //@}
+
   vtkGetObjectMacro(Controller, vtkMultiProcessController);
   virtual void SetController(vtkMultiProcessController*);
 
@@ -99,6 +111,7 @@ protected:
   int EnableDegenerateCells;
   int EnableMultiProcessCommunication;
   int EnableMergePoints;
+  int EnableOverlappedCommunication;
 
   // Needed for copying cell data to point data.
   vtkUnstructuredGrid* Mesh;
@@ -623,6 +623,7 @@ vtkAMRDualContour::vtkAMRDualContour()
   this->EnableMultiProcessCommunication = 1;
   this->EnableMergePoints = 1;
   this->TriangulateCap = 1;
+  this->EnableOverlappedCommunication = 0;
 
   this->Controller = NULL;
   this->SetController(vtkMultiProcessController::GetGlobalController());
@@ -661,6 +662,8 @@ void vtkAMRDualContour::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "EnableMergePoints: " << this->EnableMergePoints << endl;
   os << indent << "TriangulateCap: " << this->TriangulateCap << endl;
   os << indent << "SkipGhostCopy: " << this->SkipGhostCopy << endl;
+  os << indent << "EnableOverlappedCommunication: " << this->EnableOverlappedCommunication
+     << endl;
 }
 
 //----------------------------------------------------------------------------
@@ -763,6 +766,7 @@ void vtkAMRDualContour::InitializeRequest(vtkNonOverlappingAMR* hbdsInput)
   this->Helper = vtkAMRDualGridHelper::New();
   this->Helper->SetEnableDegenerateCells(this->EnableDegenerateCells);
   this->Helper->SetSkipGhostCopy(this->SkipGhostCopy);
+  this->Helper->SetEnableOverlappedCommunication(this->EnableOverlappedCommunication);
   if (this->EnableMultiProcessCommunication)
   {
     this->Helper->SetController(this->Controller);
@@ -816,9 +820,12 @@ vtkMultiBlockDataSet* vtkAMRDualContour::DoRequestData(
     for (int blockId = 0; blockId < numBlocks; ++blockId)
     {
       vtkAMRDualGridHelperBlock* block = this->Helper->GetBlock(level, blockId);
+      // Ghost values may still be in flight (overlapped communication).
+      this->Helper->FinishRegionRemoteCopiesToBlock(block);
       this->ProcessBlock(block, blockId, arrayNameToProcess);
     }
   }
+  this->Helper->FinishRegionRemoteCopyQueue();
 
   this->FinalizeCopyAttributes(this->Mesh);
   this->BlockIdCellArray->Delete();
@@ -114,6 +114,18 @@ public:
   vtkBooleanMacro(SkipGhostCopy, int);
   //@}
 
+  //@{
+  /**
+   * When on, blocks are processed while the ghost values of other blocks are
+   * still being received from other processes, see
+   * vtkAMRDualGridHelper::SetEnableOverlappedCommunication().  This is off by
+   * default.
+   */
+  vtkSetMacro(EnableOverlappedCommunication, int);
+  vtkGetMacro(EnableOverlappedCommunication, int);
+  vtkBooleanMacro(EnableOverlappedCommunication, int);
+  //@}
+
   vtkGetObjectMacro(Controller, vtkMultiProcessController);
   virtual void SetController(vtkMultiProcessController*);
 
@@ -130,6 +142,7 @@ protected:
   int EnableMergePoints;
   int TriangulateCap;
   int SkipGhostCopy;
+  int EnableOverlappedCommunication;
 
   int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
 
@@ -22,6 +22,7 @@
 #include "vtkIdTypeArray.h"
 #include "vtkImageData.h"
 #include "vtkIntArray.h"
+#include "vtkLogger.h"
 #include "vtkMultiProcessController.h"
 #include "vtkNonOverlappingAMR.h"
 #include "vtkObjectFactory.h"
@@ -33,6 +34,7 @@
 #include "vtkSmartPointer.h"
 #define VTK_CREATE(type, name) vtkSmartPointer<type> name = vtkSmartPointer<type>::New()
 
+#include <algorithm>
 #include <list>
 #include <vector>
 
@@ -205,6 +207,40 @@ public:
     vtkGenericWarningMacro(<< "Nothing to wait for.");
     return value_type();
   }
+  // Description:
+  // If one of the communications is complete, removes it from the list,
+  // copies it to request and returns true.  Returns false without waiting
+  // otherwise.
+  bool TestAny(value_type& request)
+  {
+    for (iterator i = this->begin(); i != this->end(); i++)
+    {
+      if (i->Request.Test())
+      {
+        request = *i;
+        this->erase(i);
+        return true;
+      }
+    }
+    return false;
+  }
+  // Description:
+  // Removes the communications that are complete.  Testing the others also
+  // lets MPI make progress on them.
+  void RemoveCompleted()
+  {
+    for (iterator i = this->begin(); i != this->end();)
+    {
+      if (i->Request.Test())
+      {
+        i = this->erase(i);
+      }
+      else
+      {
+        i++;
+      }
+    }
+  }
 };
 #endif // VTK_AMR_DUAL_GRID_USE_MPI_ASYNCHRONOUS
 
@@ -400,6 +436,7 @@ vtkAMRDualGridHelperBlock::vtkAMRDualGridHelperBlock()
   //  }
   this->Image = 0;
   this->CopyFlag = 0;
+  this->PendingRemoteRegions = 0;
 
   this->ResetRegionBits();
 }
@@ -718,6 +755,13 @@ vtkAMRDualGridHelper::vtkAMRDualGridHelper()
   this->ArrayName = 0;
   this->EnableDegenerateCells = 1;
   this->EnableAsynchronousCommunication = 1;
+  this->EnableOverlappedCommunication = 0;
+  this->PendingSendList = nullptr;
+  this->PendingReceiveList = nullptr;
+  this->PendingHackLevelFlag = false;
+  this->PendingPostTime = 0.0;
+  this->PendingHelperTime = 0.0;
+  this->ResetCommunicationStatistics();
   this->NumberOfBlocksInThisProcess = 0;
   for (ii = 0; ii < 3; ++ii)
   {
@@ -742,6 +786,9 @@ vtkAMRDualGridHelper::~vtkAMRDualGridHelper()
   int ii;
   int numberOfLevels = (int)(this->Levels.size());
 
+  // Do not leave messages in flight.
+  this->FinishRegionRemoteCopyQueue();
+
   this->SetArrayName(0);
 
   for (ii = 0; ii < numberOfLevels; ++ii)
@@ -767,6 +814,14 @@ void vtkAMRDualGridHelper::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "EnableDegenerateCells: " << this->EnableDegenerateCells << endl;
   os << indent << "EnableAsynchronousCommunication: " << this->EnableAsynchronousCommunication
      << endl;
+  os << indent << "EnableOverlappedCommunication: " << this->EnableOverlappedCommunication
+     << endl;
+  os << indent << "NumberOfBytesSent: " << this->NumberOfBytesSent << endl;
+  os << indent << "NumberOfBytesReceived: " << this->NumberOfBytesReceived << endl;
+  os << indent << "MarshalTime: " << this->MarshalTime << endl;
+  os << indent << "WaitTime: " << this->WaitTime << endl;
+  os << indent << "UnmarshalTime: " << this->UnmarshalTime << endl;
+  os << indent << "OverlappedTime: " << this->OverlappedTime << endl;
   os << indent << "Controller: " << this->Controller << endl;
 }
 
@@ -1893,9 +1948,11 @@ void vtkAMRDualGridHelper::MarshalDegenerateRegionMessage(void* messagePtr, int
 // Given a buffer (of size determined by DegenerateRegionMessageSize) filled
 // with degenerate region information received from the given processes, copy
 // the information to the local block data structures.
-void vtkAMRDualGridHelper::UnmarshalDegenerateRegionMessage(const void* messagePtr,
-  int vtkNotUsed(messageLength), int vtkNotUsed(srcProc), bool hackLevelFlag)
+void vtkAMRDualGridHelper::UnmarshalDegenerateRegionMessage(
+  const void* messagePtr, int messageLength, int vtkNotUsed(srcProc), bool hackLevelFlag)
 {
+  double startTime = vtkTimerLog::GetUniversalTime();
+  this->NumberOfBytesReceived += messageLength;
   while (1)
   {
     const int* gridPtr = static_cast<const int*>(messagePtr);
@@ -1926,6 +1983,10 @@ void vtkAMRDualGridHelper::UnmarshalDegenerateRegionMessage(const void* messageP
     gridIndex[2] = *gridPtr++;
 
     region.ReceivingBlock = GetBlock(level, gridIndex[0], gridIndex[1], gridIndex[2]);
+    if (region.ReceivingBlock->PendingRemoteRegions > 0)
+    {
+      --region.ReceivingBlock->PendingRemoteRegions;
+    }
 
     if (region.ReceivingBlock->CopyFlag == 0)
     { // We cannot modify our input.
@@ -1941,6 +2002,7 @@ void vtkAMRDualGridHelper::UnmarshalDegenerateRegionMessage(const void* messageP
 
     messagePtr = this->CopyDegenerateRegionMessageToBlock(region, messagePtr, hackLevelFlag);
   }
+  this->UnmarshalTime += vtkTimerLog::GetUniversalTime() - startTime;
 }
 
 //----------------------------------------------------------------------------
@@ -1949,6 +2011,9 @@ void vtkAMRDualGridHelper::UnmarshalDegenerateRegionMessage(const void* messageP
 // step of initialization.
 void vtkAMRDualGridHelper::ProcessRegionRemoteCopyQueue(bool hackLevelFlag)
 {
+  // Messages of a previous overlapped exchange use the same tag.
+  this->FinishRegionRemoteCopyQueue();
+
   if (this->SkipGhostCopy)
   {
     return;
@@ -1958,11 +2023,124 @@ void vtkAMRDualGridHelper::ProcessRegionRemoteCopyQueue(bool hackLevelFlag)
   if (this->EnableAsynchronousCommunication && this->Controller->IsA("vtkMPIController"))
   {
     this->ProcessRegionRemoteCopyQueueMPIAsynchronous(hackLevelFlag);
+    this->LogCommunicationStatistics();
     return;
   }
 #endif // VTK_AMR_DUAL_GRID_USE_MPI_ASYNCHRONOUS
 
   this->ProcessRegionRemoteCopyQueueSynchronous(hackLevelFlag);
+  this->LogCommunicationStatistics();
+}
+
+//----------------------------------------------------------------------------
+void vtkAMRDualGridHelper::StartRegionRemoteCopyQueue(bool hackLevelFlag)
+{
+#ifdef VTK_AMR_DUAL_GRID_USE_MPI_ASYNCHRONOUS
+  if (this->EnableOverlappedCommunication && this->EnableAsynchronousCommunication &&
+    !this->SkipGhostCopy && this->Controller->IsA("vtkMPIController"))
+  {
+    // Messages of a previous overlapped exchange use the same tag.
+    this->FinishRegionRemoteCopyQueue();
+    this->PostRegionRemoteCopyQueueMPIAsynchronous(hackLevelFlag);
+    return;
+  }
+#endif // VTK_AMR_DUAL_GRID_USE_MPI_ASYNCHRONOUS
+
+  this->ProcessRegionRemoteCopyQueue(hackLevelFlag);
+}
+
+//----------------------------------------------------------------------------
+void vtkAMRDualGridHelper::FinishRegionRemoteCopiesToBlock(vtkAMRDualGridHelperBlock* block)
+{
+#ifdef VTK_AMR_DUAL_GRID_USE_MPI_ASYNCHRONOUS
+  if (!this->PendingReceiveList)
+  {
+    return;
+  }
+  double startTime = vtkTimerLog::GetUniversalTime();
+
+  // Consume the messages that already arrived, then the ones this block needs.
+  this->PendingSendList->RemoveCompleted();
+  vtkAMRDualGridHelperCommRequestList& receiveList = *this->PendingReceiveList;
+  size_t numberOfMessages;
+  do
+  {
+    numberOfMessages = receiveList.size();
+    this->UnmarshalDegenerateRegionRequest(receiveList, false, this->PendingHackLevelFlag);
+  } while (receiveList.size() < numberOfMessages);
+  while (block && block->PendingRemoteRegions > 0 && !receiveList.empty())
+  {
+    this->UnmarshalDegenerateRegionRequest(receiveList, true, this->PendingHackLevelFlag);
+  }
+  this->PendingHelperTime += vtkTimerLog::GetUniversalTime() - startTime;
+#else
+  (void)block;
+#endif // VTK_AMR_DUAL_GRID_USE_MPI_ASYNCHRONOUS
+}
+
+//----------------------------------------------------------------------------
+void vtkAMRDualGridHelper::FinishRegionRemoteCopiesToLevel(int level)
+{
+  if (!this->PendingReceiveList)
+  {
+    return;
+  }
+  int numLevels = this->GetNumberOfLevels();
+  for (int ii = 0; ii <= level && ii < numLevels; ++ii)
+  {
+    int numBlocks = this->GetNumberOfBlocksInLevel(ii);
+    for (int blockId = 0; blockId < numBlocks; ++blockId)
+    {
+      this->FinishRegionRemoteCopiesToBlock(this->GetBlock(ii, blockId));
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkAMRDualGridHelper::FinishRegionRemoteCopyQueue()
+{
+#ifdef VTK_AMR_DUAL_GRID_USE_MPI_ASYNCHRONOUS
+  if (!this->PendingReceiveList)
+  {
+    return;
+  }
+  double startTime = vtkTimerLog::GetUniversalTime();
+  this->FinishDegenerateRegionsCommMPIAsynchronous(
+    this->PendingHackLevelFlag, *this->PendingSendList, *this->PendingReceiveList);
+  double endTime = vtkTimerLog::GetUniversalTime();
+  this->PendingHelperTime += endTime - startTime;
+
+  // The time the messages were in flight while the caller did something else.
+  this->OverlappedTime += std::max(0.0, endTime - this->PendingPostTime - this->PendingHelperTime);
+
+  delete this->PendingSendList;
+  delete this->PendingReceiveList;
+  this->PendingSendList = nullptr;
+  this->PendingReceiveList = nullptr;
+  this->LogCommunicationStatistics();
+#endif // VTK_AMR_DUAL_GRID_USE_MPI_ASYNCHRONOUS
+}
+
+//----------------------------------------------------------------------------
+void vtkAMRDualGridHelper::ResetCommunicationStatistics()
+{
+  this->NumberOfBytesSent = 0;
+  this->NumberOfBytesReceived = 0;
+  this->MarshalTime = 0.0;
+  this->WaitTime = 0.0;
+  this->UnmarshalTime = 0.0;
+  this->OverlappedTime = 0.0;
+}
+
+//----------------------------------------------------------------------------
+void vtkAMRDualGridHelper::LogCommunicationStatistics()
+{
+  vtkLogF(TRACE,
+    "degenerate regions: %lld bytes sent, %lld bytes received, marshal %g s, wait %g s, "
+    "unmarshal %g s, overlapped %g s",
+    static_cast<long long>(this->NumberOfBytesSent),
+    static_cast<long long>(this->NumberOfBytesReceived), this->MarshalTime, this->WaitTime,
+    this->UnmarshalTime, this->OverlappedTime);
 }
 
 void vtkAMRDualGridHelper::ProcessRegionRemoteCopyQueueSynchronous(bool hackLevelFlag)
@@ -2038,13 +2216,18 @@ void vtkAMRDualGridHelper::SendDegenerateRegionsFromQueueSynchronous(
   // std::cerr << "ProcessDegenerates: Proc " << myProc << " sending " << messageLength << " to " <<
   // destProc << std::endl;
   // Send the message
-  this->Controller->Send(&messageLength, 1, destProc, DEGENERATE_REGION_TAG);
+  double startTime = vtkTimerLog::GetUniversalTime();
   VTK_CREATE(vtkUnsignedCharArray, buffer);
   buffer->SetNumberOfValues(messageLength);
 
   this->MarshalDegenerateRegionMessage(buffer->GetPointer(0), destProc);
+  double marshalTime = vtkTimerLog::GetUniversalTime();
+  this->MarshalTime += marshalTime - startTime;
 
+  this->Controller->Send(&messageLength, 1, destProc, DEGENERATE_REGION_TAG);
   this->Controller->Send(buffer->GetPointer(0), messageLength, destProc, DEGENERATE_REGION_TAG);
+  this->WaitTime += vtkTimerLog::GetUniversalTime() - marshalTime;
+  this->NumberOfBytesSent += messageLength;
 }
 
 //----------------------------------------------------------------------------
@@ -2063,6 +2246,7 @@ void vtkAMRDualGridHelper::ReceiveDegenerateRegionsFromQueueSynchronous(
   int myProc = this->Controller->GetLocalProcessId();
   // Receive the message.
   vtkIdType originalLength = messageLength;
+  double startTime = vtkTimerLog::GetUniversalTime();
   this->Controller->Receive(&messageLength, 1, srcProc, DEGENERATE_REGION_TAG);
   if (originalLength != messageLength)
   {
@@ -2074,6 +2258,7 @@ void vtkAMRDualGridHelper::ReceiveDegenerateRegionsFromQueueSynchronous(
   buffer->SetNumberOfValues(messageLength);
 
   this->Controller->Receive(buffer->GetPointer(0), messageLength, srcProc, DEGENERATE_REGION_TAG);
+  this->WaitTime += vtkTimerLog::GetUniversalTime() - startTime;
 
   this->UnmarshalDegenerateRegionMessage(
     buffer->GetPointer(0), messageLength, srcProc, hackLevelFlag);
@@ -2096,12 +2281,23 @@ void vtkAMRDualGridHelper::ProcessRegionRemoteCopyQueueMPIAsynchronous(bool hack
     return;
   }
 
-  int numProcs = controller->GetNumberOfProcesses();
-  int myProc = controller->GetLocalProcessId();
-
   vtkAMRDualGridHelperCommRequestList sendList;
   vtkAMRDualGridHelperCommRequestList receiveList;
 
+  this->PostDegenerateRegionsCommMPIAsynchronous(sendList, receiveList);
+
+  // Finally, finish all communications as they come in.
+  this->FinishDegenerateRegionsCommMPIAsynchronous(hackLevelFlag, sendList, receiveList);
+}
+
+//-----------------------------------------------------------------------------
+void vtkAMRDualGridHelper::PostDegenerateRegionsCommMPIAsynchronous(
+  vtkAMRDualGridHelperCommRequestList& sendList, vtkAMRDualGridHelperCommRequestList& receiveList)
+{
+  double startTime = vtkTimerLog::GetUniversalTime();
+  int numProcs = this->Controller->GetNumberOfProcesses();
+  int myProc = this->Controller->GetLocalProcessId();
+
   VTK_CREATE(vtkIdTypeArray, srcProcs);
   srcProcs->SetNumberOfValues(numProcs);
   VTK_CREATE(vtkIdTypeArray, destProcs);
@@ -2141,9 +2337,7 @@ void vtkAMRDualGridHelper::ProcessRegionRemoteCopyQueueMPIAsynchronous(bool hack
       this->SendDegenerateRegionsFromQueueMPIAsynchronous(recvProc, messageLength, sendList);
     }
   }
-
-  // Finally, finish all communications as they come in.
-  this->FinishDegenerateRegionsCommMPIAsynchronous(hackLevelFlag, sendList, receiveList);
+  this->MarshalTime += vtkTimerLog::GetUniversalTime() - startTime;
 }
 
 void vtkAMRDualGridHelper::ReceiveDegenerateRegionsFromQueueMPIAsynchronous(
@@ -2204,6 +2398,7 @@ void vtkAMRDualGridHelper::SendDegenerateRegionsFromQueueMPIAsynchronous(
   // running out of memory anyway.
   controller->NoBlockSend(sendBuffer->GetPointer(0), static_cast<int>(messageLength), recvProc,
     DEGENERATE_REGION_TAG, request.Request);
+  this->NumberOfBytesSent += messageLength;
 
   sendList.push_back(request);
 }
@@ -2213,13 +2408,62 @@ void vtkAMRDualGridHelper::FinishDegenerateRegionsCommMPIAsynchronous(bool hackL
 {
   while (!receiveList.empty())
   {
-    vtkAMRDualGridHelperCommRequest request = receiveList.WaitAny();
-    vtkCharArray* recvBuffer = vtkCharArray::SafeDownCast(request.Buffer);
-    this->UnmarshalDegenerateRegionMessage(recvBuffer->GetPointer(0),
-      recvBuffer->GetNumberOfTuples(), request.SendProcess, hackLevelFlag);
+    this->UnmarshalDegenerateRegionRequest(receiveList, true, hackLevelFlag);
   }
 
+  double startTime = vtkTimerLog::GetUniversalTime();
   sendList.WaitAll();
+  this->WaitTime += vtkTimerLog::GetUniversalTime() - startTime;
+}
+
+//-----------------------------------------------------------------------------
+// Posts the messages and returns.  They are copied into the blocks by the
+// FinishRegionRemoteCopies methods.
+void vtkAMRDualGridHelper::PostRegionRemoteCopyQueueMPIAsynchronous(bool hackLevelFlag)
+{
+  int myProc = this->Controller->GetLocalProcessId();
+  std::vector<vtkAMRDualGridHelperDegenerateRegion>::iterator region;
+  for (region = this->DegenerateRegionQueue.begin(); region != this->DegenerateRegionQueue.end();
+       region++)
+  {
+    if (region->ReceivingBlock->ProcessId == myProc && region->SourceBlock->ProcessId != myProc)
+    {
+      ++region->ReceivingBlock->PendingRemoteRegions;
+    }
+  }
+
+  this->PendingSendList = new vtkAMRDualGridHelperCommRequestList;
+  this->PendingReceiveList = new vtkAMRDualGridHelperCommRequestList;
+  this->PendingHackLevelFlag = hackLevelFlag;
+  this->PostDegenerateRegionsCommMPIAsynchronous(
+    *this->PendingSendList, *this->PendingReceiveList);
+  this->PendingPostTime = vtkTimerLog::GetUniversalTime();
+  this->PendingHelperTime = 0.0;
+}
+
+//-----------------------------------------------------------------------------
+// Copies one received message into its blocks.  When wait is false, returns
+// without waiting if no message has arrived.
+void vtkAMRDualGridHelper::UnmarshalDegenerateRegionRequest(
+  vtkAMRDualGridHelperCommRequestList& receiveList, bool wait, bool hackLevelFlag)
+{
+  vtkAMRDualGridHelperCommRequest request;
+  if (!wait)
+  {
+    if (!receiveList.TestAny(request))
+    {
+      return;
+    }
+  }
+  else
+  {
+    double startTime = vtkTimerLog::GetUniversalTime();
+    request = receiveList.WaitAny();
+    this->WaitTime += vtkTimerLog::GetUniversalTime() - startTime;
+  }
+  vtkCharArray* recvBuffer = vtkCharArray::SafeDownCast(request.Buffer);
+  this->UnmarshalDegenerateRegionMessage(recvBuffer->GetPointer(0),
+    recvBuffer->GetNumberOfTuples(), request.SendProcess, hackLevelFlag);
 }
 
 #endif // VTK_AMR_DUAL_GRID_USE_MPI_ASYNCHRONOUS
@@ -2380,7 +2624,9 @@ int vtkAMRDualGridHelper::SetupData(vtkNonOverlappingAMR* input, const char* arr
   this->AssignSharedRegions();
 
   // Copy regions on level boundaries between processes.
-  this->ProcessRegionRemoteCopyQueue(false);
+  this->FinishRegionRemoteCopyQueue();
+  this->ResetCommunicationStatistics();
+  this->StartRegionRemoteCopyQueue(false);
 
   // Setup faces for seeding connectivity between blocks.
   // this->CreateFaces();
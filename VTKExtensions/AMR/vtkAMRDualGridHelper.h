@@ -87,6 +87,22 @@ public:
   vtkBooleanMacro(EnableAsynchronousCommunication, int);
   //@}
 
+  //@{
+  /**
+   * When this option is on and asynchronous communication is used, SetupData
+   * only posts the messages copying degenerate regions between processes and
+   * returns.  Each message is then copied into the blocks as soon as it
+   * arrives, while the filter processes blocks.  Filters must call
+   * FinishRegionRemoteCopiesToBlock() before reading the ghost values of a
+   * block and FinishRegionRemoteCopyQueue() once all blocks are processed.
+   * The same applies to the exchanges started with
+   * StartRegionRemoteCopyQueue().  This is off by default.
+   */
+  vtkGetMacro(EnableOverlappedCommunication, int);
+  vtkSetMacro(EnableOverlappedCommunication, int);
+  vtkBooleanMacro(EnableOverlappedCommunication, int);
+  //@}
+
   //@{
   /**
    * The controller to use for communication.
@@ -131,10 +147,52 @@ public:
    * It sends and copies the regions into blocks.
    */
   void ProcessRegionRemoteCopyQueue(bool hackLevelFlag);
+  /**
+   * Like ProcessRegionRemoteCopyQueue(), but with overlapped communication
+   * this only posts the messages and returns.  They are then copied into the
+   * blocks by FinishRegionRemoteCopiesToBlock(),
+   * FinishRegionRemoteCopiesToLevel() and FinishRegionRemoteCopyQueue().
+   */
+  void StartRegionRemoteCopyQueue(bool hackLevelFlag);
   /**
    * Call this before adding regions to the queue.  It clears the queue.
    */
   void ClearRegionRemoteCopyQueue();
+
+  //@{
+  /**
+   * With overlapped communication, copy the messages that arrived into their
+   * blocks, then wait for the messages that are still needed by `block` (or
+   * by all the blocks of levels lower or equal to `level`).  These do nothing
+   * when no communication is pending.
+   */
+  void FinishRegionRemoteCopiesToBlock(vtkAMRDualGridHelperBlock* block);
+  void FinishRegionRemoteCopiesToLevel(int level);
+  //@}
+
+  /**
+   * With overlapped communication, wait for all the pending messages and copy
+   * them into their blocks.  This does nothing when no communication is
+   * pending.
+   */
+  void FinishRegionRemoteCopyQueue();
+
+  //@{
+  /**
+   * Statistics of the degenerate region copies between processes since the
+   * last call to SetupData: the bytes sent and received, the time spent
+   * marshaling and posting messages, waiting for messages, and copying
+   * received messages into blocks, and, with overlapped communication, the
+   * time the messages were in flight while the filter processed blocks.
+   * Times are in seconds.  They are also logged at the TRACE verbosity.
+   */
+  vtkGetMacro(NumberOfBytesSent, vtkIdType);
+  vtkGetMacro(NumberOfBytesReceived, vtkIdType);
+  vtkGetMacro(MarshalTime, double);
+  vtkGetMacro(WaitTime, double);
+  vtkGetMacro(UnmarshalTime, double);
+  vtkGetMacro(OverlappedTime, double);
+  //@}
   //@{
   /**
    * It is convenient to get this here.
@@ -207,6 +265,19 @@ private:
   void FinishDegenerateRegionsCommMPIAsynchronous(bool hackLevelFlag,
     vtkAMRDualGridHelperCommRequestList& sendList,
     vtkAMRDualGridHelperCommRequestList& receiveList);
+  void PostRegionRemoteCopyQueueMPIAsynchronous(bool hackLevelFlag);
+  void PostDegenerateRegionsCommMPIAsynchronous(vtkAMRDualGridHelperCommRequestList& sendList,
+    vtkAMRDualGridHelperCommRequestList& receiveList);
+  void UnmarshalDegenerateRegionRequest(
+    vtkAMRDualGridHelperCommRequestList& receiveList, bool wait, bool hackLevelFlag);
+
+  // Messages posted by StartRegionRemoteCopyQueue with overlapped
+  // communication, and whether they carry level masks.
+  vtkAMRDualGridHelperCommRequestList* PendingSendList;
+  vtkAMRDualGridHelperCommRequestList* PendingReceiveList;
+  bool PendingHackLevelFlag;
+  double PendingPostTime;
+  double PendingHelperTime;
 
   // Degenerate regions that span processes.  We keep them in a queue
   // to communicate and process all at once.
@@ -223,6 +294,16 @@ private:
   int SkipGhostCopy;
 
   int EnableAsynchronousCommunication;
+  int EnableOverlappedCommunication;
+
+  vtkIdType NumberOfBytesSent;
+  vtkIdType NumberOfBytesReceived;
+  double MarshalTime;
+  double WaitTime;
+  double UnmarshalTime;
+  double OverlappedTime;
+  void ResetCommunicationStatistics();
+  void LogCommunicationStatistics();
 
 private:
   vtkAMRDualGridHelper(const vtkAMRDualGridHelper&) = delete;
@@ -275,6 +356,10 @@ public:
   // We need to modify the ghost layers of level interfaces.
   unsigned char CopyFlag;
 
+  // Number of degenerate regions of this block still to be received
+  // from other processes (overlapped communication).
+  int PendingRemoteRegions;
+
   // We have to assign cells shared between blocks so only one
   // block will process them.  Faces, edges and corners have to be
   // considered separately (Extent does not work).
@@ -0,0 +1,155 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestCGNSCache.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Tests the least recently used eviction of vtkCGNSCache, alone and with a
+// memory budget shared by two caches.
+#include "vtkCGNSCache.h"
+#include "vtkDataArray.h"
+#include "vtkDoubleArray.h"
+#include "vtkSmartPointer.h"
+
+#define vtk_assert(x)                                                                              \
+  if (!(x))                                                                                        \
+  {                                                                                                \
+    cerr << "On line " << __LINE__ << " ERROR: Condition FAILED!! : " << #x << endl;               \
+    return EXIT_FAILURE;                                                                           \
+  }
+
+namespace
+{
+typedef CGNSRead::vtkCGNSCache<vtkDataArray> ArrayCache;
+
+// An array using `size` KiB.
+vtkSmartPointer<vtkDataArray> NewArray(unsigned long size)
+{
+  auto array = vtkSmartPointer<vtkDoubleArray>::New();
+  array->SetNumberOfTuples(128 * size);
+  array->Fill(0.0);
+  return array;
+}
+
+bool Has(ArrayCache& cache, const std::string& key)
+{
+  // Find() marks the object as used, only call it on objects that must be
+  // the most recently used afterward.
+  return cache.Find(key) != nullptr;
+}
+}
+
+int TestCGNSCache(int, char* [])
+{
+  // Entry-count limit: the least recently used object is evicted.
+  {
+    ArrayCache cache;
+    cache.SetCacheSizeLimit(2);
+    cache.Insert("a", NewArray(1));
+    cache.Insert("b", NewArray(1));
+    vtk_assert(Has(cache, "a"));
+    cache.Insert("c", NewArray(1));
+    vtk_assert(cache.GetNumberOfEvictions() == 1);
+    vtk_assert(!Has(cache, "b"));
+    vtk_assert(Has(cache, "a"));
+    vtk_assert(Has(cache, "c"));
+    vtk_assert(cache.GetMemorySize() == 2);
+  }
+
+  // Memory limit of a single cache.
+  {
+    CGNSRead::vtkCGNSCacheBudget budget;
+    budget.SetMemoryLimit(10);
+    ArrayCache cache;
+    cache.SetBudget(&budget);
+    cache.Insert("a", NewArray(4));
+    cache.Insert("b", NewArray(4));
+    vtk_assert(budget.GetMemorySize() == 8);
+    vtk_assert(Has(cache, "a"));
+    // "b" is the least recently used one.
+    cache.Insert("c", NewArray(4));
+    vtk_assert(cache.GetNumberOfEvictions() == 1);
+    vtk_assert(budget.GetMemorySize() == 8);
+    vtk_assert(!Has(cache, "b"));
+    vtk_assert(Has(cache, "a"));
+    vtk_assert(Has(cache, "c"));
+
+    // objects larger than the whole budget are not cached, nothing is evicted.
+    cache.Insert("big", NewArray(11));
+    vtk_assert(!Has(cache, "big"));
+    vtk_assert(cache.GetNumberOfEvictions() == 1);
+    vtk_assert(budget.GetMemorySize() == 8);
+
+    // lowering the limit evicts immediately.
+    budget.SetMemoryLimit(4);
+    vtk_assert(budget.GetMemorySize() == 4);
+    vtk_assert(!Has(cache, "a"));
+    vtk_assert(Has(cache, "c"));
+
+    cache.SetBudget(nullptr);
+    vtk_assert(budget.GetMemorySize() == 0);
+  }
+
+  // Budget shared by two caches: the least recently used object of both is
+  // evicted, whichever cache inserts.
+  {
+    CGNSRead::vtkCGNSCacheBudget budget;
+    budget.SetMemoryLimit(12);
+    ArrayCache points;
+    ArrayCache connectivity;
+    points.SetBudget(&budget);
+    connectivity.SetBudget(&budget);
+
+    points.Insert("p0", NewArray(4));
+    connectivity.Insert("c0", NewArray(2));
+    points.Insert("p1", NewArray(4));
+    connectivity.Insert("c1", NewArray(2));
+    vtk_assert(budget.GetMemorySize() == 12);
+    vtk_assert(points.GetMemorySize() == 8);
+    vtk_assert(connectivity.GetMemorySize() == 4);
+
+    // access order: c0, p1, c1, p0. p0 becomes the most recently used.
+    vtk_assert(Has(points, "p0"));
+
+    // connectivity needs 3 KiB: c0 then p1 are evicted, from both caches.
+    connectivity.Insert("c2", NewArray(3));
+    vtk_assert(connectivity.GetNumberOfEvictions() == 1);
+    vtk_assert(points.GetNumberOfEvictions() == 1);
+    vtk_assert(budget.GetMemorySize() == 9);
+    vtk_assert(points.GetMemorySize() == 4);
+    vtk_assert(connectivity.GetMemorySize() == 5);
+    vtk_assert(!Has(connectivity, "c0"));
+    vtk_assert(!Has(points, "p1"));
+
+    // access order: c1, p0, c2. points needs 4 KiB: c1 is evicted.
+    points.Insert("p2", NewArray(4));
+    vtk_assert(connectivity.GetNumberOfEvictions() == 2);
+    vtk_assert(points.GetNumberOfEvictions() == 1);
+    vtk_assert(budget.GetMemorySize() == 11);
+    vtk_assert(!Has(connectivity, "c1"));
+    vtk_assert(Has(points, "p0"));
+    vtk_assert(Has(connectivity, "c2"));
+    vtk_assert(Has(points, "p2"));
+
+    // destroying a cache gives its memory back to the budget.
+    {
+      ArrayCache other;
+      other.SetBudget(&budget);
+      other.Insert("o0", NewArray(1));
+      vtk_assert(budget.GetMemorySize() == 12);
+    }
+    vtk_assert(budget.GetMemorySize() == 11);
+    vtk_assert(points.GetNumberOfMisses() == 1);
+    vtk_assert(connectivity.GetNumberOfMisses() == 2);
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -77,6 +77,14 @@ int TestCGNSReaderMeshCaching(int argc, char* argv[])
 
   // Check Mesh Data pointer did not change between loadings
   vtk_assert(da == db);
+  vtk_assert(reader->GetNumberOfCacheHits() > 0);
+  vtk_assert(reader->GetNumberOfCacheEvictions() == 0);
+  vtk_assert(reader->GetCacheMemorySize() > 0);
+
+  // Disabling the caches must release their memory
+  reader->CacheMeshOff();
+  reader->CacheConnectivityOff();
+  vtk_assert(reader->GetCacheMemorySize() == 0);
   // Check that caching mesh implies lower loading time
   // vtk_assert(hot_timing < cold_timing);
   cout << "Expected timings: " << hot_timing << " < " << cold_timing << endl;
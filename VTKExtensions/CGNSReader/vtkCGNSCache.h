@@ -18,6 +18,10 @@
  *
  *     store an object in a container with its CGNS path key
  *
+ * The cache evicts the least recently used objects once the memory they use,
+ * as reported by `GetActualMemorySize()`, exceeds the limit of its
+ * vtkCGNSCacheBudget. Several caches may share the same budget, in which case
+ * the least recently used object of all of them is evicted first.
  *
  * @par Thanks:
  * Thanks to Mickael Philit
@@ -28,20 +32,126 @@
 
 #include "vtkSmartPointer.h"
 
+#include <algorithm>
+#include <cstdint>
 #include <iterator>
+#include <list>
 #include <sstream>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace CGNSRead
 {
-// No priority and no size limit right now
+class vtkCGNSCacheBudget;
+
+/**
+ * Interface used by vtkCGNSCacheBudget to evict objects from the caches
+ * sharing it.
+ */
+class vtkCGNSCacheBase
+{
+public:
+  virtual ~vtkCGNSCacheBase() = default;
+
+  /**
+   * Returns the access stamp of the least recently used object, 0 if empty.
+   */
+  virtual std::uint64_t GetLeastRecentAccess() const = 0;
+
+  /**
+   * Removes the least recently used object.
+   */
+  virtual void EvictLeastRecentlyUsed() = 0;
+};
+
+/**
+ * Memory limit, in KiB, shared by one or more caches. A limit of 0 means no
+ * limit.
+ */
+class vtkCGNSCacheBudget
+{
+public:
+  vtkCGNSCacheBudget() = default;
+
+  void SetMemoryLimit(unsigned long limit)
+  {
+    this->MemoryLimit = limit;
+    this->MakeRoom(0);
+  }
+  unsigned long GetMemoryLimit() const { return this->MemoryLimit; }
+
+  /**
+   * Memory used by the objects of all the caches, in KiB.
+   */
+  unsigned long GetMemorySize() const { return this->MemorySize; }
+
+  void Register(vtkCGNSCacheBase* cache) { this->Caches.push_back(cache); }
+  void Unregister(vtkCGNSCacheBase* cache)
+  {
+    this->Caches.erase(
+      std::remove(this->Caches.begin(), this->Caches.end(), cache), this->Caches.end());
+  }
+
+  /**
+   * Returns whether an object of `size` KiB may be stored at all.
+   */
+  bool CanStore(unsigned long size) const
+  {
+    return this->MemoryLimit == 0 || size <= this->MemoryLimit;
+  }
+
+  /**
+   * Evicts the least recently used objects of all the caches until `size` more
+   * KiB fit in the limit.
+   */
+  void MakeRoom(unsigned long size)
+  {
+    while (this->MemoryLimit != 0 && this->MemorySize + size > this->MemoryLimit)
+    {
+      vtkCGNSCacheBase* oldest = nullptr;
+      std::uint64_t oldestAccess = 0;
+      for (vtkCGNSCacheBase* cache : this->Caches)
+      {
+        const std::uint64_t access = cache->GetLeastRecentAccess();
+        if (access != 0 && (oldest == nullptr || access < oldestAccess))
+        {
+          oldest = cache;
+          oldestAccess = access;
+        }
+      }
+      if (oldest == nullptr)
+      {
+        break;
+      }
+      oldest->EvictLeastRecentlyUsed();
+    }
+  }
+
+  void Add(unsigned long size) { this->MemorySize += size; }
+  void Remove(unsigned long size) { this->MemorySize -= std::min(size, this->MemorySize); }
+
+  /**
+   * Returns a new access stamp, larger than all the previous ones.
+   */
+  std::uint64_t NextAccess() { return ++this->AccessCounter; }
+
+private:
+  vtkCGNSCacheBudget(const vtkCGNSCacheBudget&) = delete;
+  void operator=(const vtkCGNSCacheBudget&) = delete;
+
+  std::vector<vtkCGNSCacheBase*> Caches;
+  unsigned long MemoryLimit = 0;
+  unsigned long MemorySize = 0;
+  std::uint64_t AccessCounter = 0;
+};
 
 template <typename CacheDataType>
-class vtkCGNSCache
+class vtkCGNSCache : public vtkCGNSCacheBase
 {
 public:
   vtkCGNSCache();
+  ~vtkCGNSCache() override;
 
   vtkSmartPointer<CacheDataType> Find(const std::string& query);
 
@@ -49,19 +159,68 @@ public:
 
   void ClearCache();
 
+  //@{
+  /**
+   * Maximum number of objects in the cache, -1 (default) means no limit.
+   */
   void SetCacheSizeLimit(int size);
   int GetCacheSizeLimit();
+  //@}
+
+  /**
+   * Sets the memory budget of this cache, which may be shared with other
+   * caches. By default, the cache has its own budget without limit.
+   * Changing the budget clears the cache.
+   */
+  void SetBudget(vtkCGNSCacheBudget* budget);
+  vtkCGNSCacheBudget* GetBudget() { return this->Budget; }
+
+  //@{
+  /**
+   * Statistics of the cache since its creation.
+   */
+  std::uint64_t GetNumberOfHits() const { return this->NumberOfHits; }
+  std::uint64_t GetNumberOfMisses() const { return this->NumberOfMisses; }
+  std::uint64_t GetNumberOfEvictions() const { return this->NumberOfEvictions; }
+  //@}
+
+  /**
+   * Memory used by the objects of this cache, in KiB.
+   */
+  unsigned long GetMemorySize() const { return this->MemorySize; }
+
+  std::uint64_t GetLeastRecentAccess() const override;
+  void EvictLeastRecentlyUsed() override;
 
 private:
   vtkCGNSCache(const vtkCGNSCache&) = delete;
   void operator=(const vtkCGNSCache&) = delete;
 
-  typedef std::unordered_map<std::string, vtkSmartPointer<CacheDataType> > CacheMapper;
+  struct CacheEntry
+  {
+    vtkSmartPointer<CacheDataType> Data;
+    unsigned long MemorySize;
+    std::uint64_t LastAccess;
+    std::list<std::string>::iterator RecentUse;
+  };
+
+  typedef std::unordered_map<std::string, CacheEntry> CacheMapper;
   CacheMapper CacheData;
 
-  typename CacheMapper::iterator LastCacheAccess;
+  void Remove(typename CacheMapper::iterator iter);
+
+  // keys from the most to the least recently used.
+  std::list<std::string> RecentlyUsed;
 
   int cacheSizeLimit;
+
+  vtkCGNSCacheBudget OwnBudget;
+  vtkCGNSCacheBudget* Budget;
+  unsigned long MemorySize;
+
+  std::uint64_t NumberOfHits;
+  std::uint64_t NumberOfMisses;
+  std::uint64_t NumberOfEvictions;
 };
 
 template <typename CacheDataType>
@@ -69,13 +228,30 @@ vtkCGNSCache<CacheDataType>::vtkCGNSCache()
   : CacheData()
 {
   this->cacheSizeLimit = -1;
-  this->LastCacheAccess = CacheData.end();
+  this->Budget = &this->OwnBudget;
+  this->Budget->Register(this);
+  this->MemorySize = 0;
+  this->NumberOfHits = 0;
+  this->NumberOfMisses = 0;
+  this->NumberOfEvictions = 0;
+}
+
+template <typename CacheDataType>
+vtkCGNSCache<CacheDataType>::~vtkCGNSCache()
+{
+  this->ClearCache();
+  this->Budget->Unregister(this);
 }
 
 template <typename CacheDataType>
 void vtkCGNSCache<CacheDataType>::SetCacheSizeLimit(int size)
 {
   this->cacheSizeLimit = size;
+  while (this->cacheSizeLimit > 0 &&
+    this->CacheData.size() > static_cast<size_t>(this->cacheSizeLimit))
+  {
+    this->EvictLeastRecentlyUsed();
+  }
 }
 
 template <typename CacheDataType>
@@ -84,36 +260,106 @@ int vtkCGNSCache<CacheDataType>::GetCacheSizeLimit()
   return this->cacheSizeLimit;
 }
 
+template <typename CacheDataType>
+void vtkCGNSCache<CacheDataType>::SetBudget(vtkCGNSCacheBudget* budget)
+{
+  budget = budget ? budget : &this->OwnBudget;
+  if (budget != this->Budget)
+  {
+    this->ClearCache();
+    this->Budget->Unregister(this);
+    this->Budget = budget;
+    this->Budget->Register(this);
+  }
+}
+
 template <typename CacheDataType>
 vtkSmartPointer<CacheDataType> vtkCGNSCache<CacheDataType>::Find(const std::string& query)
 {
   typename CacheMapper::iterator iter;
   iter = this->CacheData.find(query);
   if (iter == this->CacheData.end())
+  {
+    ++this->NumberOfMisses;
     return vtkSmartPointer<CacheDataType>(nullptr);
-  this->LastCacheAccess = iter;
-  return iter->second;
+  }
+  ++this->NumberOfHits;
+  iter->second.LastAccess = this->Budget->NextAccess();
+  this->RecentlyUsed.splice(this->RecentlyUsed.begin(), this->RecentlyUsed, iter->second.RecentUse);
+  return iter->second.Data;
 }
 
 template <typename CacheDataType>
 void vtkCGNSCache<CacheDataType>::Insert(
   const std::string& key, const vtkSmartPointer<CacheDataType>& data)
 {
+  typename CacheMapper::iterator iter = this->CacheData.find(key);
+  if (iter != this->CacheData.end())
+  {
+    this->Remove(iter);
+  }
 
-  if (this->cacheSizeLimit > 0 &&
+  const unsigned long size = data ? data->GetActualMemorySize() : 0;
+  if (!this->Budget->CanStore(size))
+  {
+    // never evict everything for an object that does not fit anyway.
+    return;
+  }
+
+  // Make some room by removing the least recently used items
+  while (this->cacheSizeLimit > 0 &&
     this->CacheData.size() >= static_cast<size_t>(this->cacheSizeLimit))
   {
-    // Make some room by removing last accessed/inserted item
-    this->CacheData.erase(this->LastCacheAccess);
+    this->EvictLeastRecentlyUsed();
+  }
+  this->Budget->MakeRoom(size);
+
+  this->RecentlyUsed.push_front(key);
+  CacheEntry& entry = this->CacheData[key];
+  entry.Data = data;
+  entry.MemorySize = size;
+  entry.LastAccess = this->Budget->NextAccess();
+  entry.RecentUse = this->RecentlyUsed.begin();
+  this->MemorySize += size;
+  this->Budget->Add(size);
+}
+
+template <typename CacheDataType>
+std::uint64_t vtkCGNSCache<CacheDataType>::GetLeastRecentAccess() const
+{
+  if (this->RecentlyUsed.empty())
+  {
+    return 0;
+  }
+  return this->CacheData.find(this->RecentlyUsed.back())->second.LastAccess;
+}
+
+template <typename CacheDataType>
+void vtkCGNSCache<CacheDataType>::EvictLeastRecentlyUsed()
+{
+  if (!this->RecentlyUsed.empty())
+  {
+    this->Remove(this->CacheData.find(this->RecentlyUsed.back()));
+    ++this->NumberOfEvictions;
   }
-  this->CacheData[key] = data;
-  this->LastCacheAccess = this->CacheData.find(key);
+}
+
+template <typename CacheDataType>
+void vtkCGNSCache<CacheDataType>::Remove(typename CacheMapper::iterator iter)
+{
+  this->MemorySize -= iter->second.MemorySize;
+  this->Budget->Remove(iter->second.MemorySize);
+  this->RecentlyUsed.erase(iter->second.RecentUse);
+  this->CacheData.erase(iter);
 }
 
 template <typename CacheDataType>
 void vtkCGNSCache<CacheDataType>::ClearCache()
 {
+  this->Budget->Remove(this->MemorySize);
+  this->MemorySize = 0;
   this->CacheData.clear();
+  this->RecentlyUsed.clear();
 }
 }
 #endif // vtkCGNSCache_h
@@ -578,6 +578,10 @@ vtkCGNSReader::vtkCGNSReader()
   , MeshPointsCache()
   , ConnectivitiesCache()
 {
+  this->CacheBudget.SetMemoryLimit(1024 * 1024);
+  this->MeshPointsCache.SetBudget(&this->CacheBudget);
+  this->ConnectivitiesCache.SetBudget(&this->CacheBudget);
+
   this->FileName = NULL;
   this->LoadBndPatch = false;
   this->LoadMesh = true;
@@ -4678,6 +4682,13 @@ void vtkCGNSReader::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "CreateEachSolutionAsBlock: " << this->CreateEachSolutionAsBlock << endl;
   os << indent << "IgnoreFlowSolutionPointers: " << this->IgnoreFlowSolutionPointers << endl;
   os << indent << "DistributeBlocks: " << this->DistributeBlocks << endl;
+  os << indent << "CacheMesh: " << this->CacheMesh << endl;
+  os << indent << "CacheConnectivity: " << this->CacheConnectivity << endl;
+  os << indent << "CacheMemoryLimit: " << this->GetCacheMemoryLimit() << " MiB" << endl;
+  os << indent << "CacheMemorySize: " << this->GetCacheMemorySize() << " KiB" << endl;
+  os << indent << "NumberOfCacheHits: " << this->GetNumberOfCacheHits() << endl;
+  os << indent << "NumberOfCacheMisses: " << this->GetNumberOfCacheMisses() << endl;
+  os << indent << "NumberOfCacheEvictions: " << this->GetNumberOfCacheEvictions() << endl;
   os << indent << "Controller: " << this->Controller << endl;
 }
 
@@ -5011,6 +5022,44 @@ void vtkCGNSReader::SetCacheConnectivity(bool enable)
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkCGNSReader::SetCacheMemoryLimit(int limit)
+{
+  // changing the limit does not change the output, thus no Modified().
+  this->CacheBudget.SetMemoryLimit(static_cast<unsigned long>(std::max(limit, 0)) * 1024);
+}
+
+//----------------------------------------------------------------------------
+int vtkCGNSReader::GetCacheMemoryLimit()
+{
+  return static_cast<int>(this->CacheBudget.GetMemoryLimit() / 1024);
+}
+
+//----------------------------------------------------------------------------
+vtkTypeUInt64 vtkCGNSReader::GetNumberOfCacheHits()
+{
+  return this->MeshPointsCache.GetNumberOfHits() + this->ConnectivitiesCache.GetNumberOfHits();
+}
+
+//----------------------------------------------------------------------------
+vtkTypeUInt64 vtkCGNSReader::GetNumberOfCacheMisses()
+{
+  return this->MeshPointsCache.GetNumberOfMisses() + this->ConnectivitiesCache.GetNumberOfMisses();
+}
+
+//----------------------------------------------------------------------------
+vtkTypeUInt64 vtkCGNSReader::GetNumberOfCacheEvictions()
+{
+  return this->MeshPointsCache.GetNumberOfEvictions() +
+    this->ConnectivitiesCache.GetNumberOfEvictions();
+}
+
+//----------------------------------------------------------------------------
+unsigned long vtkCGNSReader::GetCacheMemorySize()
+{
+  return this->CacheBudget.GetMemorySize();
+}
+
 //==============================================================================
 #ifdef _WINDOWS
 #pragma warning(pop)
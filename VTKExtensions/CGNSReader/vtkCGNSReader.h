@@ -228,6 +228,28 @@ public:
   vtkGetMacro(CacheConnectivity, bool);
   vtkBooleanMacro(CacheConnectivity, bool);
 
+  //@{
+  /**
+   * Limit, in MiB, of the memory shared by the mesh points and connectivity
+   * caches. The least recently used objects of either cache are released
+   * first when the limit is exceeded. 0 means no limit. Default is 1024.
+   */
+  void SetCacheMemoryLimit(int limit);
+  int GetCacheMemoryLimit();
+  //@}
+
+  //@{
+  /**
+   * Statistics of the mesh points and connectivity caches: number of objects
+   * found or not found in the caches, number of objects released to honor
+   * the memory limit, and memory used by the caches in KiB.
+   */
+  vtkTypeUInt64 GetNumberOfCacheHits();
+  vtkTypeUInt64 GetNumberOfCacheMisses();
+  vtkTypeUInt64 GetNumberOfCacheEvictions();
+  unsigned long GetCacheMemorySize();
+  //@}
+
   //@{
   /**
    * Set/get the communication object used to relay a list of files
@@ -277,6 +299,7 @@ private:
   void operator=(const vtkCGNSReader&) = delete;
 
   CGNSRead::vtkCGNSMetaData* Internal;               // Metadata
+  CGNSRead::vtkCGNSCacheBudget CacheBudget;          // Memory shared by the caches
   CGNSRead::vtkCGNSCache<vtkPoints> MeshPointsCache; // Cache for the mesh points
   CGNSRead::vtkCGNSCache<vtkUnstructuredGrid>
     ConnectivitiesCache; // Cache for the mesh connectivities
@@ -13,8 +13,12 @@
 
 =========================================================================*/
 
+#include "vtkCell.h"
+#include "vtkCellArray.h"
 #include "vtkCellData.h"
+#include "vtkCellType.h"
 #include "vtkConduitSource.h"
+#include "vtkDataArray.h"
 #include "vtkImageData.h"
 #include "vtkLogger.h"
 #include "vtkNew.h"
@@ -22,12 +26,15 @@
 #include "vtkRectilinearGrid.h"
 #include "vtkSmartPointer.h"
 #include "vtkStructuredGrid.h"
+#include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
 #include "vtkVector.h"
 #include "vtkVectorOperators.h"
 
 #include <conduit_blueprint.hpp>
 
+#include <algorithm>
+
 #define VERIFY(x, ...)                                                                             \
   if ((x) == false)                                                                                \
   {                                                                                                \
@@ -125,12 +132,245 @@ bool ValidateMeshTypeUnstructured()
   VERIFY(ug->GetCellData()->GetArray("field") != nullptr, "missing 'field' cell-data array");
   return true;
 }
+
+vtkUnstructuredGrid* GetUnstructuredGrid(vtkDataObject* data)
+{
+  auto pds = vtkPartitionedDataSet::SafeDownCast(data);
+  return pds && pds->GetNumberOfPartitions() == 1
+    ? vtkUnstructuredGrid::SafeDownCast(pds->GetPartition(0))
+    : nullptr;
+}
+
+// points of a strip of `numCells` cells along X.
+void CreateStripCoordinates(int numCells, conduit::Node& mesh)
+{
+  const int numPoints = (numCells + 1) * 4;
+  mesh["coordsets/coords/type"] = "explicit";
+  mesh["coordsets/coords/values/x"].set(conduit::DataType::float64(numPoints));
+  mesh["coordsets/coords/values/y"].set(conduit::DataType::float64(numPoints));
+  mesh["coordsets/coords/values/z"].set(conduit::DataType::float64(numPoints));
+  double* x = mesh["coordsets/coords/values/x"].as_float64_ptr();
+  double* y = mesh["coordsets/coords/values/y"].as_float64_ptr();
+  double* z = mesh["coordsets/coords/values/z"].as_float64_ptr();
+  for (int cc = 0; cc < numPoints; ++cc)
+  {
+    x[cc] = cc % (numCells + 1);
+    y[cc] = (cc / (numCells + 1)) % 2;
+    z[cc] = cc / (2 * (numCells + 1));
+  }
+}
+
+// a strip of alternating hexahedra and tetrahedra as a mixed topology.
+// `shapes` use VTK cell types when `vtkShapeIds` is true. Offsets have the
+// offset of the end of the last cell when `vtkOffsets` is true.
+void CreateMixedMesh(int numCells, bool vtkShapeIds, bool vtkOffsets, conduit::Node& mesh)
+{
+  CreateStripCoordinates(numCells, mesh);
+  auto point = [numCells](int i, int j, int k) { return i + (numCells + 1) * (j + 2 * k); };
+
+  auto& topology = mesh["topologies/mesh"];
+  topology["type"] = "unstructured";
+  topology["coordset"] = "coords";
+  auto& elements = topology["elements"];
+  elements["shape"] = "mixed";
+  elements["shape_map/hex"] = vtkShapeIds ? VTK_HEXAHEDRON : 0;
+  elements["shape_map/tet"] = vtkShapeIds ? VTK_TETRA : 1;
+  elements["shapes"].set(conduit::DataType::uint8(numCells));
+  elements["sizes"].set(conduit::DataType::int32(numCells));
+  elements["offsets"].set(conduit::DataType::int32(vtkOffsets ? numCells + 1 : numCells));
+  const int numHexes = (numCells + 1) / 2;
+  elements["connectivity"].set(conduit::DataType::int32(8 * numHexes + 4 * (numCells - numHexes)));
+
+  auto shapes = elements["shapes"].as_uint8_ptr();
+  auto sizes = elements["sizes"].as_int32_ptr();
+  auto offsets = elements["offsets"].as_int32_ptr();
+  auto connectivity = elements["connectivity"].as_int32_ptr();
+  int offset = 0;
+  for (int cc = 0; cc < numCells; ++cc)
+  {
+    offsets[cc] = offset;
+    if (cc % 2 == 0)
+    {
+      shapes[cc] = vtkShapeIds ? VTK_HEXAHEDRON : 0;
+      const int hex[8] = { point(cc, 0, 0), point(cc + 1, 0, 0), point(cc + 1, 1, 0),
+        point(cc, 1, 0), point(cc, 0, 1), point(cc + 1, 0, 1), point(cc + 1, 1, 1),
+        point(cc, 1, 1) };
+      std::copy(hex, hex + 8, connectivity + offset);
+      sizes[cc] = 8;
+    }
+    else
+    {
+      shapes[cc] = vtkShapeIds ? VTK_TETRA : 1;
+      const int tet[4] = { point(cc, 0, 0), point(cc + 1, 0, 0), point(cc, 1, 0),
+        point(cc, 0, 1) };
+      std::copy(tet, tet + 4, connectivity + offset);
+      sizes[cc] = 4;
+    }
+    offset += sizes[cc];
+  }
+  if (vtkOffsets)
+  {
+    offsets[numCells] = offset;
+  }
+}
+
+bool ValidateMeshTypeMixed()
+{
+  conduit::Node mesh;
+  CreateMixedMesh(5, /*vtkShapeIds=*/false, /*vtkOffsets=*/false, mesh);
+
+  auto data = Convert(mesh);
+  auto ug = GetUnstructuredGrid(data);
+  VERIFY(ug != nullptr, "incorrect data type, expected vtkPartitionedDataSet, got %s",
+    vtkLogIdentifier(data));
+  VERIFY(ug->GetNumberOfPoints() == 24, "incorrect number of points, expected 24, got %lld",
+    ug->GetNumberOfPoints());
+  VERIFY(ug->GetNumberOfCells() == 5, "incorrect number of cells, expected 5, got %lld",
+    ug->GetNumberOfCells());
+  VERIFY(ug->GetCellType(0) == VTK_HEXAHEDRON && ug->GetCellType(1) == VTK_TETRA &&
+      ug->GetCellType(4) == VTK_HEXAHEDRON,
+    "incorrect cell types");
+  VERIFY(ug->GetCell(3)->GetNumberOfPoints() == 4 && ug->GetCell(4)->GetNumberOfPoints() == 8,
+    "incorrect cell sizes");
+  VERIFY(ug->GetCells()->GetConnectivityArray()->GetVoidPointer(0) ==
+      mesh["topologies/mesh/elements/connectivity"].data_ptr(),
+    "connectivity was copied");
+  return true;
+}
+
+bool ValidateMeshTypePolyhedral()
+{
+  // two hexahedra, with 6 quadrilateral faces each.
+  conduit::Node mesh;
+  CreateStripCoordinates(2, mesh);
+  auto point = [](int i, int j, int k) { return i + 3 * (j + 2 * k); };
+
+  auto& topology = mesh["topologies/mesh"];
+  topology["type"] = "unstructured";
+  topology["coordset"] = "coords";
+  topology["elements/shape"] = "polyhedral";
+  topology["elements/connectivity"].set(conduit::DataType::int32(12));
+  topology["elements/sizes"].set(conduit::DataType::int32(2));
+  topology["elements/offsets"].set(conduit::DataType::int32(2));
+  topology["subelements/shape"] = "polygonal";
+  topology["subelements/connectivity"].set(conduit::DataType::int64(48));
+  topology["subelements/sizes"].set(conduit::DataType::int64(12));
+  topology["subelements/offsets"].set(conduit::DataType::int64(12));
+  auto faces = topology["subelements/connectivity"].as_int64_ptr();
+  for (int cc = 0; cc < 2; ++cc)
+  {
+    const int hexFaces[6][4] = {
+      { point(cc, 0, 0), point(cc, 1, 0), point(cc, 1, 1), point(cc, 0, 1) },
+      { point(cc + 1, 0, 0), point(cc + 1, 0, 1), point(cc + 1, 1, 1), point(cc + 1, 1, 0) },
+      { point(cc, 0, 0), point(cc, 0, 1), point(cc + 1, 0, 1), point(cc + 1, 0, 0) },
+      { point(cc, 1, 0), point(cc + 1, 1, 0), point(cc + 1, 1, 1), point(cc, 1, 1) },
+      { point(cc, 0, 0), point(cc + 1, 0, 0), point(cc + 1, 1, 0), point(cc, 1, 0) },
+      { point(cc, 0, 1), point(cc, 1, 1), point(cc + 1, 1, 1), point(cc + 1, 0, 1) }
+    };
+    for (int face = 0; face < 6; ++face)
+    {
+      topology["elements/connectivity"].as_int32_ptr()[6 * cc + face] = 6 * cc + face;
+      topology["subelements/sizes"].as_int64_ptr()[6 * cc + face] = 4;
+      topology["subelements/offsets"].as_int64_ptr()[6 * cc + face] = 4 * (6 * cc + face);
+      std::copy(hexFaces[face], hexFaces[face] + 4, faces + 4 * (6 * cc + face));
+    }
+    topology["elements/sizes"].as_int32_ptr()[cc] = 6;
+    topology["elements/offsets"].as_int32_ptr()[cc] = 6 * cc;
+  }
+
+  auto data = Convert(mesh);
+  auto ug = GetUnstructuredGrid(data);
+  VERIFY(ug != nullptr, "incorrect data type, expected vtkPartitionedDataSet, got %s",
+    vtkLogIdentifier(data));
+  VERIFY(ug->GetNumberOfCells() == 2, "incorrect number of cells, expected 2, got %lld",
+    ug->GetNumberOfCells());
+  VERIFY(ug->GetCellType(0) == VTK_POLYHEDRON && ug->GetCellType(1) == VTK_POLYHEDRON,
+    "incorrect cell types");
+  for (vtkIdType cc = 0; cc < 2; ++cc)
+  {
+    auto cell = ug->GetCell(cc);
+    VERIFY(cell->GetNumberOfPoints() == 8 && cell->GetNumberOfFaces() == 6,
+      "incorrect polyhedron %lld, expected 8 points and 6 faces, got %lld and %d", cc,
+      cell->GetNumberOfPoints(), cell->GetNumberOfFaces());
+  }
+  return true;
+}
+
+// a polygonal topology with offsets only, as Blueprint specifies them. The
+// last polygon is empty, so its offset is the size of the connectivity.
+bool ValidateMeshTypePolygonalEmptyLastCell()
+{
+  conduit::Node mesh;
+  CreateStripCoordinates(2, mesh);
+  auto& topology = mesh["topologies/mesh"];
+  topology["type"] = "unstructured";
+  topology["coordset"] = "coords";
+  topology["elements/shape"] = "polygonal";
+  const int connectivity[8] = { 0, 1, 4, 3, 1, 2, 5, 4 };
+  const int offsets[3] = { 0, 4, 8 };
+  topology["elements/connectivity"].set(connectivity, 8);
+  topology["elements/offsets"].set(offsets, 3);
+
+  auto data = Convert(mesh);
+  auto ug = GetUnstructuredGrid(data);
+  VERIFY(ug != nullptr, "incorrect data type, expected vtkPartitionedDataSet, got %s",
+    vtkLogIdentifier(data));
+  VERIFY(ug->GetNumberOfCells() == 3, "incorrect number of cells, expected 3, got %lld",
+    ug->GetNumberOfCells());
+  VERIFY(ug->GetCells()->GetCellSize(0) == 4 && ug->GetCells()->GetCellSize(1) == 4 &&
+      ug->GetCells()->GetCellSize(2) == 0,
+    "incorrect cell sizes");
+  return true;
+}
+
+// converts a large mixed mesh without sizes, with VTK offsets which end with
+// the size of the connectivity and with Blueprint offsets which do not. Checks
+// that the VTK arrays use the Conduit buffers, but for Blueprint offsets which
+// must be copied.
+bool ValidateZeroCopy()
+{
+  const int numCells = 1 << 20;
+  for (const bool vtkOffsets : { true, false })
+  {
+    conduit::Node mesh;
+    CreateMixedMesh(numCells, /*vtkShapeIds=*/true, vtkOffsets, mesh);
+    auto& elements = mesh["topologies/mesh/elements"];
+    elements.remove("sizes");
+    const char* layout = vtkOffsets ? "vtk offsets" : "blueprint offsets";
+
+    auto data = Convert(mesh);
+    auto ug = GetUnstructuredGrid(data);
+    VERIFY(ug != nullptr && ug->GetNumberOfCells() == numCells, "%s: incorrect conversion",
+      layout);
+    vtkDataArray* connectivity = ug->GetCells()->GetConnectivityArray();
+    vtkDataArray* offsets = ug->GetCells()->GetOffsetsArray();
+    VERIFY(connectivity->GetVoidPointer(0) == elements["connectivity"].data_ptr(),
+      "%s: connectivity was copied", layout);
+    VERIFY(ug->GetCellTypesArray()->GetVoidPointer(0) == elements["shapes"].data_ptr(),
+      "%s: cell types were copied", layout);
+    VERIFY((offsets->GetVoidPointer(0) == elements["offsets"].data_ptr()) == vtkOffsets,
+      "%s: offsets were %s", layout, vtkOffsets ? "copied" : "not copied");
+    VERIFY(offsets->GetNumberOfTuples() == numCells + 1 &&
+        offsets->GetComponent(numCells, 0) == connectivity->GetNumberOfTuples(),
+      "%s: incorrect end offset", layout);
+
+    const int* conduitOffsets = elements["offsets"].as_int32_ptr();
+    for (int cc = 0; cc < numCells; cc += 997)
+    {
+      VERIFY(offsets->GetComponent(cc, 0) == conduitOffsets[cc], "%s: incorrect offset %d",
+        layout, cc);
+    }
+  }
+  return true;
+}
 }
 
 int TestConduitSource(int, char* [])
 {
   return ValidateMeshTypeUniform() && ValidateMeshTypeRectilinear() &&
-      ValidateMeshTypeStructured() && ValidateMeshTypeUnstructured()
+      ValidateMeshTypeStructured() && ValidateMeshTypeUnstructured() &&
+      ValidateMeshTypeMixed() && ValidateMeshTypePolyhedral() &&
+      ValidateMeshTypePolygonalEmptyLastCell() && ValidateZeroCopy()
     ? EXIT_SUCCESS
     : EXIT_FAILURE;
 }
@@ -16,7 +16,9 @@
 
 #include "vtkArrayDispatch.h"
 #include "vtkCellArray.h"
+#include "vtkDataArrayRange.h"
 #include "vtkLogger.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkSOADataArrayTemplate.h"
 #include "vtkTypeFloat32Array.h"
@@ -201,6 +203,41 @@ conduit::index_t GetTypeId(conduit::index_t type, bool force_signed)
   }
 }
 
+//----------------------------------------------------------------------------
+// internal: fills the offsets expected by vtkCellArray, i.e. with the end of
+// the last cell, from Blueprint offsets or sizes.
+struct FillOffsetsImpl
+{
+  vtkIdType NumberOfCells;
+  vtkIdType ConnectivitySize;
+  bool FromSizes;
+
+  template <typename InputArrayT, typename OutputArrayT>
+  void operator()(InputArrayT* input, OutputArrayT* output)
+  {
+    using OutputValueT = vtk::GetAPIType<OutputArrayT>;
+    const auto in = vtk::DataArrayValueRange<1>(input, 0, this->NumberOfCells);
+    auto out = vtk::DataArrayValueRange<1>(output);
+    if (this->FromSizes)
+    {
+      OutputValueT offset = 0;
+      for (vtkIdType cc = 0; cc < this->NumberOfCells; ++cc)
+      {
+        out[cc] = offset;
+        offset += static_cast<OutputValueT>(in[cc]);
+      }
+    }
+    else
+    {
+      for (vtkIdType cc = 0; cc < this->NumberOfCells; ++cc)
+      {
+        out[cc] = static_cast<OutputValueT>(in[cc]);
+      }
+    }
+    out[this->NumberOfCells] = static_cast<OutputValueT>(this->ConnectivitySize);
+  }
+};
+
 } // internals
 
 vtkStandardNewMacro(vtkConduitArrayUtilities);
@@ -450,6 +487,105 @@ vtkSmartPointer<vtkCellArray> vtkConduitArrayUtilities::MCArrayToVTKCellArray(
   return cellArray;
 }
 
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkCellArray> vtkConduitArrayUtilities::O2MRelationToVTKCellArray(
+  const conduit_node* c_o2mrelation, const std::string& leafname, vtkIdType numberOfCells)
+{
+  const conduit::Node& o2mrelation = (*conduit::cpp_node(c_o2mrelation));
+  if (!o2mrelation.has_child(leafname) ||
+    (!o2mrelation.has_child("sizes") && !o2mrelation.has_child("offsets")))
+  {
+    vtkLogF(ERROR, "invalid o2mrelation, expected '%s' with 'sizes' or 'offsets'.",
+      leafname.c_str());
+    return nullptr;
+  }
+
+  vtkSmartPointer<vtkDataArray> connectivity = vtkConduitArrayUtilities::MCArrayToVTKArrayImpl(
+    conduit::c_node(&o2mrelation[leafname]), /*force_signed*/ true);
+  vtkSmartPointer<vtkDataArray> sizes = o2mrelation.has_child("sizes")
+    ? vtkConduitArrayUtilities::MCArrayToVTKArrayImpl(
+        conduit::c_node(&o2mrelation["sizes"]), /*force_signed*/ true)
+    : nullptr;
+  vtkSmartPointer<vtkDataArray> offsets = o2mrelation.has_child("offsets")
+    ? vtkConduitArrayUtilities::MCArrayToVTKArrayImpl(
+        conduit::c_node(&o2mrelation["offsets"]), /*force_signed*/ true)
+    : nullptr;
+  if (!connectivity || (o2mrelation.has_child("sizes") && !sizes) ||
+    (o2mrelation.has_child("offsets") && !offsets))
+  {
+    return nullptr;
+  }
+
+  if (!vtkArrayDownCast<vtkCellArray::ArrayType32>(connectivity) &&
+    !vtkArrayDownCast<vtkCellArray::ArrayType64>(connectivity))
+  {
+    // e.g. 8 or 16 bit integers, which vtkCellArray does not support.
+    vtkLogF(TRACE, "deep copying '%s' of type '%s'.", leafname.c_str(),
+      connectivity->GetClassName());
+    vtkNew<vtkCellArray::ArrayType64> copy;
+    copy->DeepCopy(connectivity);
+    connectivity = copy;
+  }
+
+  const vtkIdType connectivitySize = connectivity->GetNumberOfTuples();
+  // without sizes nor a known number of cells, offsets follow Blueprint: one
+  // offset per cell. The last cell may be empty, so an offset equal to the
+  // size of the connectivity is not the end offset.
+  vtkIdType numCells = numberOfCells;
+  if (sizes)
+  {
+    numCells = sizes->GetNumberOfTuples();
+  }
+  else if (numCells < 0)
+  {
+    numCells = offsets->GetNumberOfTuples();
+  }
+  if (numberOfCells >= 0 && numberOfCells != numCells)
+  {
+    vtkLogF(ERROR, "invalid o2mrelation, expected %lld cells, got %lld.",
+      static_cast<long long>(numberOfCells), static_cast<long long>(numCells));
+    return nullptr;
+  }
+
+  if (offsets && offsets->GetNumberOfTuples() == numCells + 1 &&
+    static_cast<vtkIdType>(offsets->GetComponent(numCells, 0)) == connectivitySize &&
+    offsets->GetDataType() == connectivity->GetDataType() &&
+    offsets->HasStandardMemoryLayout())
+  {
+    // offsets can be used as is.
+  }
+  else
+  {
+    if ((offsets ? offsets->GetNumberOfTuples() : sizes->GetNumberOfTuples()) < numCells)
+    {
+      vtkLogF(ERROR, "invalid o2mrelation, not enough offsets.");
+      return nullptr;
+    }
+
+    vtkSmartPointer<vtkDataArray> vtkOffsets;
+    vtkOffsets.TakeReference(connectivity->NewInstance());
+    vtkOffsets->SetNumberOfTuples(numCells + 1);
+
+    internals::FillOffsetsImpl worker{ numCells, connectivitySize, offsets == nullptr };
+    vtkDataArray* input = offsets ? offsets.GetPointer() : sizes.GetPointer();
+    using CellArrays = vtkTypeList::Create<vtkCellArray::ArrayType32, vtkCellArray::ArrayType64>;
+    using Dispatcher = vtkArrayDispatch::Dispatch2ByArray<internals::AOSArrays, CellArrays>;
+    if (!Dispatcher::Execute(input, vtkOffsets, worker))
+    {
+      worker(input, vtkOffsets.GetPointer());
+    }
+    offsets = vtkOffsets;
+  }
+
+  vtkNew<vtkCellArray> cellArray;
+  if (!cellArray->SetData(offsets, connectivity))
+  {
+    vtkLogF(ERROR, "failed to set cell array data.");
+    return nullptr;
+  }
+  return cellArray;
+}
+
 //----------------------------------------------------------------------------
 void vtkConduitArrayUtilities::PrintSelf(ostream& os, vtkIndent indent)
 {
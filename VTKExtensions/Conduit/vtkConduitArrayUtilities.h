@@ -65,6 +65,26 @@ public:
   static vtkSmartPointer<vtkCellArray> MCArrayToVTKCellArray(
     vtkIdType cellSize, const conduit_node* mcarray);
 
+  /**
+   * Converts an o2mrelation, i.e. a node with a `leafname` child and `sizes`
+   * and/or `offsets` children, to vtkCellArray. This is used for polygonal and
+   * mixed topologies.
+   *
+   * The `leafname` array is used without copying when its type matches the
+   * type expected by vtkCellArray, after reinterpreting unsigned arrays as
+   * signed arrays. vtkCellArray also needs the offset of the end of the last
+   * cell, which Blueprint offsets do not include. Thus, `offsets` are only used
+   * without copying if they have this extra value, i.e. when they have one more
+   * value than the number of cells, otherwise they are copied.
+   *
+   * The number of cells is the number of `sizes`. Without `sizes`, it is
+   * `numberOfCells` when known, e.g. the number of shapes of a mixed topology,
+   * or else the number of `offsets` as Blueprint specifies. Returns nullptr
+   * if `sizes` and `numberOfCells` disagree.
+   */
+  static vtkSmartPointer<vtkCellArray> O2MRelationToVTKCellArray(
+    const conduit_node* o2mrelation, const std::string& leafname, vtkIdType numberOfCells = -1);
+
   /**
    * If the number of components in the array does not match the target, a new
    * array is created.
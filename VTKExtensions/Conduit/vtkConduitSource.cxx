@@ -15,10 +15,13 @@
 #include "vtkConduitSource.h"
 
 #include "vtkCellArray.h"
+#include "vtkCellArrayIterator.h"
 #include "vtkConduitArrayUtilities.h"
 #include "vtkDataArray.h"
+#include "vtkDataArrayRange.h"
 #include "vtkDataSetAttributes.h"
 #include "vtkDoubleArray.h"
+#include "vtkIdTypeArray.h"
 #include "vtkImageData.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
@@ -33,6 +36,7 @@
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStringArray.h"
 #include "vtkStructuredGrid.h"
+#include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
 
 #include <conduit.hpp>
@@ -40,6 +44,9 @@
 #include <conduit_cpp_to_c.hpp>
 
 #include <algorithm>
+#include <utility>
+#include <vector>
+
 namespace internals
 {
 
@@ -85,6 +92,22 @@ int GetCellType(const std::string& shape)
   {
     return VTK_HEXAHEDRON;
   }
+  else if (shape == "pyramid")
+  {
+    return VTK_PYRAMID;
+  }
+  else if (shape == "wedge")
+  {
+    return VTK_WEDGE;
+  }
+  else if (shape == "polygonal")
+  {
+    return VTK_POLYGON;
+  }
+  else if (shape == "polyhedral")
+  {
+    return VTK_POLYHEDRON;
+  }
   else
   {
     throw std::runtime_error("unsupported shape " + shape);
@@ -106,6 +129,10 @@ static vtkIdType GetNumberOfPointsInCellType(int vtk_cell_type)
     case VTK_QUAD:
     case VTK_TETRA:
       return 4;
+    case VTK_PYRAMID:
+      return 5;
+    case VTK_WEDGE:
+      return 6;
     case VTK_HEXAHEDRON:
       return 8;
     default:
@@ -140,6 +167,129 @@ vtkSmartPointer<vtkPoints> CreatePoints(const conduit::Node& coords)
   return pts;
 }
 
+//----------------------------------------------------------------------------
+// internal: cell types of a mixed topology. `shapes` is used without copying
+// when it already holds VTK cell types, i.e. when `shape_map` maps each shape
+// to its VTK cell type and `shapes` are 8 bit integers.
+vtkSmartPointer<vtkUnsignedCharArray> CreateCellTypes(const conduit::Node& elements)
+{
+  std::vector<std::pair<vtkTypeInt64, unsigned char> > shapeMap;
+  bool vtkShapeIds = true;
+  auto iter = elements["shape_map"].children();
+  while (iter.has_next())
+  {
+    const vtkTypeInt64 shapeId = iter.next().to_int64();
+    const int cellType = GetCellType(iter.name());
+    if (cellType == VTK_POLYHEDRON)
+    {
+      throw std::runtime_error("polyhedral shapes are not supported in mixed topologies");
+    }
+    shapeMap.emplace_back(shapeId, static_cast<unsigned char>(cellType));
+    vtkShapeIds = vtkShapeIds && shapeId == cellType;
+  }
+
+  const auto& shapes = elements["shapes"];
+  const auto& dtype = shapes.dtype();
+  if (vtkShapeIds && (dtype.is_uint8() || dtype.is_int8()) && dtype.is_compact())
+  {
+    vtkNew<vtkUnsignedCharArray> cellTypes;
+    cellTypes->SetArray(static_cast<unsigned char*>(const_cast<void*>(shapes.element_ptr(0))),
+      static_cast<vtkIdType>(dtype.number_of_elements()), /*save=*/1);
+    return cellTypes;
+  }
+
+  auto shapeIds = vtkConduitArrayUtilities::MCArrayToVTKArray(&shapes);
+  if (shapeIds == nullptr)
+  {
+    throw std::runtime_error("failed to convert shapes to VTK array!");
+  }
+  vtkNew<vtkUnsignedCharArray> cellTypes;
+  cellTypes->SetNumberOfTuples(shapeIds->GetNumberOfTuples());
+  const auto ids = vtk::DataArrayValueRange<1>(shapeIds.GetPointer());
+  auto types = vtk::DataArrayValueRange<1>(cellTypes.GetPointer());
+  for (vtkIdType cc = 0, max = shapeIds->GetNumberOfTuples(); cc < max; ++cc)
+  {
+    const vtkTypeInt64 shapeId = static_cast<vtkTypeInt64>(ids[cc]);
+    auto found = std::find_if(shapeMap.begin(), shapeMap.end(),
+      [shapeId](const std::pair<vtkTypeInt64, unsigned char>& item) {
+        return item.first == shapeId;
+      });
+    if (found == shapeMap.end())
+    {
+      throw std::runtime_error("unknown shape id " + std::to_string(shapeId));
+    }
+    types[cc] = found->second;
+  }
+  return cellTypes;
+}
+
+//----------------------------------------------------------------------------
+// internal: converts a polyhedral topology to VTK polyhedra. Unlike other
+// topologies, VTK needs a face stream and the points of each polyhedron, so
+// these are copied.
+void SetPolyhedralCells(vtkUnstructuredGrid* ug, const conduit::Node& topologyNode)
+{
+  auto& subelements = topologyNode["subelements"];
+  const auto faceType = GetCellType(subelements["shape"].as_string());
+  auto faces = faceType == VTK_POLYGON
+    ? vtkConduitArrayUtilities::O2MRelationToVTKCellArray(&subelements, "connectivity")
+    : vtkConduitArrayUtilities::MCArrayToVTKCellArray(
+        GetNumberOfPointsInCellType(faceType), &subelements["connectivity"]);
+  auto polyhedra =
+    vtkConduitArrayUtilities::O2MRelationToVTKCellArray(&topologyNode["elements"], "connectivity");
+  if (faces == nullptr || polyhedra == nullptr)
+  {
+    throw std::runtime_error("failed to convert polyhedral topology!");
+  }
+
+  const vtkIdType numCells = polyhedra->GetNumberOfCells();
+  const vtkIdType numFaces = faces->GetNumberOfCells();
+  vtkNew<vtkUnsignedCharArray> cellTypes;
+  cellTypes->SetNumberOfTuples(numCells);
+  cellTypes->FillValue(VTK_POLYHEDRON);
+  vtkNew<vtkIdTypeArray> faceLocations;
+  faceLocations->SetNumberOfTuples(numCells);
+  vtkNew<vtkIdTypeArray> faceStream;
+  faceStream->Allocate(polyhedra->GetNumberOfConnectivityIds() * 5 + numCells);
+  vtkNew<vtkCellArray> cells;
+  cells->AllocateEstimate(numCells, 8);
+
+  std::vector<vtkIdType> cellPoints;
+  auto cellIter = vtk::TakeSmartPointer(polyhedra->NewIterator());
+  auto faceIter = vtk::TakeSmartPointer(faces->NewIterator());
+  for (cellIter->GoToFirstCell(); !cellIter->IsDoneWithTraversal(); cellIter->GoToNextCell())
+  {
+    vtkIdType numCellFaces;
+    const vtkIdType* faceIds;
+    cellIter->GetCurrentCell(numCellFaces, faceIds);
+    faceLocations->SetValue(cellIter->GetCurrentCellId(), faceStream->GetNumberOfValues());
+    faceStream->InsertNextValue(numCellFaces);
+    cellPoints.clear();
+    for (vtkIdType cc = 0; cc < numCellFaces; ++cc)
+    {
+      if (faceIds[cc] < 0 || faceIds[cc] >= numFaces)
+      {
+        throw std::runtime_error("invalid face id " + std::to_string(faceIds[cc]));
+      }
+      vtkIdType numFacePoints;
+      const vtkIdType* facePoints;
+      faceIter->GetCellAtId(faceIds[cc], numFacePoints, facePoints);
+      faceStream->InsertNextValue(numFacePoints);
+      for (vtkIdType pt = 0; pt < numFacePoints; ++pt)
+      {
+        faceStream->InsertNextValue(facePoints[pt]);
+        if (std::find(cellPoints.begin(), cellPoints.end(), facePoints[pt]) == cellPoints.end())
+        {
+          cellPoints.push_back(facePoints[pt]);
+        }
+      }
+    }
+    cells->InsertNextCell(static_cast<vtkIdType>(cellPoints.size()), cellPoints.data());
+  }
+  faceStream->Squeeze();
+  ug->SetCells(cellTypes, cells, faceLocations, faceStream);
+}
+
 //----------------------------------------------------------------------------
 vtkSmartPointer<vtkDataSet> GetMesh(
   const conduit::Node& topologyNode, const conduit::Node& coordsets)
@@ -185,8 +335,8 @@ vtkSmartPointer<vtkDataSet> GetMesh(
     rg->SetDimensions(
       xArray->GetNumberOfTuples(), yArray->GetNumberOfTuples(), zArray->GetNumberOfTuples());
     rg->SetXCoordinates(xArray);
-    rg->SetYCoordinates(xArray);
-    rg->SetZCoordinates(xArray);
+    rg->SetYCoordinates(yArray);
+    rg->SetZCoordinates(zArray);
     return rg;
   }
   else if (topologyNode["type"].as_string() == "structured" &&
@@ -206,10 +356,37 @@ vtkSmartPointer<vtkDataSet> GetMesh(
   {
     vtkNew<vtkUnstructuredGrid> ug;
     ug->SetPoints(CreatePoints(coords));
-    const auto vtk_cell_type = GetCellType(topologyNode["elements/shape"].as_string());
-    const auto cell_size = GetNumberOfPointsInCellType(vtk_cell_type);
-    auto cellArray = vtkConduitArrayUtilities::MCArrayToVTKCellArray(
-      cell_size, &topologyNode["elements/connectivity"]);
+    auto& elements = topologyNode["elements"];
+    const auto shape = elements["shape"].as_string();
+    if (shape == "mixed")
+    {
+      // there is one shape per cell, it tells if offsets end with the end offset.
+      auto cellTypes = CreateCellTypes(elements);
+      auto cellArray = vtkConduitArrayUtilities::O2MRelationToVTKCellArray(
+        &elements, "connectivity", cellTypes->GetNumberOfTuples());
+      if (cellArray == nullptr)
+      {
+        throw std::runtime_error("failed to convert mixed topology!");
+      }
+      ug->SetCells(cellTypes, cellArray);
+      return ug;
+    }
+
+    const auto vtk_cell_type = GetCellType(shape);
+    if (vtk_cell_type == VTK_POLYHEDRON)
+    {
+      SetPolyhedralCells(ug, topologyNode);
+      return ug;
+    }
+
+    auto cellArray = vtk_cell_type == VTK_POLYGON
+      ? vtkConduitArrayUtilities::O2MRelationToVTKCellArray(&elements, "connectivity")
+      : vtkConduitArrayUtilities::MCArrayToVTKCellArray(
+          GetNumberOfPointsInCellType(vtk_cell_type), &elements["connectivity"]);
+    if (cellArray == nullptr)
+    {
+      throw std::runtime_error("failed to convert connectivity!");
+    }
     ug->SetCells(vtk_cell_type, cellArray);
     return ug;
   }
@@ -0,0 +1,131 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestPVConcurrentLeavesHelper.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+=========================================================================*/
+// Tests that vtkPVConcurrentLeavesHelper rejects leaves that appear twice or
+// share points, coordinates or arrays.
+
+#include "vtkPVConcurrentLeavesHelper.h"
+
+#include "vtkCellData.h"
+#include "vtkDoubleArray.h"
+#include "vtkFieldData.h"
+#include "vtkHyperTreeGrid.h"
+#include "vtkImageData.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkRectilinearGrid.h"
+#include "vtkSmartPointer.h"
+#include "vtkTable.h"
+
+#include <vector>
+
+#define expect(x, msg)                                                                             \
+  if (!(x))                                                                                        \
+  {                                                                                                \
+    cerr << __LINE__ << ": " msg << endl;                                                          \
+    return EXIT_FAILURE;                                                                           \
+  }
+
+namespace
+{
+vtkSmartPointer<vtkDoubleArray> NewArray(const char* name, int numberOfTuples)
+{
+  auto array = vtkSmartPointer<vtkDoubleArray>::New();
+  array->SetName(name);
+  array->SetNumberOfTuples(numberOfTuples);
+  array->Fill(0);
+  return array;
+}
+
+vtkSmartPointer<vtkRectilinearGrid> NewRectilinearGrid()
+{
+  auto grid = vtkSmartPointer<vtkRectilinearGrid>::New();
+  grid->SetDimensions(2, 2, 2);
+  grid->SetXCoordinates(NewArray("x", 2));
+  grid->SetYCoordinates(NewArray("y", 2));
+  grid->SetZCoordinates(NewArray("z", 2));
+  return grid;
+}
+
+vtkSmartPointer<vtkPolyData> NewPolyData()
+{
+  vtkNew<vtkPoints> points;
+  points->SetNumberOfPoints(4);
+  auto pd = vtkSmartPointer<vtkPolyData>::New();
+  pd->SetPoints(points);
+  return pd;
+}
+
+bool CanProcess(const std::vector<vtkDataObject*>& leaves)
+{
+  return vtkPVConcurrentLeavesHelper::CanProcessConcurrently(leaves);
+}
+}
+
+int TestPVConcurrentLeavesHelper(int, char* [])
+{
+  // distinct leaves, null ones are skipped.
+  auto grid1 = NewRectilinearGrid();
+  auto grid2 = NewRectilinearGrid();
+  auto pd1 = NewPolyData();
+  auto pd2 = NewPolyData();
+  vtkNew<vtkImageData> img1;
+  vtkNew<vtkImageData> img2;
+  vtkNew<vtkTable> table;
+  table->AddColumn(NewArray("column", 3));
+  expect(CanProcess({ grid1, grid2, pd1, nullptr, pd2, img1, img2, table, nullptr }),
+    "distinct leaves should be processed concurrently.");
+
+  // a leaf without any array that appears twice.
+  expect(!CanProcess({ img1, img2, img1 }), "a repeated leaf should be detected.");
+  expect(!CanProcess({ grid1, grid1 }), "a repeated rectilinear grid should be detected.");
+
+  // rectilinear grids sharing a coordinate array.
+  auto grid3 = NewRectilinearGrid();
+  grid3->SetYCoordinates(grid1->GetYCoordinates());
+  expect(!CanProcess({ grid1, grid2, grid3 }), "shared coordinates should be detected.");
+
+  // point sets sharing their points or the data array of their points.
+  auto pd3 = NewPolyData();
+  pd3->SetPoints(pd1->GetPoints());
+  expect(!CanProcess({ pd1, pd3 }), "shared vtkPoints should be detected.");
+  auto pd4 = NewPolyData();
+  pd4->GetPoints()->SetData(pd2->GetPoints()->GetData());
+  expect(!CanProcess({ pd2, pd4 }), "shared points arrays should be detected.");
+
+  // attribute arrays shared between leaves.
+  auto values = NewArray("values", 8);
+  auto img3 = vtkSmartPointer<vtkImageData>::New();
+  img3->SetDimensions(2, 2, 2);
+  img3->GetPointData()->AddArray(values);
+  auto img4 = vtkSmartPointer<vtkImageData>::New();
+  img4->SetDimensions(2, 2, 2);
+  img4->GetPointData()->AddArray(values);
+  expect(!CanProcess({ img3, img4 }), "shared point arrays should be detected.");
+  auto grid4 = NewRectilinearGrid();
+  grid4->GetCellData()->AddArray(NewArray("cells", 1));
+  auto grid5 = NewRectilinearGrid();
+  grid5->GetCellData()->AddArray(grid4->GetCellData()->GetArray(0));
+  expect(!CanProcess({ grid4, grid5 }), "shared cell arrays should be detected.");
+  auto field = NewArray("field", 1);
+  img1->GetFieldData()->AddArray(field);
+  table->GetFieldData()->AddArray(field);
+  expect(!CanProcess({ img1, table }), "shared field arrays should be detected.");
+
+  // unsupported leaves.
+  vtkNew<vtkHyperTreeGrid> htg;
+  expect(!CanProcess({ img2, htg }), "hyper tree grids are not supported.");
+  return EXIT_SUCCESS;
+}
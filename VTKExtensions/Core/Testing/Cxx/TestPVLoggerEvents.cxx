@@ -0,0 +1,105 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestPVLoggerEvents.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Tests event recording with vtkPVLogger: nested scopes, payload sizes,
+// threads, ring buffer overflow and disabled recording.
+
+#include "vtkPVLogger.h"
+
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace
+{
+size_t Count(const std::string& str, const std::string& pattern)
+{
+  size_t count = 0;
+  for (size_t pos = str.find(pattern); pos != std::string::npos;
+       pos = str.find(pattern, pos + pattern.size()))
+  {
+    ++count;
+  }
+  return count;
+}
+
+std::string WriteEvents()
+{
+  std::ostringstream stream;
+  vtkPVLogger::WriteEvents(stream);
+  return stream.str();
+}
+
+bool Check(bool condition, const char* message, const std::string& events)
+{
+  if (!condition)
+  {
+    cerr << "ERROR: " << message << endl << events << endl;
+  }
+  return condition;
+}
+}
+
+int TestPVLoggerEvents(int, char* [])
+{
+  vtkPVLogger::SetEventRecording(true);
+  vtkPVLogger::ClearEvents();
+  {
+    PARAVIEW_LOG_EVENT_SCOPE(RENDERING, "still \"render\"");
+    for (int cc = 0; cc < 3; ++cc)
+    {
+      vtkPVLogger::EventScope scope(vtkPVLogger::DATA_MOVEMENT, "move-data");
+      scope.SetBytes(1024 * (cc + 1));
+    }
+  }
+  std::thread thread([]() { PARAVIEW_LOG_EVENT_SCOPE(PIPELINE, "update pipeline"); });
+  thread.join();
+
+  auto events = WriteEvents();
+  bool success = Check(events.find("\"traceEvents\":[") != std::string::npos &&
+      Count(events, "\"ph\":\"B\"") == 5 && Count(events, "\"ph\":\"E\"") == 5,
+    "expected 5 begin and end events.", events);
+  success &= Check(events.find("\"name\":\"still \\\"render\\\"\"") != std::string::npos,
+    "names must be escaped.", events);
+  success &= Check(events.find("\"args\":{\"bytes\":3072}") != std::string::npos &&
+      Count(events, "\"cat\":\"data-movement\"") == 6,
+    "missing data movement events.", events);
+  success &= Check(events.find("\"tid\":0,\"cat\":\"pipeline\"") == std::string::npos &&
+      Count(events, "\"cat\":\"pipeline\"") == 2,
+    "thread events must have their own thread id.", events);
+
+  // only the most recent events are kept, end events without their begin
+  // event are dropped.
+  vtkPVLogger::SetEventBufferSize(4);
+  {
+    PARAVIEW_LOG_EVENT_SCOPE(APPLICATION, "outer");
+    for (int cc = 0; cc < 3; ++cc)
+    {
+      PARAVIEW_LOG_EVENT_SCOPE(EXECUTION, "inner");
+    }
+  }
+  events = WriteEvents();
+  success &= Check(Count(events, "\"ph\":\"B\"") == 1 && Count(events, "\"ph\":\"E\"") == 1 &&
+      events.find("outer") == std::string::npos,
+    "incorrect events after overflow.", events);
+
+  vtkPVLogger::SetEventRecording(false);
+  vtkPVLogger::ClearEvents();
+  {
+    PARAVIEW_LOG_EVENT_SCOPE(CATALYST, "disabled");
+  }
+  events = WriteEvents();
+  success &= Check(Count(events, "\"ph\":") == 1, "events recorded while disabled.", events);
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
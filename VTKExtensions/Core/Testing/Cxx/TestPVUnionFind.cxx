@@ -0,0 +1,88 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestPVUnionFind.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+=========================================================================*/
+// Tests the union-find routines of vtkPVUnionFind against a naive labeling
+// of the same equivalences.
+
+#include "vtkPVUnionFind.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#define expect(x, msg)                                                                             \
+  if (!(x))                                                                                        \
+  {                                                                                                \
+    std::cerr << __LINE__ << ": " msg << std::endl;                                                \
+    return EXIT_FAILURE;                                                                           \
+  }
+
+int TestPVUnionFind(int, char* [])
+{
+  const int numMembers = 1000;
+  std::vector<int> parents(numMembers);
+  std::vector<int> labels(numMembers);
+  for (int ii = 0; ii < numMembers; ++ii)
+  {
+    parents[ii] = ii;
+    labels[ii] = ii;
+  }
+
+  std::mt19937 generator(42);
+  std::uniform_int_distribution<int> distribution(0, numMembers - 1);
+  for (int cc = 0; cc < 700; ++cc)
+  {
+    const int id1 = distribution(generator);
+    const int id2 = distribution(generator);
+    const int label1 = labels[id1];
+    const int label2 = labels[id2];
+    expect(vtkPVUnionFind::Union(parents.data(), id1, id2) == (label1 != label2),
+      "union should only merge different sets.");
+    // naive relabeling with the smallest label.
+    const int label = std::min(label1, label2);
+    for (int& value : labels)
+    {
+      if (value == label1 || value == label2)
+      {
+        value = label;
+      }
+    }
+  }
+
+  // roots are the smallest members, and members point to smaller members.
+  for (int ii = 0; ii < numMembers; ++ii)
+  {
+    expect(parents[ii] <= ii, "members should point to smaller members.");
+    expect(vtkPVUnionFind::Find(parents.data(), ii) == labels[ii], "incorrect root.");
+  }
+
+  // sets are numbered in the order of their smallest member.
+  std::vector<int> setIds(numMembers, -1);
+  int numberOfSets = 0;
+  for (int ii = 0; ii < numMembers; ++ii)
+  {
+    if (labels[ii] == ii)
+    {
+      setIds[ii] = numberOfSets++;
+    }
+  }
+  expect(vtkPVUnionFind::Resolve(parents.data(), numMembers) == numberOfSets,
+    "incorrect number of sets.");
+  for (int ii = 0; ii < numMembers; ++ii)
+  {
+    expect(parents[ii] == setIds[labels[ii]], "incorrect set id.");
+  }
+  return EXIT_SUCCESS;
+}
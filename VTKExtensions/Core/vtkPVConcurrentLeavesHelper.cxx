@@ -0,0 +1,102 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    vtkPVConcurrentLeavesHelper.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkPVConcurrentLeavesHelper.h"
+
+#include "vtkAbstractArray.h"
+#include "vtkCellData.h"
+#include "vtkDataSet.h"
+#include "vtkFieldData.h"
+#include "vtkHyperTreeGrid.h"
+#include "vtkPointData.h"
+#include "vtkPointSet.h"
+#include "vtkPoints.h"
+#include "vtkRectilinearGrid.h"
+#include "vtkTable.h"
+
+#include <unordered_set>
+
+//----------------------------------------------------------------------------
+bool vtkPVConcurrentLeavesHelper::CanProcessConcurrently(
+  const std::vector<vtkDataObject*>& leaves)
+{
+  std::unordered_set<vtkObject*> seen;
+  auto insert = [&seen](vtkObject* obj) { return obj == nullptr || seen.insert(obj).second; };
+  auto insertArrays = [&insert](vtkFieldData* fd) {
+    for (int cc = 0, max = (fd ? fd->GetNumberOfArrays() : 0); cc < max; ++cc)
+    {
+      if (!insert(fd->GetAbstractArray(cc)))
+      {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  for (vtkDataObject* dobj : leaves)
+  {
+    if (dobj == nullptr)
+    {
+      continue;
+    }
+    // the leaf itself, which may have no arrays.
+    if (!insert(dobj))
+    {
+      return false;
+    }
+    if (vtkTable* table = vtkTable::SafeDownCast(dobj))
+    {
+      if (!insertArrays(table->GetRowData()))
+      {
+        return false;
+      }
+    }
+    else if (vtkDataSet* ds = vtkDataSet::SafeDownCast(dobj))
+    {
+      if (vtkHyperTreeGrid::SafeDownCast(ds))
+      {
+        return false;
+      }
+      if (vtkPointSet* ps = vtkPointSet::SafeDownCast(ds))
+      {
+        vtkPoints* points = ps->GetPoints();
+        if (!insert(points) || (points && !insert(points->GetData())))
+        {
+          return false;
+        }
+      }
+      else if (vtkRectilinearGrid* rg = vtkRectilinearGrid::SafeDownCast(ds))
+      {
+        if (!insert(rg->GetXCoordinates()) || !insert(rg->GetYCoordinates()) ||
+          !insert(rg->GetZCoordinates()))
+        {
+          return false;
+        }
+      }
+      if (!insertArrays(ds->GetPointData()) || !insertArrays(ds->GetCellData()))
+      {
+        return false;
+      }
+    }
+    else
+    {
+      return false;
+    }
+    if (!insertArrays(dobj->GetFieldData()))
+    {
+      return false;
+    }
+  }
+  return true;
+}
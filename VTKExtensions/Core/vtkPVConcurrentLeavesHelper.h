@@ -0,0 +1,52 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    vtkPVConcurrentLeavesHelper.h
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkPVConcurrentLeavesHelper
+ * @brief   checks if the leaves of a composite dataset can be processed
+ * concurrently.
+ *
+ * Computing bounds and array ranges caches the results on the vtkPoints and
+ * vtkDataArray instances, and on the datasets themselves. Hence leaves that
+ * appear more than once, or that share points, coordinates or attribute
+ * arrays, must be processed serially. This is used by vtkPVDataInformation
+ * and vtkPVGeometryFilter before processing leaves with vtkSMPTools.
+ */
+
+#ifndef vtkPVConcurrentLeavesHelper_h
+#define vtkPVConcurrentLeavesHelper_h
+#ifndef __VTK_WRAP__
+
+#include "vtkPVVTKExtensionsCoreModule.h" // needed for export macro
+
+#include <vector> // for std::vector
+
+class vtkDataObject;
+
+class VTKPVVTKEXTENSIONSCORE_EXPORT vtkPVConcurrentLeavesHelper
+{
+public:
+  /**
+   * Returns true if none of the non-null leaves appears twice, and if they do
+   * not share any vtkPoints, points, rectilinear coordinates, point, cell, row
+   * or field data array. Only vtkDataSet and vtkTable leaves are supported,
+   * this returns false for other leaves and for vtkHyperTreeGrid.
+   */
+  static bool CanProcessConcurrently(const std::vector<vtkDataObject*>& leaves);
+};
+
+#endif
+#endif
+
+// VTK-HeaderTest-Exclude: vtkPVConcurrentLeavesHelper.h
@@ -14,11 +14,24 @@
 =========================================================================*/
 #include "vtkPVLogger.h"
 
+#include "vtkCommunicator.h"
+#include "vtkMultiProcessController.h"
 #include "vtkObjectFactory.h"
 
-#include <map>
+#include <vtksys/FStream.hxx>
 #include <vtksys/SystemTools.hxx>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
 namespace
 {
 static vtkLogger::Verbosity DefaultVerbosity = vtkLogger::VERBOSITY_TRACE;
@@ -79,6 +92,192 @@ static const int RenderingVerbosityKey = 4;
 static const int ApplicationVerbosityKey = 5;
 static const int ExecutionVerbosityKey = 6;
 static const int CatalystVerbosityKey = 7;
+
+//----------------------------------------------------------------------------
+// event recording.
+
+// fixed size record of an event.
+struct EventRecord
+{
+  vtkTypeInt64 Time; // in nanoseconds, since the first event
+  vtkTypeInt64 Bytes;
+  char Category;
+  char Phase; // 'B' or 'E'
+  char Name[46];
+};
+static_assert(sizeof(EventRecord) == 64, "unexpected EventRecord size");
+
+// ring buffer of the events of a thread.
+struct EventBuffer
+{
+  int Thread;
+  std::vector<EventRecord> Records;
+  vtkTypeUInt64 Count = 0;
+
+  EventBuffer(int thread, int size)
+    : Thread(thread)
+    , Records(static_cast<size_t>(size))
+  {
+  }
+
+  void Push(const EventRecord& record)
+  {
+    this->Records[this->Count % this->Records.size()] = record;
+    ++this->Count;
+  }
+};
+
+struct EventRegistry
+{
+  std::atomic<bool> Recording;
+  int BufferSize = 65536;
+  std::mutex Mutex;
+  std::vector<std::shared_ptr<EventBuffer> > Buffers;
+  const std::chrono::steady_clock::time_point Start = std::chrono::steady_clock::now();
+
+  EventRegistry()
+    : Recording(vtksys::SystemTools::GetEnv("PARAVIEW_LOG_EVENTS_FILE") != nullptr)
+  {
+  }
+
+  vtkTypeInt64 Now() const
+  {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - this->Start)
+      .count();
+  }
+};
+
+static EventRegistry& get_registry()
+{
+  static EventRegistry registry;
+  return registry;
+}
+
+static EventBuffer& get_buffer()
+{
+  thread_local std::shared_ptr<EventBuffer> buffer;
+  if (!buffer)
+  {
+    auto& registry = get_registry();
+    std::lock_guard<std::mutex> lock(registry.Mutex);
+    buffer = std::make_shared<EventBuffer>(
+      static_cast<int>(registry.Buffers.size()), registry.BufferSize);
+    registry.Buffers.push_back(buffer);
+  }
+  return *buffer;
+}
+
+static const char* get_category_name(int category)
+{
+  static const char* names[] = { "pipeline", "execution", "plugin", "data-movement", "rendering",
+    "application", "catalyst" };
+  return category >= 0 && category < 7 ? names[category] : "unknown";
+}
+
+// events of a thread, as serialized by `serialize_events`.
+struct SerializedEvent
+{
+  vtkTypeInt32 Thread;
+  EventRecord Record;
+};
+
+// serializes the events of all threads, oldest first, after the time used to
+// align the clocks of the ranks.
+static std::vector<char> serialize_events(vtkTypeInt64 reference)
+{
+  auto& registry = get_registry();
+  std::lock_guard<std::mutex> lock(registry.Mutex);
+  size_t count = 0;
+  for (const auto& buffer : registry.Buffers)
+  {
+    count += static_cast<size_t>(std::min<vtkTypeUInt64>(buffer->Count, buffer->Records.size()));
+  }
+
+  std::vector<char> result(sizeof(reference) + count * sizeof(SerializedEvent));
+  std::memcpy(result.data(), &reference, sizeof(reference));
+  char* ptr = result.data() + sizeof(reference);
+  for (const auto& buffer : registry.Buffers)
+  {
+    const vtkTypeUInt64 size = buffer->Records.size();
+    const vtkTypeUInt64 first = buffer->Count > size ? buffer->Count - size : 0;
+    for (vtkTypeUInt64 cc = first; cc < buffer->Count; ++cc)
+    {
+      const SerializedEvent event{ buffer->Thread, buffer->Records[cc % size] };
+      std::memcpy(ptr, &event, sizeof(event));
+      ptr += sizeof(event);
+    }
+  }
+  return result;
+}
+
+static void write_json_string(ostream& os, const char* str)
+{
+  os << '"';
+  for (; *str; ++str)
+  {
+    const unsigned char c = static_cast<unsigned char>(*str);
+    if (c == '"' || c == '\\')
+    {
+      os << '\\' << c;
+    }
+    else if (c < 0x20)
+    {
+      char escaped[8];
+      snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+      os << escaped;
+    }
+    else
+    {
+      os << c;
+    }
+  }
+  os << '"';
+}
+
+// writes the events of a rank, skipping end events whose begin event was
+// overwritten in the ring buffer.
+static void write_rank_events(
+  ostream& os, int rank, const char* data, size_t length, vtkTypeInt64 offset, bool& first)
+{
+  os << (first ? "" : ",\n") << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << rank
+     << ",\"tid\":0,\"args\":{\"name\":\"rank " << rank << "\"}}";
+  first = false;
+
+  std::map<int, int> depths;
+  char line[160];
+  for (size_t pos = 0; pos + sizeof(SerializedEvent) <= length; pos += sizeof(SerializedEvent))
+  {
+    SerializedEvent event;
+    std::memcpy(&event, data + pos, sizeof(event));
+    const EventRecord& record = event.Record;
+    int& depth = depths[event.Thread];
+    if (record.Phase == 'E' && depth == 0)
+    {
+      continue;
+    }
+    depth += record.Phase == 'B' ? 1 : -1;
+
+    const double ts = static_cast<double>(record.Time + offset) / 1000.0;
+    snprintf(line, sizeof(line),
+      ",\n{\"ph\":\"%c\",\"ts\":%.3f,\"pid\":%d,\"tid\":%d,\"cat\":\"%s\"", record.Phase, ts,
+      rank, static_cast<int>(event.Thread), get_category_name(record.Category));
+    os << line;
+    if (record.Phase == 'B')
+    {
+      char name[sizeof(record.Name) + 1];
+      std::memcpy(name, record.Name, sizeof(record.Name));
+      name[sizeof(record.Name)] = '\0';
+      os << ",\"name\":";
+      write_json_string(os, name);
+    }
+    if (record.Bytes >= 0)
+    {
+      os << ",\"args\":{\"bytes\":" << record.Bytes << "}";
+    }
+    os << "}";
+  }
+}
 }
 
 //----------------------------------------------------------------------------
@@ -236,6 +435,194 @@ void vtkPVLogger::SetCatalystVerbosity(vtkLogger::Verbosity value)
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkPVLogger::SetEventRecording(bool value)
+{
+  get_registry().Recording = value;
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVLogger::GetEventRecording()
+{
+  return get_registry().Recording;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVLogger::SetEventBufferSize(int numberOfEvents)
+{
+  auto& registry = get_registry();
+  std::lock_guard<std::mutex> lock(registry.Mutex);
+  registry.BufferSize = std::max(numberOfEvents, 1);
+  for (auto& buffer : registry.Buffers)
+  {
+    buffer->Records.assign(static_cast<size_t>(registry.BufferSize), EventRecord());
+    buffer->Count = 0;
+  }
+}
+
+//----------------------------------------------------------------------------
+int vtkPVLogger::GetEventBufferSize()
+{
+  auto& registry = get_registry();
+  std::lock_guard<std::mutex> lock(registry.Mutex);
+  return registry.BufferSize;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVLogger::BeginEvent(EventCategory category, const char* name, vtkTypeInt64 bytes)
+{
+  auto& registry = get_registry();
+  if (registry.Recording)
+  {
+    EventRecord record;
+    record.Time = registry.Now();
+    record.Bytes = bytes;
+    record.Category = static_cast<char>(category);
+    record.Phase = 'B';
+    std::strncpy(record.Name, name ? name : "", sizeof(record.Name) - 1);
+    record.Name[sizeof(record.Name) - 1] = '\0';
+    get_buffer().Push(record);
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkPVLogger::EndEvent(EventCategory category, vtkTypeInt64 bytes)
+{
+  auto& registry = get_registry();
+  if (registry.Recording)
+  {
+    EventRecord record;
+    record.Time = registry.Now();
+    record.Bytes = bytes;
+    record.Category = static_cast<char>(category);
+    record.Phase = 'E';
+    record.Name[0] = '\0';
+    get_buffer().Push(record);
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkPVLogger::ClearEvents()
+{
+  auto& registry = get_registry();
+  std::lock_guard<std::mutex> lock(registry.Mutex);
+  for (auto& buffer : registry.Buffers)
+  {
+    buffer->Count = 0;
+  }
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVLogger::WriteEvents(const std::string& filename, vtkMultiProcessController* controller)
+{
+  controller = controller ? controller : vtkMultiProcessController::GetGlobalController();
+  if (controller != nullptr && controller->GetLocalProcessId() != 0)
+  {
+    return vtkPVLogger::WriteEvents(cout, controller);
+  }
+
+  vtksys::ofstream file(filename.c_str(), ios::out);
+  if (!file)
+  {
+    vtkLogF(ERROR, "failed to open '%s' for writing events.", filename.c_str());
+    // still take part in the collective operation.
+    std::ostringstream discard;
+    vtkPVLogger::WriteEvents(discard, controller);
+    return false;
+  }
+  vtkLogF(INFO, "writing events to '%s'.", filename.c_str());
+  return vtkPVLogger::WriteEvents(file, controller) && !file.fail();
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVLogger::WriteEvents(ostream& os, vtkMultiProcessController* controller)
+{
+  controller = controller ? controller : vtkMultiProcessController::GetGlobalController();
+  const int numRanks = controller ? controller->GetNumberOfProcesses() : 1;
+  const int rank = controller ? controller->GetLocalProcessId() : 0;
+
+  // the clocks of the ranks are aligned at the end of this barrier.
+  if (numRanks > 1)
+  {
+    controller->Barrier();
+  }
+  const std::vector<char> events = serialize_events(get_registry().Now());
+
+  // shift the times of each rank so that all reference times match and the
+  // earliest event is at 0.
+  vtkTypeInt64 reference;
+  std::memcpy(&reference, events.data(), sizeof(vtkTypeInt64));
+  vtkTypeInt64 localEarliest = 0;
+  for (size_t pos = sizeof(vtkTypeInt64); pos + sizeof(SerializedEvent) <= events.size();
+       pos += sizeof(SerializedEvent))
+  {
+    SerializedEvent event;
+    std::memcpy(&event, events.data() + pos, sizeof(event));
+    localEarliest = std::min(localEarliest, event.Record.Time - reference);
+  }
+  vtkTypeInt64 earliest = localEarliest;
+  if (numRanks > 1)
+  {
+    controller->Reduce(&localEarliest, &earliest, 1, vtkCommunicator::MIN_OP, 0);
+  }
+
+  // the root streams the events of the other ranks one at a time, when it
+  // asks for them, so that it never holds more than the events of one rank.
+  const int eventsTag = 64208;
+  if (rank != 0)
+  {
+    int ready = 0;
+    controller->Receive(&ready, 1, 0, eventsTag);
+    const vtkIdType length = static_cast<vtkIdType>(events.size());
+    controller->Send(&length, 1, 0, eventsTag);
+    controller->Send(events.data(), length, 0, eventsTag);
+    return true;
+  }
+
+  os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+  bool first = true;
+  write_rank_events(os, 0, events.data() + sizeof(vtkTypeInt64),
+    events.size() - sizeof(vtkTypeInt64), -reference - earliest, first);
+  std::vector<char> rankEvents;
+  for (int cc = 1; cc < numRanks; ++cc)
+  {
+    int ready = 1;
+    controller->Send(&ready, 1, cc, eventsTag);
+    vtkIdType length = 0;
+    controller->Receive(&length, 1, cc, eventsTag);
+    rankEvents.resize(static_cast<size_t>(length));
+    controller->Receive(rankEvents.data(), length, cc, eventsTag);
+
+    vtkTypeInt64 rankReference;
+    std::memcpy(&rankReference, rankEvents.data(), sizeof(vtkTypeInt64));
+    write_rank_events(os, cc, rankEvents.data() + sizeof(vtkTypeInt64),
+      rankEvents.size() - sizeof(vtkTypeInt64), -rankReference - earliest, first);
+  }
+  os << "\n]}\n";
+  return true;
+}
+
+//----------------------------------------------------------------------------
+vtkPVLogger::EventScope::EventScope(EventCategory category, const char* name, vtkTypeInt64 bytes)
+  : Category(category)
+  , Bytes(bytes)
+  , Recording(vtkPVLogger::GetEventRecording())
+{
+  if (this->Recording)
+  {
+    vtkPVLogger::BeginEvent(category, name, bytes);
+  }
+}
+
+//----------------------------------------------------------------------------
+vtkPVLogger::EventScope::~EventScope()
+{
+  if (this->Recording)
+  {
+    vtkPVLogger::EndEvent(this->Category, this->Bytes);
+  }
+}
+
 //----------------------------------------------------------------------------
 void vtkPVLogger::PrintSelf(ostream& os, vtkIndent indent)
 {
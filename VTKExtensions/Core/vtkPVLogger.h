@@ -41,6 +41,27 @@
  * When not changed using the APIs or environment variables, all categories
  * default to vtkLogger::VERBOSITY_TRACE. To change the default used, use
  * `vtkPVLogger::SetDefaultVerbosity`.
+ *
+ * @section PVLoggerEvents Event recording
+ *
+ * Besides log messages, vtkPVLogger can record begin and end events of scopes
+ * on hot paths, with the category, the thread and optionally the size of the
+ * data processed, e.g.
+ *
+ * @code{cpp}
+ * PARAVIEW_LOG_EVENT_SCOPE(RENDERING, "still render");
+ * @endcode
+ *
+ * Events are stored as fixed size binary records in a ring buffer per thread,
+ * so the most recent events are kept when the buffer is full. When event
+ * recording is disabled, which is the default, a scope costs a single check.
+ * `WriteEvents` merges the events of all the ranks in a JSON file using the
+ * Chrome trace event format, which chrome://tracing and Perfetto can open.
+ *
+ * At runtime, users can record events by setting the environment variable
+ * `PARAVIEW_LOG_EVENTS_FILE` to the file to write when the process module is
+ * finalized. The process type, e.g. `client` or `server`, is inserted before
+ * the extension of the file name.
  */
 
 #ifndef vtkPVLogger_h
@@ -49,6 +70,10 @@
 #include "vtkLogger.h"
 #include "vtkPVVTKExtensionsCoreModule.h" // needed for export macro
 
+#include <string> // for std::string
+
+class vtkMultiProcessController;
+
 class VTKPVVTKEXTENSIONSCORE_EXPORT vtkPVLogger : public vtkLogger
 {
 public:
@@ -157,6 +182,97 @@ public:
   static vtkLogger::Verbosity GetDefaultVerbosity();
   static void SetDefaultVerbosity(vtkLogger::Verbosity value);
   //@}
+
+  /**
+   * Categories of recorded events.
+   */
+  enum EventCategory
+  {
+    PIPELINE = 0,
+    EXECUTION,
+    PLUGIN,
+    DATA_MOVEMENT,
+    RENDERING,
+    APPLICATION,
+    CATALYST
+  };
+
+  //@{
+  /**
+   * Enable or disable event recording.
+   *
+   * Default is false unless the environment variable
+   * `PARAVIEW_LOG_EVENTS_FILE` is set.
+   */
+  static void SetEventRecording(bool value);
+  static bool GetEventRecording();
+  //@}
+
+  //@{
+  /**
+   * Get/Set the number of events kept for each thread. Changing it discards
+   * the recorded events. Default is 65536, i.e. 4 MiB per thread.
+   */
+  static void SetEventBufferSize(int numberOfEvents);
+  static int GetEventBufferSize();
+  //@}
+
+  //@{
+  /**
+   * Records the beginning or the end of an event, if event recording is
+   * enabled. `bytes` is the size of the data processed, if known, and is
+   * negative otherwise. Names are truncated to 45 characters.
+   * `PARAVIEW_LOG_EVENT_SCOPE` is simpler to use.
+   */
+  static void BeginEvent(EventCategory category, const char* name, vtkTypeInt64 bytes = -1);
+  static void EndEvent(EventCategory category, vtkTypeInt64 bytes = -1);
+  //@}
+
+  /**
+   * Discards the recorded events. This must not be called while other threads
+   * record events.
+   */
+  static void ClearEvents();
+
+  //@{
+  /**
+   * Writes the events recorded by all the processes of `controller` in the
+   * Chrome trace event format. Each rank is a process of the trace. The clocks
+   * of the ranks are aligned at the end of a barrier.
+   *
+   * This is a collective operation, only the root process writes the file or
+   * the stream. It receives the events of the other ranks one rank at a time.
+   * The global controller is used if `controller` is null. This
+   * must not be called while other threads record events. Returns false if the
+   * file could not be written.
+   */
+  static bool WriteEvents(
+    const std::string& filename, vtkMultiProcessController* controller = nullptr);
+  static bool WriteEvents(ostream& os, vtkMultiProcessController* controller = nullptr);
+  //@}
+
+  /**
+   * Records the beginning of an event on construction and its end on
+   * destruction. The size of the data processed can be set, or updated, while
+   * the scope is alive.
+   */
+  class VTKPVVTKEXTENSIONSCORE_EXPORT EventScope
+  {
+  public:
+    EventScope(EventCategory category, const char* name, vtkTypeInt64 bytes = -1);
+    ~EventScope();
+
+    void SetBytes(vtkTypeInt64 bytes) { this->Bytes = bytes; }
+
+  private:
+    EventScope(const EventScope&) = delete;
+    void operator=(const EventScope&) = delete;
+
+    EventCategory Category;
+    vtkTypeInt64 Bytes;
+    bool Recording;
+  };
+
 protected:
   vtkPVLogger();
   ~vtkPVLogger() override;
@@ -235,4 +351,15 @@ private:
  * @endcode
  */
 #define PARAVIEW_LOG_CATALYST_VERBOSITY() vtkPVLogger::GetCatalystVerbosity()
+
+/**
+ * Macro to record an event for the current scope, under one of the
+ * vtkPVLogger::EventCategory categories, e.g.
+ *
+ * @code{cpp}
+ *  PARAVIEW_LOG_EVENT_SCOPE(PIPELINE, "update pipeline");
+ * @endcode
+ */
+#define PARAVIEW_LOG_EVENT_SCOPE(category, name)                                                   \
+  vtkPVLogger::EventScope vtkLogConcatenate(pv_event_scope_, __LINE__)(vtkPVLogger::category, name)
 #endif
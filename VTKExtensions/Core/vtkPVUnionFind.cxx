@@ -0,0 +1,118 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    vtkPVUnionFind.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkPVUnionFind.h"
+
+#include "vtkCommunicator.h"
+#include "vtkIntArray.h"
+#include "vtkMultiProcessController.h"
+
+#include <vector>
+
+//----------------------------------------------------------------------------
+int vtkPVUnionFind::Resolve(int* parents, int numberOfMembers)
+{
+  int count = 0;
+  for (int ii = 0; ii < numberOfMembers; ++ii)
+  {
+    const int parent = parents[ii];
+    if (parent == ii)
+    { // This is a new set.
+      parents[ii] = count;
+      ++count;
+    }
+    else
+    {
+      // Smaller members are resolved already, and parent < ii.
+      parents[ii] = parents[parent];
+    }
+  }
+  return count;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVUnionFind::AllReduce(vtkMultiProcessController* controller, vtkIntArray* parents, int tag)
+{
+  const int numProcs = controller ? controller->GetNumberOfProcesses() : 1;
+  if (numProcs <= 1)
+  {
+    return;
+  }
+  const int myProc = controller->GetLocalProcessId();
+
+  // Every process needs the same members.
+  int numMembers = static_cast<int>(parents->GetNumberOfTuples());
+  int globalNumMembers = 0;
+  controller->AllReduce(&numMembers, &globalNumMembers, 1, vtkCommunicator::MAX_OP);
+  for (int ii = numMembers; ii < globalNumMembers; ++ii)
+  {
+    parents->InsertNextValue(ii);
+  }
+  if (globalNumMembers == 0)
+  {
+    return;
+  }
+  int* ptr = parents->GetPointer(0);
+
+  // Process `myProc + step` is merged into `myProc` when myProc is a multiple
+  // of 2 * step.
+  std::vector<int> pairs;
+  for (int step = 1; step < numProcs; step *= 2)
+  {
+    if (myProc % (2 * step) != 0)
+    {
+      pairs.clear();
+      for (int ii = 0; ii < globalNumMembers; ++ii)
+      {
+        const int root = vtkPVUnionFind::Find(ptr, ii);
+        if (root != ii)
+        {
+          pairs.push_back(ii);
+          pairs.push_back(root);
+        }
+      }
+      int length = static_cast<int>(pairs.size());
+      controller->Send(&length, 1, myProc - step, tag);
+      if (length > 0)
+      {
+        controller->Send(pairs.data(), length, myProc - step, tag + 1);
+      }
+      break;
+    }
+    if (myProc + step < numProcs)
+    {
+      int length = 0;
+      controller->Receive(&length, 1, myProc + step, tag);
+      if (length > 0)
+      {
+        pairs.resize(length);
+        controller->Receive(pairs.data(), length, myProc + step, tag + 1);
+      }
+      for (int ii = 0; ii < length; ii += 2)
+      {
+        vtkPVUnionFind::Union(ptr, pairs[ii], pairs[ii + 1]);
+      }
+    }
+  }
+
+  if (myProc == 0)
+  {
+    // Point every member to its root, roots of smaller members are final.
+    for (int ii = 0; ii < globalNumMembers; ++ii)
+    {
+      ptr[ii] = ptr[ptr[ii]];
+    }
+  }
+  controller->Broadcast(ptr, globalNumMembers, 0);
+}
@@ -0,0 +1,102 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    vtkPVUnionFind.h
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkPVUnionFind
+ * @brief   union-find routines for equivalence sets.
+ *
+ * vtkPVUnionFind is a collection of routines implementing a union-find
+ * (disjoint sets) structure stored in an array of parents: member `i` points
+ * to `parents[i]`, and the members pointing to themselves are the roots of
+ * the sets. The root of a set is always its smallest member, hence every
+ * member points to itself or to a smaller member. Find() compresses the paths
+ * it follows, which makes finding and merging sets nearly constant time.
+ *
+ * These routines are shared by the equivalence sets used to merge fragments
+ * by connectivity filters, e.g. vtkEquivalenceSet and the material interface
+ * filter.
+ */
+
+#ifndef vtkPVUnionFind_h
+#define vtkPVUnionFind_h
+#ifndef __VTK_WRAP__
+
+#include "vtkPVVTKExtensionsCoreModule.h" // needed for export macro
+
+class vtkIntArray;
+class vtkMultiProcessController;
+
+class VTKPVVTKEXTENSIONSCORE_EXPORT vtkPVUnionFind
+{
+public:
+  /**
+   * Returns the root of the set of member `id`, i.e. its smallest member.
+   * Members on the path to the root are pointed closer to it.
+   */
+  static int Find(int* parents, int id)
+  {
+    while (parents[id] != id)
+    {
+      parents[id] = parents[parents[id]];
+      id = parents[id];
+    }
+    return id;
+  }
+
+  /**
+   * Merges the sets of members `id1` and `id2`. The root of the merged set
+   * is the smaller of the two roots. Returns false if the members were
+   * already in the same set.
+   */
+  static bool Union(int* parents, int id1, int id2)
+  {
+    id1 = vtkPVUnionFind::Find(parents, id1);
+    id2 = vtkPVUnionFind::Find(parents, id2);
+    if (id1 == id2)
+    {
+      return false;
+    }
+    if (id1 < id2)
+    {
+      parents[id2] = id1;
+    }
+    else
+    {
+      parents[id1] = id2;
+    }
+    return true;
+  }
+
+  /**
+   * Replaces the parent of every member by the id of its set. Sets are
+   * numbered sequentially in the order of their smallest member. Returns the
+   * number of sets.
+   */
+  static int Resolve(int* parents, int numberOfMembers);
+
+  /**
+   * Merges the sets of all the processes of `controller`. The arrays of all
+   * the processes are first extended to the largest number of members. Then
+   * processes are merged pairwise along a binary tree, in log2(number of
+   * processes) steps, each sending only its members that are not roots. The
+   * merged array is finally broadcast from process 0, with every member
+   * pointing to its root, so that all the processes hold the same sets.
+   */
+  static void AllReduce(vtkMultiProcessController* controller, vtkIntArray* parents, int tag);
+};
+
+#endif
+#endif
+
+// VTK-HeaderTest-Exclude: vtkPVUnionFind.h
@@ -14,6 +14,8 @@
 =========================================================================*/
 
 #include "vtkActor.h"
+#include "vtkCamera.h"
+#include "vtkColorTransferFunction.h"
 #include "vtkCompositePolyDataMapper2.h"
 #include "vtkMaskPoints.h"
 #include "vtkNew.h"
@@ -23,6 +25,7 @@
 #include "vtkRenderWindow.h"
 #include "vtkRenderWindowInteractor.h"
 #include "vtkRenderer.h"
+#include "vtkRendererCollection.h"
 #include "vtkSmartPointer.h"
 #include "vtkTestUtilities.h"
 #include "vtkThreshold.h"
@@ -175,4 +178,36 @@ inline HaloFinderTestVTKObjects SetupHaloFinderTest(int argc, char* argv[],
 
   return testObjects;
 }
+
+// Shows the particles in subhalos colored by subhalo.
+inline void ShowSubhalos(HaloFinderTestVTKObjects& to)
+{
+  to.onlyPointsInHalos->SetInputArrayToProcess(
+    0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS, "subhalo_tag");
+  to.onlyPointsInHalos->ThresholdByUpper(0.0);
+  to.onlyPointsInHalos->Update();
+
+  double range[2];
+  to.onlyPointsInHalos->GetOutput()->GetPointData()->GetArray("subhalo_tag")->GetRange(range);
+  to.onlyPointsInHalos->GetOutput()->GetPointData()->SetActiveScalars("subhalo_tag");
+
+  vtkNew<vtkColorTransferFunction> lut;
+  lut->AddRGBPoint(range[0], 59 / 255.0, 76 / 255.0, 192 / 255.0);
+  lut->AddRGBPoint(range[1], 180 / 255.0, 4 / 255.0, 38 / 255.0);
+  lut->SetColorSpaceToDiverging();
+
+  to.mapper->SetLookupTable(lut.GetPointer());
+  to.mapper->ScalarVisibilityOn();
+  to.mapper->SetInputArrayToProcess(
+    0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS, "subhalo_tag");
+  to.mapper->SelectColorArray("subhalo_tag");
+  to.mapper->InterpolateScalarsBeforeMappingOn();
+
+  vtkRenderer* ren = to.renWin->GetRenderers()->GetFirstRenderer();
+  vtkCamera* cam = ren->GetActiveCamera();
+  cam->SetPosition(39.8465, 33.3915, 99.8347);
+  cam->SetFocalPoint(25.1646, 47.1462, 107.878);
+  cam->SetViewUp(-0.526454, -0.77122, 0.357864);
+  ren->ResetCamera();
+}
 }
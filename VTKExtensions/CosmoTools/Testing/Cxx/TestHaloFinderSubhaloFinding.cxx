@@ -17,11 +17,8 @@
 
 #include "HaloFinderTestHelpers.h"
 
-#include "vtkCamera.h"
-#include "vtkColorTransferFunction.h"
 #include "vtkMPIController.h"
 #include "vtkRegressionTestImage.h"
-#include "vtkRendererCollection.h"
 
 namespace
 {
@@ -68,33 +65,7 @@ int runHaloFinderTest(int argc, char* argv[])
     return 0;
   }
 
-  to.onlyPointsInHalos->SetInputArrayToProcess(
-    0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS, "subhalo_tag");
-  to.onlyPointsInHalos->ThresholdByUpper(0.0);
-  to.onlyPointsInHalos->Update();
-
-  double range[2];
-  to.onlyPointsInHalos->GetOutput()->GetPointData()->GetArray("subhalo_tag")->GetRange(range);
-  to.onlyPointsInHalos->GetOutput()->GetPointData()->SetActiveScalars("subhalo_tag");
-
-  vtkNew<vtkColorTransferFunction> lut;
-  lut->AddRGBPoint(range[0], 59 / 255.0, 76 / 255.0, 192 / 255.0);
-  lut->AddRGBPoint(range[1], 180 / 255.0, 4 / 255.0, 38 / 255.0);
-  lut->SetColorSpaceToDiverging();
-
-  to.mapper->SetLookupTable(lut.GetPointer());
-  to.mapper->ScalarVisibilityOn();
-  to.mapper->SetInputArrayToProcess(
-    0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS, "subhalo_tag");
-  to.mapper->SelectColorArray("subhalo_tag");
-  to.mapper->InterpolateScalarsBeforeMappingOn();
-
-  vtkRenderer* ren = to.renWin->GetRenderers()->GetFirstRenderer();
-  vtkCamera* cam = ren->GetActiveCamera();
-  cam->SetPosition(39.8465, 33.3915, 99.8347);
-  cam->SetFocalPoint(25.1646, 47.1462, 107.878);
-  cam->SetViewUp(-0.526454, -0.77122, 0.357864);
-  ren->ResetCamera();
+  HaloFinderTestHelpers::ShowSubhalos(to);
 
   int retVal = vtkRegressionTestImage(to.renWin.GetPointer());
   if (retVal == vtkRegressionTester::DO_INTERACTOR)
@@ -0,0 +1,156 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestHaloFinderThreads.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Tests that the halo finder output does not depend on the number of SMP
+// threads: the FOF halo properties, the halo centers and the subhalos must be
+// bitwise identical with one thread and with several, and the subhalos must
+// match the baseline of TestHaloFinderSubhaloFinding in both cases.
+
+#include <vtk_mpi.h>
+
+#include "HaloFinderTestHelpers.h"
+
+#include "vtkDataArray.h"
+#include "vtkMPIController.h"
+#include "vtkPoints.h"
+#include "vtkRegressionTestImage.h"
+#include "vtkSMPTools.h"
+
+#include <cstring>
+
+namespace
+{
+const int NumberOfThreads = 4;
+
+bool SameArray(vtkDataArray* array, vtkDataArray* expected)
+{
+  if (!array || !expected || array->GetDataType() != expected->GetDataType() ||
+    array->GetNumberOfTuples() != expected->GetNumberOfTuples() ||
+    array->GetNumberOfComponents() != expected->GetNumberOfComponents())
+  {
+    return false;
+  }
+  const size_t size = static_cast<size_t>(array->GetNumberOfValues()) *
+    static_cast<size_t>(array->GetDataTypeSize());
+  return size == 0 || std::memcmp(array->GetVoidPointer(0), expected->GetVoidPointer(0), size) == 0;
+}
+
+bool SameOutput(vtkUnstructuredGrid* output, vtkUnstructuredGrid* expected, int port)
+{
+  if (output->GetNumberOfPoints() != expected->GetNumberOfPoints() ||
+    (expected->GetPoints() && !SameArray(output->GetPoints()->GetData(),
+                                expected->GetPoints()->GetData())))
+  {
+    std::cerr << "Output " << port << " has different points with " << NumberOfThreads
+              << " threads." << std::endl;
+    return false;
+  }
+  vtkPointData* pd = output->GetPointData();
+  vtkPointData* expectedPD = expected->GetPointData();
+  if (pd->GetNumberOfArrays() != expectedPD->GetNumberOfArrays())
+  {
+    std::cerr << "Output " << port << " has different arrays with " << NumberOfThreads
+              << " threads." << std::endl;
+    return false;
+  }
+  for (int cc = 0; cc < expectedPD->GetNumberOfArrays(); ++cc)
+  {
+    vtkDataArray* expectedArray = expectedPD->GetArray(cc);
+    if (!SameArray(pd->GetArray(expectedArray->GetName()), expectedArray))
+    {
+      std::cerr << "Array " << expectedArray->GetName() << " of output " << port
+                << " is different with " << NumberOfThreads << " threads." << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+bool SameOutputs(vtkPANLHaloFinder* haloFinder, vtkPANLHaloFinder* expected)
+{
+  for (int port = 0; port < expected->GetNumberOfOutputPorts(); ++port)
+  {
+    if (!SameOutput(haloFinder->GetOutput(port), expected->GetOutput(port), port))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+int runHaloFinderTest(int argc, char* argv[])
+{
+  // the subhalo finding extracts the particles of each large halo in buffers
+  // of the thread, it must match the baseline whatever the number of threads.
+  vtkSMPTools::Initialize(1);
+  auto serial =
+    HaloFinderTestHelpers::SetupHaloFinderTest(argc, argv, vtkPANLHaloFinder::NONE, true);
+  HaloFinderTestHelpers::ShowSubhalos(serial);
+  int retVal = vtkRegressionTestImage(serial.renWin.GetPointer());
+  if (!retVal)
+  {
+    std::cerr << "Subhalos do not match the baseline with 1 thread." << std::endl;
+    return 0;
+  }
+
+  vtkSMPTools::Initialize(NumberOfThreads);
+  auto threaded =
+    HaloFinderTestHelpers::SetupHaloFinderTest(argc, argv, vtkPANLHaloFinder::NONE, true);
+  HaloFinderTestHelpers::ShowSubhalos(threaded);
+  retVal = vtkRegressionTestImage(threaded.renWin.GetPointer());
+  if (!retVal)
+  {
+    std::cerr << "Subhalos do not match the baseline with " << NumberOfThreads << " threads."
+              << std::endl;
+    return 0;
+  }
+  if (!SameOutputs(threaded.haloFinder, serial.haloFinder))
+  {
+    return 0;
+  }
+
+  // the FOF properties are Kahan sums and the centers are found with buffers
+  // of the thread too.
+  vtkSMPTools::Initialize(1);
+  auto serialCenters = HaloFinderTestHelpers::SetupHaloFinderTest(
+    argc, argv, vtkPANLHaloFinder::MOST_BOUND_PARTICLE);
+  vtkSMPTools::Initialize(NumberOfThreads);
+  auto threadedCenters = HaloFinderTestHelpers::SetupHaloFinderTest(
+    argc, argv, vtkPANLHaloFinder::MOST_BOUND_PARTICLE);
+  if (!SameOutputs(threadedCenters.haloFinder, serialCenters.haloFinder))
+  {
+    return 0;
+  }
+
+  if (retVal == vtkRegressionTester::DO_INTERACTOR)
+  {
+    threaded.iren->Start();
+  }
+  return retVal;
+}
+}
+
+int TestHaloFinderThreads(int argc, char* argv[])
+{
+  MPI_Init(&argc, &argv);
+
+  vtkNew<vtkMPIController> controller;
+  controller->Initialize();
+  vtkMultiProcessController::SetGlobalController(controller.GetPointer());
+
+  int retVal = runHaloFinderTest(argc, argv);
+
+  controller->Finalize();
+  return !retVal;
+}
@@ -14,9 +14,12 @@
  =========================================================================*/
 #include "vtkPANLHaloFinder.h"
 
+#include "vtkAOSDataArrayTemplate.h"
+#include "vtkCellArray.h"
 #include "vtkCellType.h"
 #include "vtkDataArray.h"
 #include "vtkFloatArray.h"
+#include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
 #include "vtkIntArray.h"
 #include "vtkMultiBlockDataSet.h"
@@ -25,6 +28,8 @@
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPoints.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 #include "vtkTypeInt64Array.h"
 #include "vtkUnstructuredGrid.h"
 
@@ -36,7 +41,9 @@
 #include "Partition.h"
 #include "SubHaloFinder.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <vector>
 
 namespace
@@ -46,36 +53,33 @@ static const double GRAVITY_C = 43.015e-10;
 static const ID_T MBP_THRESHOLD = 100;
 static const ID_T MCP_THRESHOLD = 100;
 
+// Copy of the particles of one halo at a time. The buffers grow to the
+// largest halo extracted, each thread uses its own copy.
 class ExtractHalo
 {
 public:
-  ExtractHalo(int numHalos, int* haloCounts, cosmotk::FOFHaloProperties* fof)
+  ExtractHalo(int* haloCounts, cosmotk::FOFHaloProperties* fof)
   {
     this->size = 0;
     this->counts = haloCounts;
     this->fofProperties = fof;
-    int maxNumParticles = 0;
-    for (int i = 0; i < numHalos; ++i)
-    {
-      if (haloCounts[i] > maxNumParticles)
-      {
-        maxNumParticles = haloCounts[i];
-      }
-    }
-    this->actualIndex.resize(maxNumParticles);
-    this->xLoc.resize(maxNumParticles);
-    this->yLoc.resize(maxNumParticles);
-    this->zLoc.resize(maxNumParticles);
-    this->xVel.resize(maxNumParticles);
-    this->yVel.resize(maxNumParticles);
-    this->zVel.resize(maxNumParticles);
-    this->mass.resize(maxNumParticles);
-    this->id.resize(maxNumParticles);
   }
 
   void SetCurrentHalo(int haloIdx)
   {
     this->size = this->counts[haloIdx];
+    if (this->actualIndex.size() < static_cast<size_t>(this->size))
+    {
+      this->actualIndex.resize(this->size);
+      this->xLoc.resize(this->size);
+      this->yLoc.resize(this->size);
+      this->zLoc.resize(this->size);
+      this->xVel.resize(this->size);
+      this->yVel.resize(this->size);
+      this->zVel.resize(this->size);
+      this->mass.resize(this->size);
+      this->id.resize(this->size);
+    }
 
     fofProperties->extractInformation(haloIdx, &this->actualIndex[0], &this->xLoc[0],
       &this->yLoc[0], &this->zLoc[0], &this->xVel[0], &this->yVel[0], &this->zVel[0],
@@ -119,6 +123,101 @@ private:
   std::vector<POSVEL_T> mass;
   std::vector<ID_T> id;
 };
+
+// Kahan summation of the values of the particles of a halo, in the order and
+// precision used by cosmotk::FOFHaloProperties.
+class KahanSum
+{
+public:
+  explicit KahanSum(POSVEL_T first)
+    : Sum(first)
+    , Remainder(0.0)
+  {
+  }
+
+  void Add(POSVEL_T value)
+  {
+    const POSVEL_T v = value - this->Remainder;
+    const POSVEL_T w = this->Sum + v;
+    this->Remainder = (w - this->Sum) - v;
+    this->Sum = w;
+  }
+
+  POSVEL_T Sum;
+
+private:
+  POSVEL_T Remainder;
+};
+
+// Copies the single component `array` to `out`. Arrays of InputType values
+// are copied directly from their memory, others through the vtkDataArray API.
+template <typename InputType, typename OutputType>
+void CopyComponent(vtkDataArray* array, OutputType* out)
+{
+  const vtkIdType numValues = array->GetNumberOfTuples();
+  auto values = vtkAOSDataArrayTemplate<InputType>::FastDownCast(array);
+  if (values && values->GetNumberOfComponents() == 1)
+  {
+    const InputType* in = values->GetPointer(0);
+    vtkSMPTools::For(0, numValues, [&](vtkIdType begin, vtkIdType end) {
+      std::copy(in + begin, in + end, out + begin);
+    });
+    return;
+  }
+  vtkSMPTools::For(0, numValues, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      out[i] = static_cast<OutputType>(array->GetComponent(i, 0));
+    }
+  });
+}
+
+// Splits the coordinates of `points` into `x`, `y` and `z`.
+void CopyCoordinates(vtkPoints* points, POSVEL_T* x, POSVEL_T* y, POSVEL_T* z)
+{
+  const vtkIdType numPoints = points->GetNumberOfPoints();
+  auto coords = vtkAOSDataArrayTemplate<POSVEL_T>::FastDownCast(points->GetData());
+  if (coords)
+  {
+    const POSVEL_T* in = coords->GetPointer(0);
+    vtkSMPTools::For(0, numPoints, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        x[i] = in[3 * i];
+        y[i] = in[3 * i + 1];
+        z[i] = in[3 * i + 2];
+      }
+    });
+    return;
+  }
+  vtkSMPTools::For(0, numPoints, [&](vtkIdType begin, vtkIdType end) {
+    double point[3];
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      points->GetPoint(i, point);
+      x[i] = point[0];
+      y[i] = point[1];
+      z[i] = point[2];
+    }
+  });
+}
+
+// Results of the subhalo finder for one halo.
+struct SubhaloResults
+{
+  std::vector<int> count;
+  std::vector<POSVEL_T> mass;
+  std::vector<POSVEL_T> xPos;
+  std::vector<POSVEL_T> yPos;
+  std::vector<POSVEL_T> zPos;
+  std::vector<POSVEL_T> xCofMass;
+  std::vector<POSVEL_T> yCofMass;
+  std::vector<POSVEL_T> zCofMass;
+  std::vector<POSVEL_T> xVel;
+  std::vector<POSVEL_T> yVel;
+  std::vector<POSVEL_T> zVel;
+  std::vector<POSVEL_T> velDisp;
+};
 }
 
 class vtkPANLHaloFinder::vtkInternals
@@ -171,18 +270,83 @@ public:
     }
   }
 
-  void reserveForInputData(vtkIdType numPts)
+  void resizeForInputData(vtkIdType numPts)
+  {
+    this->xx.resize(numPts);
+    this->yy.resize(numPts);
+    this->zz.resize(numPts);
+    this->vx.resize(numPts);
+    this->vy.resize(numPts);
+    this->vz.resize(numPts);
+    this->tag.resize(numPts);
+  }
+
+  void resizeForHalos(int numHalos)
   {
-    if (numPts > 0 && this->xx.capacity() < static_cast<size_t>(numPts))
+    this->fofMass.resize(numHalos);
+    this->fofXPos.resize(numHalos);
+    this->fofYPos.resize(numHalos);
+    this->fofZPos.resize(numHalos);
+    this->fofXCofMass.resize(numHalos);
+    this->fofYCofMass.resize(numHalos);
+    this->fofZCofMass.resize(numHalos);
+    this->fofXVel.resize(numHalos);
+    this->fofYVel.resize(numHalos);
+    this->fofZVel.resize(numHalos);
+    this->fofVelDisp.resize(numHalos);
+  }
+
+  // Computes the mass, mean position, center of mass, mean velocity and
+  // velocity dispersion of a halo in a single traversal of its particles.
+  // The arithmetic matches the separate passes of cosmotk::FOFHaloProperties.
+  void computeFOFProperties(int halo, int first, int count, const int* haloList)
+  {
+    int p = first;
+    KahanSum massSum(this->mass[p]);
+    KahanSum xMassSum(this->xx[p] * this->mass[p]);
+    KahanSum yMassSum(this->yy[p] * this->mass[p]);
+    KahanSum zMassSum(this->zz[p] * this->mass[p]);
+    KahanSum xSum(this->xx[p]);
+    KahanSum ySum(this->yy[p]);
+    KahanSum zSum(this->zz[p]);
+    KahanSum vxSum(this->vx[p]);
+    KahanSum vySum(this->vy[p]);
+    KahanSum vzSum(this->vz[p]);
+    POSVEL_T particleDot = this->vx[p] * this->vx[p] + this->vy[p] * this->vy[p] +
+      this->vz[p] * this->vz[p];
+    for (p = haloList[p]; p != -1; p = haloList[p])
     {
-      this->xx.resize(numPts);
-      this->yy.resize(numPts);
-      this->zz.resize(numPts);
-      this->vx.resize(numPts);
-      this->vy.resize(numPts);
-      this->vz.resize(numPts);
-      this->tag.resize(numPts);
+      massSum.Add(this->mass[p]);
+      xMassSum.Add(this->xx[p] * this->mass[p]);
+      yMassSum.Add(this->yy[p] * this->mass[p]);
+      zMassSum.Add(this->zz[p] * this->mass[p]);
+      xSum.Add(this->xx[p]);
+      ySum.Add(this->yy[p]);
+      zSum.Add(this->zz[p]);
+      vxSum.Add(this->vx[p]);
+      vySum.Add(this->vy[p]);
+      vzSum.Add(this->vz[p]);
+      particleDot += this->vx[p] * this->vx[p] + this->vy[p] * this->vy[p] +
+        this->vz[p] * this->vz[p];
     }
+
+    const double totalMass = massSum.Sum;
+    this->fofMass[halo] = massSum.Sum;
+    this->fofXCofMass[halo] = static_cast<POSVEL_T>(xMassSum.Sum / totalMass);
+    this->fofYCofMass[halo] = static_cast<POSVEL_T>(yMassSum.Sum / totalMass);
+    this->fofZCofMass[halo] = static_cast<POSVEL_T>(zMassSum.Sum / totalMass);
+    this->fofXPos[halo] = static_cast<POSVEL_T>(static_cast<double>(xSum.Sum) / count);
+    this->fofYPos[halo] = static_cast<POSVEL_T>(static_cast<double>(ySum.Sum) / count);
+    this->fofZPos[halo] = static_cast<POSVEL_T>(static_cast<double>(zSum.Sum) / count);
+    const POSVEL_T xVel = static_cast<POSVEL_T>(static_cast<double>(vxSum.Sum) / count);
+    const POSVEL_T yVel = static_cast<POSVEL_T>(static_cast<double>(vySum.Sum) / count);
+    const POSVEL_T zVel = static_cast<POSVEL_T>(static_cast<double>(vzSum.Sum) / count);
+    this->fofXVel[halo] = xVel;
+    this->fofYVel[halo] = yVel;
+    this->fofZVel[halo] = zVel;
+    particleDot /= count;
+    const POSVEL_T haloDot = xVel * xVel + yVel * yVel + zVel * zVel;
+    this->fofVelDisp[halo] = static_cast<POSVEL_T>(std::sqrt((particleDot - haloDot) / 3.0));
   }
   void clear()
   {
@@ -273,11 +437,21 @@ int vtkPANLHaloFinder::RequestData(
 
   if (grid != NULL)
   {
+    this->Internal->resizeForInputData(grid->GetNumberOfPoints());
     this->ExtractDataArrays(grid, 0);
   }
   else
   {
-    this->Internal->reserveForInputData(multiBlock->GetNumberOfPoints());
+    vtkIdType numPoints = 0;
+    for (vtkIdType i = 0; i < multiBlock->GetNumberOfBlocks(); ++i)
+    {
+      vtkUnstructuredGrid* block = vtkUnstructuredGrid::SafeDownCast(multiBlock->GetBlock(i));
+      if (block != NULL)
+      {
+        numPoints += block->GetNumberOfPoints();
+      }
+    }
+    this->Internal->resizeForInputData(numPoints);
     vtkIdType pointsSoFar = 0;
     for (vtkIdType i = 0; i < multiBlock->GetNumberOfBlocks(); ++i)
     {
@@ -313,19 +487,20 @@ void vtkPANLHaloFinder::ExtractDataArrays(vtkUnstructuredGrid* input, vtkIdType
   vtkDataArray* id = pd->GetArray("id");
   assert(id);
   const vtkIdType numParticlesBefore = input->GetNumberOfPoints();
-  this->Internal->reserveForInputData(offset + numParticlesBefore);
-  double point[3];
-  for (vtkIdType i = 0; i < numParticlesBefore; ++i)
+  if (numParticlesBefore == 0)
   {
-    input->GetPoint(i, point);
-    this->Internal->xx[i + offset] = point[0];
-    this->Internal->yy[i + offset] = point[1];
-    this->Internal->zz[i + offset] = point[2];
-    this->Internal->vx[i + offset] = vx->GetTuple1(i);
-    this->Internal->vy[i + offset] = vy->GetTuple1(i);
-    this->Internal->vz[i + offset] = vz->GetTuple1(i);
-    this->Internal->tag[i + offset] = id->GetTuple1(i);
+    return;
   }
+  assert(static_cast<size_t>(offset + numParticlesBefore) <= this->Internal->xx.size());
+  // the halo finder redistributes and appends ghost particles to its own
+  // vectors, the input is copied in parallel and directly from the memory of
+  // arrays that already hold values of the halo finder's types.
+  CopyCoordinates(input->GetPoints(), &this->Internal->xx[offset], &this->Internal->yy[offset],
+    &this->Internal->zz[offset]);
+  CopyComponent<POSVEL_T>(vx, &this->Internal->vx[offset]);
+  CopyComponent<POSVEL_T>(vy, &this->Internal->vy[offset]);
+  CopyComponent<POSVEL_T>(vz, &this->Internal->vz[offset]);
+  CopyComponent<vtkTypeInt64>(id, &this->Internal->tag[offset]);
 }
 
 void vtkPANLHaloFinder::DistributeInput()
@@ -340,10 +515,8 @@ void vtkPANLHaloFinder::DistributeInput()
   particleDistribute.distributeGIOParticles();
   // with particles redistriubuted, number of them on current process may change
   const vtkIdType numParticlesAfter = this->Internal->xx.size();
-  for (vtkIdType i = 0; i < numParticlesAfter; ++i)
-  {
-    this->Internal->mass[i] = this->ParticleMass;
-  }
+  std::fill(this->Internal->mass.begin(), this->Internal->mass.begin() + numParticlesAfter,
+    static_cast<POSVEL_T>(this->ParticleMass));
   this->Internal->potential.resize(numParticlesAfter);
   this->Internal->mask.resize(numParticlesAfter);
 }
@@ -370,6 +543,7 @@ void vtkPANLHaloFinder::CreateGhostParticles()
 void vtkPANLHaloFinder::ExecuteHaloFinder(
   vtkUnstructuredGrid* allParticles, vtkUnstructuredGrid* fofProperties)
 {
+  delete this->Internal->haloFinder;
   this->Internal->haloFinder = new cosmotk::CosmoHaloFinderP();
   this->Internal->haloFinder->setParameters(
     "", this->RL, this->DeadSize, this->NP, this->PMin, this->BB, this->NMin);
@@ -379,6 +553,7 @@ void vtkPANLHaloFinder::ExecuteHaloFinder(
     &this->Internal->mask[0], &this->Internal->status[0]);
   this->Internal->haloFinder->executeHaloFinder();
   this->Internal->haloFinder->collectHalos(false);
+  delete this->Internal->fof;
   this->Internal->fof = new cosmotk::FOFHaloProperties();
   int numberOfFOFHalos = this->Internal->haloFinder->getNumberOfHalos();
   int* fofHalos = this->Internal->haloFinder->getHalos();
@@ -390,44 +565,64 @@ void vtkPANLHaloFinder::ExecuteHaloFinder(
     &this->Internal->yy[0], &this->Internal->zz[0], &this->Internal->vx[0], &this->Internal->vy[0],
     &this->Internal->vz[0], &this->Internal->mass[0], &this->Internal->potential[0],
     &this->Internal->tag[0], &this->Internal->mask[0], &this->Internal->status[0]);
-  this->Internal->fof->FOFHaloMass(&this->Internal->fofMass);
-  this->Internal->fof->FOFPosition(
-    &this->Internal->fofXPos, &this->Internal->fofYPos, &this->Internal->fofZPos);
-  this->Internal->fof->FOFCenterOfMass(
-    &this->Internal->fofXCofMass, &this->Internal->fofYCofMass, &this->Internal->fofZCofMass);
-  this->Internal->fof->FOFVelocity(
-    &this->Internal->fofXVel, &this->Internal->fofYVel, &this->Internal->fofZVel);
-  this->Internal->fof->FOFVelocityDispersion(&this->Internal->fofXVel, &this->Internal->fofYVel,
-    &this->Internal->fofZVel, &this->Internal->fofVelDisp);
+  // the properties are computed per halo in parallel, rather than with one
+  // serial pass over all the halos per property by FOFHaloProperties.
+  this->Internal->resizeForHalos(numberOfFOFHalos);
+  vtkSMPTools::For(0, numberOfFOFHalos, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType halo = begin; halo < end; ++halo)
+    {
+      this->Internal->computeFOFProperties(
+        static_cast<int>(halo), fofHalos[halo], fofHaloCount[halo], fofHaloList);
+    }
+  });
+
+  const vtkIdType numParticles = static_cast<vtkIdType>(this->Internal->xx.size());
   vtkNew<vtkPoints> points;
+  points->SetDataTypeToFloat();
+  points->SetNumberOfPoints(numParticles);
   allParticles->SetPoints(points.GetPointer());
   vtkNew<vtkFloatArray> velocityX;
   velocityX->SetName("vx");
-  velocityX->SetNumberOfTuples(this->Internal->xx.size());
+  velocityX->SetNumberOfTuples(numParticles);
   vtkNew<vtkFloatArray> velocityY;
   velocityY->SetName("vy");
-  velocityY->SetNumberOfTuples(this->Internal->xx.size());
+  velocityY->SetNumberOfTuples(numParticles);
   vtkNew<vtkFloatArray> velocityZ;
   velocityZ->SetName("vz");
-  velocityZ->SetNumberOfTuples(this->Internal->xx.size());
+  velocityZ->SetNumberOfTuples(numParticles);
   vtkNew<vtkTypeInt64Array> particleId;
   particleId->SetName("id");
-  particleId->SetNumberOfTuples(this->Internal->xx.size());
+  particleId->SetNumberOfTuples(numParticles);
   vtkNew<vtkTypeInt64Array> haloTags;
   haloTags->SetName("fof_halo_tag");
-  haloTags->SetNumberOfTuples(this->Internal->xx.size());
-
-  allParticles->Allocate(this->Internal->xx.size());
-  for (vtkIdType i = 0; static_cast<size_t>(i) < this->Internal->xx.size(); ++i)
-  {
-    points->InsertNextPoint(this->Internal->xx[i], this->Internal->yy[i], this->Internal->zz[i]);
-    velocityX->SetValue(i, this->Internal->vx[i]);
-    velocityY->SetValue(i, this->Internal->vy[i]);
-    velocityZ->SetValue(i, this->Internal->vz[i]);
-    particleId->SetValue(i, this->Internal->tag[i]);
-    haloTags->SetValue(i, this->Internal->haloFinder->getHaloIDForParticle(i));
-    allParticles->InsertNextCell(VTK_VERTEX, 1, &i);
-  }
+  haloTags->SetNumberOfTuples(numParticles);
+  vtkNew<vtkIdTypeArray> offsets;
+  offsets->SetNumberOfTuples(numParticles + 1);
+  vtkNew<vtkIdTypeArray> connectivity;
+  connectivity->SetNumberOfTuples(numParticles);
+
+  float* pointsPtr = vtkFloatArray::FastDownCast(points->GetData())->GetPointer(0);
+  vtkIdType* offsetsPtr = offsets->GetPointer(0);
+  vtkIdType* connectivityPtr = connectivity->GetPointer(0);
+  vtkSMPTools::For(0, numParticles, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      pointsPtr[3 * i] = this->Internal->xx[i];
+      pointsPtr[3 * i + 1] = this->Internal->yy[i];
+      pointsPtr[3 * i + 2] = this->Internal->zz[i];
+      velocityX->SetValue(i, this->Internal->vx[i]);
+      velocityY->SetValue(i, this->Internal->vy[i]);
+      velocityZ->SetValue(i, this->Internal->vz[i]);
+      particleId->SetValue(i, this->Internal->tag[i]);
+      haloTags->SetValue(i, this->Internal->haloFinder->getHaloIDForParticle(i));
+      offsetsPtr[i] = i;
+      connectivityPtr[i] = i;
+    }
+  });
+  offsetsPtr[numParticles] = numParticles;
+  vtkNew<vtkCellArray> cells;
+  cells->SetData(offsets, connectivity);
+  allParticles->SetCells(VTK_VERTEX, cells);
   allParticles->GetPointData()->AddArray(velocityX.GetPointer());
   allParticles->GetPointData()->AddArray(velocityY.GetPointer());
   allParticles->GetPointData()->AddArray(velocityZ.GetPointer());
@@ -497,26 +692,38 @@ void vtkPANLHaloFinder::ExecuteSubHaloFinder(
   std::vector<POSVEL_T> subRadius, subMass, subCenterOfMassX, subCenterOfMassY, subCenterOfMassZ,
     subAvgX, subAvgY, subAvgZ, subAvgVX, subAvgVY, subAvgVZ, subVelDisp;
 
-  std::vector<POSVEL_T> shX, shY, shZ, shVX, shVY, shVZ;
-  std::vector<ID_T> shTag, shHID, shID;
-
   vtkNew<vtkTypeInt64Array> subhaloId;
   subhaloId->SetName("subhalo_tag");
   subhaloId->SetNumberOfTuples(this->Internal->xx.size());
-  for (size_t i = 0; i < this->Internal->xx.size(); ++i)
-  {
-    subhaloId->SetValue(i, -1);
-  }
+  subhaloId->FillValue(-1);
+  vtkTypeInt64* subhaloIdPtr = subhaloId->GetPointer(0);
 
   int numberOfFOFHalos = this->Internal->haloFinder->getNumberOfHalos();
   int* fofHaloCount = this->Internal->haloFinder->getHaloCount();
-  ExtractHalo haloData(numberOfFOFHalos, fofHaloCount, this->Internal->fof);
-
+  std::vector<int> largeHalos;
   for (int halo = 0; halo < numberOfFOFHalos; ++halo)
   {
-    long particleCount = fofHaloCount[halo];
-    if (particleCount > this->MinFOFSubhaloSize)
+    if (fofHaloCount[halo] > this->MinFOFSubhaloSize)
+    {
+      largeHalos.push_back(halo);
+    }
+  }
+
+  // halos are processed in parallel, then their subhalos are appended in the
+  // order of the halos. Each particle belongs to a single halo, so the
+  // subhalo ids of the particles are written directly.
+  std::vector<SubhaloResults> results(largeHalos.size());
+  vtkSMPThreadLocal<ExtractHalo> threadHaloData(
+    ExtractHalo(fofHaloCount, this->Internal->fof));
+  const vtkIdType numberOfLargeHalos = static_cast<vtkIdType>(largeHalos.size());
+  vtkSMPTools::For(0, numberOfLargeHalos, 1, [&](vtkIdType begin, vtkIdType end) {
+    ExtractHalo& haloData = threadHaloData.Local();
+    std::vector<POSVEL_T> shX, shY, shZ, shVX, shVY, shVZ;
+    std::vector<ID_T> shTag, shHID, shID;
+    for (vtkIdType idx = begin; idx < end; ++idx)
     {
+      const int halo = largeHalos[idx];
+      SubhaloResults& result = results[idx];
       haloData.SetCurrentHalo(halo);
 
       cosmotk::SubHaloFinder subFinder;
@@ -530,62 +737,61 @@ void vtkPANLHaloFinder::ExecuteSubHaloFinder(
       int* fofSubHalos = subFinder.getSubhalos();
       int* fofSubHaloCount = subFinder.getSubhaloCount();
       int* fofSubHaloList = subFinder.getSubhaloList();
+      result.count.assign(fofSubHaloCount, fofSubHaloCount + numberOfSubHalos);
 
       cosmotk::FOFHaloProperties subhaloProperties;
       subhaloProperties.setHalos(numberOfSubHalos, fofSubHalos, fofSubHaloCount, fofSubHaloList);
       subhaloProperties.setParameters("", this->RL, this->DeadSize, this->BB);
       haloData.SetParticles(subhaloProperties);
 
-      std::vector<POSVEL_T> subhaloMass;
-      subhaloProperties.FOFHaloMass(&subhaloMass);
-
-      std::vector<POSVEL_T> subhaloXPos;
-      std::vector<POSVEL_T> subhaloYPos;
-      std::vector<POSVEL_T> subhaloZPos;
-      subhaloProperties.FOFPosition(&subhaloXPos, &subhaloYPos, &subhaloZPos);
-
-      std::vector<POSVEL_T> subhaloXCofMass;
-      std::vector<POSVEL_T> subhaloYCofMass;
-      std::vector<POSVEL_T> subhaloZCofMass;
-      subhaloProperties.FOFCenterOfMass(&subhaloXCofMass, &subhaloYCofMass, &subhaloZCofMass);
-
-      std::vector<POSVEL_T> subhaloXVel;
-      std::vector<POSVEL_T> subhaloYVel;
-      std::vector<POSVEL_T> subhaloZVel;
-      subhaloProperties.FOFVelocity(&subhaloXVel, &subhaloYVel, &subhaloZVel);
-
-      std::vector<POSVEL_T> subhaloVelDisp;
+      subhaloProperties.FOFHaloMass(&result.mass);
+      subhaloProperties.FOFPosition(&result.xPos, &result.yPos, &result.zPos);
+      subhaloProperties.FOFCenterOfMass(&result.xCofMass, &result.yCofMass, &result.zCofMass);
+      subhaloProperties.FOFVelocity(&result.xVel, &result.yVel, &result.zVel);
       subhaloProperties.FOFVelocityDispersion(
-        &subhaloXVel, &subhaloYVel, &subhaloZVel, &subhaloVelDisp);
-
-      for (int sidx = 0; sidx < numberOfSubHalos; ++sidx)
-      {
-        parentHaloTag.push_back(this->Internal->haloFinder->getHaloID(halo));
-        parentFOFCount.push_back(particleCount);
-        subHaloTag.push_back(sidx);
-        subCount.push_back(fofSubHaloCount[sidx]);
-        subMass.push_back(subhaloMass[sidx]);
-        subCenterOfMassX.push_back(subhaloXCofMass[sidx]);
-        subCenterOfMassY.push_back(subhaloYCofMass[sidx]);
-        subCenterOfMassZ.push_back(subhaloZCofMass[sidx]);
-        subAvgX.push_back(subhaloXPos[sidx]);
-        subAvgY.push_back(subhaloYPos[sidx]);
-        subAvgZ.push_back(subhaloZPos[sidx]);
-        subAvgVX.push_back(subhaloXVel[sidx]);
-        subAvgVY.push_back(subhaloYVel[sidx]);
-        subAvgVZ.push_back(subhaloZVel[sidx]);
-        subVelDisp.push_back(subhaloVelDisp[sidx]);
-      }
-
-      size_t pointsBefore = shX.size();
+        &result.xVel, &result.yVel, &result.zVel, &result.velDisp);
+
+      shX.clear();
+      shY.clear();
+      shZ.clear();
+      shVX.clear();
+      shVY.clear();
+      shVZ.clear();
+      shTag.clear();
+      shHID.clear();
+      shID.clear();
       subFinder.getSubhaloCosmoData(this->Internal->haloFinder->getHaloID(halo), shX, shY, shZ,
         shVX, shVY, shVZ, shTag, shHID, shID);
 
-      for (size_t i = 0; pointsBefore + i < shX.size(); ++i)
+      for (size_t i = 0; i < shID.size(); ++i)
       {
-        subhaloId->SetValue(haloData.GetActualIndex(i), shID[pointsBefore + i]);
+        subhaloIdPtr[haloData.GetActualIndex(i)] = shID[i];
       }
     }
+  });
+
+  for (size_t idx = 0; idx < largeHalos.size(); ++idx)
+  {
+    const int halo = largeHalos[idx];
+    const SubhaloResults& result = results[idx];
+    for (size_t sidx = 0; sidx < result.count.size(); ++sidx)
+    {
+      parentHaloTag.push_back(this->Internal->haloFinder->getHaloID(halo));
+      parentFOFCount.push_back(fofHaloCount[halo]);
+      subHaloTag.push_back(sidx);
+      subCount.push_back(result.count[sidx]);
+      subMass.push_back(result.mass[sidx]);
+      subCenterOfMassX.push_back(result.xCofMass[sidx]);
+      subCenterOfMassY.push_back(result.yCofMass[sidx]);
+      subCenterOfMassZ.push_back(result.zCofMass[sidx]);
+      subAvgX.push_back(result.xPos[sidx]);
+      subAvgY.push_back(result.yPos[sidx]);
+      subAvgZ.push_back(result.zPos[sidx]);
+      subAvgVX.push_back(result.xVel[sidx]);
+      subAvgVY.push_back(result.yVel[sidx]);
+      subAvgVZ.push_back(result.zVel[sidx]);
+      subVelDisp.push_back(result.velDisp[sidx]);
+    }
   }
 
   allParticles->GetPointData()->AddArray(subhaloId.GetPointer());
@@ -657,7 +863,9 @@ void vtkPANLHaloFinder::ExecuteSubHaloFinder(
 void vtkPANLHaloFinder::FindCenters(
   vtkUnstructuredGrid* allParticles, vtkUnstructuredGrid* fofProperties)
 {
-  if (this->CenterFindingMode == vtkPANLHaloFinder::NONE)
+  if (this->CenterFindingMode != MOST_BOUND_PARTICLE &&
+    this->CenterFindingMode != MOST_CONNECTED_PARTICLE &&
+    this->CenterFindingMode != HIST_CENTER_FINDING)
   {
     return;
   }
@@ -672,55 +880,59 @@ void vtkPANLHaloFinder::FindCenters(
   centers->SetNumberOfComponents(3);
   centers->SetNumberOfTuples(numberOfFOFHalos);
 
-  ExtractHalo haloData(numberOfFOFHalos, fofHaloCount, this->Internal->fof);
-  for (int halo = 0; halo < numberOfFOFHalos; ++halo)
-  {
-    haloData.SetCurrentHalo(halo);
-    cosmotk::HaloCenterFinder centerFinder;
-    haloData.SetParticles(centerFinder);
-    centerFinder.setParameters(this->BB, this->SmoothingLength, this->DistanceConvertFactor,
-      this->RL, this->NP, OmegaMatter, OmegaCB, this->Hubble, this->RedShift);
-    int centerIndex = -1;
-    if (this->CenterFindingMode == MOST_BOUND_PARTICLE)
+  // the centers of the halos are found in parallel, each thread extracting
+  // the particles of its halos in its own buffers.
+  float* centersPtr = centers->GetPointer(0);
+  vtkPoints* points = allParticles->GetPoints();
+  vtkSMPThreadLocal<ExtractHalo> threadHaloData(ExtractHalo(fofHaloCount, this->Internal->fof));
+  vtkSMPTools::For(0, numberOfFOFHalos, [&](vtkIdType begin, vtkIdType end) {
+    ExtractHalo& haloData = threadHaloData.Local();
+    for (vtkIdType halo = begin; halo < end; ++halo)
     {
-      float minPotential;
-      if (haloData.GetNumberOfParticlesInCurrentHalo() < MBP_THRESHOLD)
+      haloData.SetCurrentHalo(static_cast<int>(halo));
+      cosmotk::HaloCenterFinder centerFinder;
+      haloData.SetParticles(centerFinder);
+      centerFinder.setParameters(this->BB, this->SmoothingLength, this->DistanceConvertFactor,
+        this->RL, this->NP, OmegaMatter, OmegaCB, this->Hubble, this->RedShift);
+      int centerIndex = -1;
+      if (this->CenterFindingMode == MOST_BOUND_PARTICLE)
       {
-        centerIndex = centerFinder.mostBoundParticleN2(&minPotential);
+        float minPotential;
+        if (haloData.GetNumberOfParticlesInCurrentHalo() < MBP_THRESHOLD)
+        {
+          centerIndex = centerFinder.mostBoundParticleN2(&minPotential);
+        }
+        else
+        {
+          centerIndex = centerFinder.mostBoundParticleAStar(&minPotential);
+        }
       }
-      else
+      else if (this->CenterFindingMode == MOST_CONNECTED_PARTICLE)
       {
-        centerIndex = centerFinder.mostBoundParticleAStar(&minPotential);
+        if (haloData.GetNumberOfParticlesInCurrentHalo() < MCP_THRESHOLD)
+        {
+          centerIndex = centerFinder.mostConnectedParticleN2();
+        }
+        else
+        {
+          centerIndex = centerFinder.mostConnectedParticleChainMesh();
+        }
       }
-    }
-    else if (this->CenterFindingMode == MOST_CONNECTED_PARTICLE)
-    {
-      if (haloData.GetNumberOfParticlesInCurrentHalo() < MCP_THRESHOLD)
+      else
       {
-        centerIndex = centerFinder.mostConnectedParticleN2();
+        centerIndex = centerFinder.mostConnectedParticleHist();
       }
-      else
+      float* center = centersPtr + 3 * halo;
+      center[0] = center[1] = center[2] = 0.0;
+      if (centerIndex >= 0)
       {
-        centerIndex = centerFinder.mostConnectedParticleChainMesh();
+        double point[3];
+        points->GetPoint(haloData.GetActualIndex(centerIndex), point);
+        center[0] = point[0];
+        center[1] = point[1];
+        center[2] = point[2];
       }
     }
-    else if (this->CenterFindingMode == HIST_CENTER_FINDING)
-    {
-      centerIndex = centerFinder.mostConnectedParticleHist();
-    }
-    else
-    {
-      return;
-    }
-    float center[] = { 0.0, 0.0, 0.0 };
-    if (centerIndex >= 0)
-    {
-      double* point = allParticles->GetPoint(haloData.GetActualIndex(centerIndex));
-      center[0] = point[0];
-      center[1] = point[1];
-      center[2] = point[2];
-    }
-    centers->SetTypedTuple(halo, center);
-  }
+  });
   fofProperties->GetPointData()->AddArray(centers.GetPointer());
 }
@@ -0,0 +1,313 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestDistributedEquivalences.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Tests the resolution of equivalences spanning several ranks:
+// vtkPVUnionFind::AllReduce() and vtkPEquivalenceSet::ResolveEquivalences()
+// against a serial resolution of the equivalences of all the ranks, and
+// vtkMaterialInterfaceFilter, which merges the fragments of the ranks with
+// MergeGhostEquivalenceSets(), on blocks dealt to the ranks in turn.
+
+#include "vtkCellData.h"
+#include "vtkDataArray.h"
+#include "vtkIntArray.h"
+#include "vtkLogger.h"
+#include "vtkMPIController.h"
+#include "vtkMaterialInterfaceFilter.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkNonOverlappingAMR.h"
+#include "vtkPEquivalenceSet.h"
+#include "vtkPVUnionFind.h"
+#include "vtkPointData.h"
+#include "vtkPolyData.h"
+#include "vtkSmartPointer.h"
+#include "vtkUniformGrid.h"
+#include "vtkUnsignedCharArray.h"
+
+#include <cmath>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace
+{
+//----------------------------------------------------------------------------
+// Each rank has a different number of members. Rank `r` makes members `r` and
+// `r + 1` equivalent, so that members 0 to the number of ranks are only in the
+// same set once all the ranks are merged, and adds a few random equivalences.
+int NumberOfMembers(int rank)
+{
+  return 40 + 3 * rank;
+}
+
+std::vector<std::pair<int, int> > Equivalences(int rank, int numRanks)
+{
+  std::vector<std::pair<int, int> > pairs;
+  pairs.emplace_back(rank, rank + 1);
+  std::mt19937 generator(rank + 1);
+  std::uniform_int_distribution<int> distribution(numRanks + 1, NumberOfMembers(rank) - 1);
+  for (int cc = 0; cc < 8; ++cc)
+  {
+    pairs.emplace_back(distribution(generator), distribution(generator));
+  }
+  return pairs;
+}
+
+// Roots of the equivalences of all the ranks, resolved on a single rank.
+std::vector<int> SerialRoots(int numRanks)
+{
+  std::vector<int> parents(NumberOfMembers(numRanks - 1));
+  for (size_t ii = 0; ii < parents.size(); ++ii)
+  {
+    parents[ii] = static_cast<int>(ii);
+  }
+  for (int rank = 0; rank < numRanks; ++rank)
+  {
+    for (const auto& pair : Equivalences(rank, numRanks))
+    {
+      vtkPVUnionFind::Union(parents.data(), pair.first, pair.second);
+    }
+  }
+  for (size_t ii = 0; ii < parents.size(); ++ii)
+  {
+    parents[ii] = vtkPVUnionFind::Find(parents.data(), static_cast<int>(ii));
+  }
+  return parents;
+}
+
+bool TestAllReduce(vtkMultiProcessController* contr)
+{
+  const int rank = contr->GetLocalProcessId();
+  const int numRanks = contr->GetNumberOfProcesses();
+  vtkNew<vtkIntArray> parents;
+  for (int ii = 0; ii < NumberOfMembers(rank); ++ii)
+  {
+    parents->InsertNextValue(ii);
+  }
+  for (const auto& pair : Equivalences(rank, numRanks))
+  {
+    vtkPVUnionFind::Union(parents->GetPointer(0), pair.first, pair.second);
+  }
+
+  vtkPVUnionFind::AllReduce(contr, parents, 4323);
+
+  const std::vector<int> expected = SerialRoots(numRanks);
+  if (parents->GetNumberOfValues() != static_cast<vtkIdType>(expected.size()))
+  {
+    vtkLogF(ERROR, "AllReduce: rank %d has %d members instead of %d", rank,
+      static_cast<int>(parents->GetNumberOfValues()), static_cast<int>(expected.size()));
+    return false;
+  }
+  for (size_t ii = 0; ii < expected.size(); ++ii)
+  {
+    // every member must point to its root.
+    if (parents->GetValue(ii) != expected[ii])
+    {
+      vtkLogF(ERROR, "AllReduce: rank %d has root %d for member %d instead of %d", rank,
+        parents->GetValue(ii), static_cast<int>(ii), expected[ii]);
+      return false;
+    }
+  }
+  return true;
+}
+
+bool TestPEquivalenceSet(vtkMultiProcessController* contr)
+{
+  const int rank = contr->GetLocalProcessId();
+  const int numRanks = contr->GetNumberOfProcesses();
+  vtkNew<vtkPEquivalenceSet> set;
+  // the last member has no equivalence but extends the set.
+  set->AddEquivalence(NumberOfMembers(rank) - 1, NumberOfMembers(rank) - 1);
+  for (const auto& pair : Equivalences(rank, numRanks))
+  {
+    set->AddEquivalence(pair.first, pair.second);
+  }
+  const int numberOfSets = set->ResolveEquivalences();
+
+  // sets are numbered in the order of their smallest member.
+  const std::vector<int> roots = SerialRoots(numRanks);
+  std::vector<int> setIds(roots.size(), -1);
+  int expectedNumberOfSets = 0;
+  for (size_t ii = 0; ii < roots.size(); ++ii)
+  {
+    setIds[ii] = roots[ii] == static_cast<int>(ii) ? expectedNumberOfSets++ : setIds[roots[ii]];
+  }
+  if (numberOfSets != expectedNumberOfSets ||
+    set->GetNumberOfMembers() != static_cast<int>(roots.size()))
+  {
+    vtkLogF(ERROR, "vtkPEquivalenceSet: rank %d has %d sets instead of %d", rank, numberOfSets,
+      expectedNumberOfSets);
+    return false;
+  }
+  for (size_t ii = 0; ii < roots.size(); ++ii)
+  {
+    if (set->GetEquivalentSetId(static_cast<int>(ii)) != setIds[ii])
+    {
+      vtkLogF(ERROR, "vtkPEquivalenceSet: rank %d has set %d for member %d instead of %d", rank,
+        set->GetEquivalentSetId(static_cast<int>(ii)), static_cast<int>(ii), setIds[ii]);
+      return false;
+    }
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+// The material interface input is a single level AMR of 4x4x4 blocks of 4x4x4
+// cells, without ghost cells. The material is a bar crossing the domain and
+// 2x2x2 cubes, three of which straddle blocks owned by different ranks.
+const int BlockCells = 4;
+const int RootBlocks = 4;
+
+struct Box
+{
+  int Min[3];
+  int Max[3];
+};
+
+const Box MaterialBoxes[] = {
+  { { 1, 7, 7 }, { 14, 8, 8 } },      // bar, crosses 16 blocks.
+  { { 1, 1, 1 }, { 2, 2, 2 } },       // in a single block.
+  { { 7, 1, 1 }, { 8, 2, 2 } },       // across a face.
+  { { 11, 11, 11 }, { 12, 12, 12 } }, // across a corner.
+  { { 13, 1, 12 }, { 14, 2, 13 } },   // across a face.
+};
+const int NumberOfFragments = static_cast<int>(sizeof(MaterialBoxes) / sizeof(Box));
+
+bool InMaterial(int ii, int jj, int kk)
+{
+  for (const Box& box : MaterialBoxes)
+  {
+    if (ii >= box.Min[0] && ii <= box.Max[0] && jj >= box.Min[1] && jj <= box.Max[1] &&
+      kk >= box.Min[2] && kk <= box.Max[2])
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+double MaterialVolume()
+{
+  double volume = 0.0;
+  for (const Box& box : MaterialBoxes)
+  {
+    volume += (box.Max[0] - box.Min[0] + 1) * (box.Max[1] - box.Min[1] + 1) *
+      (box.Max[2] - box.Min[2] + 1);
+  }
+  return volume;
+}
+
+vtkSmartPointer<vtkUniformGrid> NewBlock(const int index[3])
+{
+  auto block = vtkSmartPointer<vtkUniformGrid>::New();
+  block->SetOrigin(index[0] * BlockCells, index[1] * BlockCells, index[2] * BlockCells);
+  block->SetSpacing(1.0, 1.0, 1.0);
+  block->SetDimensions(BlockCells + 1, BlockCells + 1, BlockCells + 1);
+
+  vtkNew<vtkUnsignedCharArray> fraction;
+  fraction->SetName("Material");
+  fraction->SetNumberOfTuples(block->GetNumberOfCells());
+  vtkIdType cellId = 0;
+  for (int kk = 0; kk < BlockCells; ++kk)
+  {
+    for (int jj = 0; jj < BlockCells; ++jj)
+    {
+      for (int ii = 0; ii < BlockCells; ++ii)
+      {
+        const bool inside = InMaterial(index[0] * BlockCells + ii, index[1] * BlockCells + jj,
+          index[2] * BlockCells + kk);
+        fraction->SetValue(cellId++, inside ? 255 : 0);
+      }
+    }
+  }
+  block->GetCellData()->AddArray(fraction);
+  return block;
+}
+
+vtkSmartPointer<vtkNonOverlappingAMR> NewInput(int rank, int numRanks)
+{
+  const int numBlocks = RootBlocks * RootBlocks * RootBlocks;
+  auto amr = vtkSmartPointer<vtkNonOverlappingAMR>::New();
+  int blocksPerLevel[1] = { numBlocks };
+  amr->Initialize(1, blocksPerLevel);
+  for (int blockId = 0; blockId < numBlocks; ++blockId)
+  {
+    if (blockId % numRanks == rank)
+    {
+      const int index[3] = { blockId % RootBlocks, (blockId / RootBlocks) % RootBlocks,
+        blockId / (RootBlocks * RootBlocks) };
+      amr->SetDataSet(0, blockId, NewBlock(index));
+    }
+  }
+  return amr;
+}
+
+bool TestMaterialInterfaceFilter(vtkMultiProcessController* contr)
+{
+  const int rank = contr->GetLocalProcessId();
+  auto input = NewInput(rank, contr->GetNumberOfProcesses());
+
+  vtkNew<vtkMaterialInterfaceFilter> filter;
+  filter->SetInputData(input);
+  filter->SelectMaterialArray("Material");
+  filter->Update();
+
+  // the fragment centers are only built on rank 0.
+  if (rank != 0)
+  {
+    return true;
+  }
+  auto centers = vtkMultiBlockDataSet::SafeDownCast(filter->GetOutputDataObject(1));
+  auto fragments = centers ? vtkPolyData::SafeDownCast(centers->GetBlock(0)) : nullptr;
+  if (!fragments || fragments->GetNumberOfPoints() != NumberOfFragments)
+  {
+    vtkLogF(ERROR, "vtkMaterialInterfaceFilter: %d fragments instead of %d",
+      fragments ? static_cast<int>(fragments->GetNumberOfPoints()) : -1, NumberOfFragments);
+    return false;
+  }
+  vtkDataArray* volumes = fragments->GetPointData()->GetArray("Volume");
+  double volume = 0.0;
+  for (vtkIdType ii = 0; volumes && ii < volumes->GetNumberOfTuples(); ++ii)
+  {
+    volume += volumes->GetTuple1(ii);
+  }
+  if (std::abs(volume - MaterialVolume()) > 1e-6 * MaterialVolume())
+  {
+    vtkLogF(ERROR, "vtkMaterialInterfaceFilter: volume is %g instead of %g", volume,
+      MaterialVolume());
+    return false;
+  }
+  return true;
+}
+}
+
+int TestDistributedEquivalences(int argc, char* argv[])
+{
+  vtkMPIController* contr = vtkMPIController::New();
+  contr->Initialize(&argc, &argv);
+  vtkMultiProcessController::SetGlobalController(contr);
+
+  bool success = TestAllReduce(contr);
+  success = TestPEquivalenceSet(contr) && success;
+  success = TestMaterialInterfaceFilter(contr) && success;
+
+  int localSuccess = success ? 1 : 0;
+  int allSuccess = 0;
+  contr->AllReduce(&localSuccess, &allSuccess, 1, vtkCommunicator::LOGICAL_AND_OP);
+
+  vtkMultiProcessController::SetGlobalController(nullptr);
+  contr->Finalize();
+  contr->Delete();
+  return allSuccess ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -15,6 +15,7 @@
 #include "vtkEquivalenceSet.h"
 #include "vtkIntArray.h"
 #include "vtkObjectFactory.h"
+#include "vtkPVUnionFind.h"
 
 vtkStandardNewMacro(vtkEquivalenceSet);
 
@@ -22,7 +23,7 @@ vtkStandardNewMacro(vtkEquivalenceSet);
 // A class that implements an equivalent set.  It is used to combine fragments
 // from different processes.
 //
-// I believe that this class is a strictly ordered tree of equivalences.
+// The equivalences are a union-find structure, see vtkPVUnionFind.
 // Every member points to its own id or an id smaller than itself.
 
 //----------------------------------------------------------------------------
@@ -76,16 +77,11 @@ void vtkEquivalenceSet::PrintSelf(ostream& os, vtkIndent indent)
 // Return the id of the equivalent set.
 int vtkEquivalenceSet::GetEquivalentSetId(int memberId)
 {
-  int ref;
-
-  ref = this->GetReference(memberId);
-  while (!this->Resolved && ref != memberId)
+  if (this->Resolved || memberId >= this->EquivalenceArray->GetNumberOfTuples())
   {
-    memberId = ref;
-    ref = this->GetReference(memberId);
+    return this->GetReference(memberId);
   }
-
-  return ref;
+  return vtkPVUnionFind::Find(this->EquivalenceArray->GetPointer(0), memberId);
 }
 
 //----------------------------------------------------------------------------
@@ -121,26 +117,7 @@ void vtkEquivalenceSet::AddEquivalence(int id1, int id2)
     ++num;
   }
 
-  // Our rule for references in the equivalent set is that
-  // all elements must point to a member equal to or smaller
-  // than itself.
-
-  // The only problem we could encounter is changing a reference.
-  // we do not want to orphan anything previously referenced.
-
-  // Replace the larger references.
-  if (id1 < id2)
-  {
-    // We could follow the references to the smallest.  It might
-    // make this processing more efficient.  This is a compromise.
-    // The referenced id will always be smaller than the id so
-    // order does not change.
-    this->EquateInternal(this->GetReference(id1), id2);
-  }
-  else
-  {
-    this->EquateInternal(this->GetReference(id2), id1);
-  }
+  this->EquateInternal(id1, id2);
 }
 
 //----------------------------------------------------------------------------
@@ -168,33 +145,12 @@ vtkIdType vtkEquivalenceSet::Capacity()
 }
 
 //----------------------------------------------------------------------------
-// id1 must be less than or equal to id2.
+// Both ids must be members of the set.
 void vtkEquivalenceSet::EquateInternal(int id1, int id2)
 {
-  // This is the reference that might be orphaned in this process.
-  int oldRef = this->GetEquivalentSetId(id2);
-
-  // The two ids are already equal (not the only way they might be equal).
-  if (oldRef == id1)
-  {
-    return;
-  }
-
-  // The only problem we could encounter is changing a reference.
-  // we do not want to orphan anything previously referenced.
-  if (oldRef == id2)
-  {
-    this->EquivalenceArray->SetValue(id2, id1);
-  }
-  else if (oldRef > id1)
-  {
-    this->EquivalenceArray->SetValue(id2, id1);
-    this->EquateInternal(id1, oldRef);
-  }
-  else
-  { // oldRef < id1
-    this->EquateInternal(oldRef, id1);
-  }
+  // The smallest member of the merged set stays its root, so that all the
+  // members keep pointing to equal or smaller ids.
+  vtkPVUnionFind::Union(this->EquivalenceArray->GetPointer(0), id1, id2);
 }
 
 //----------------------------------------------------------------------------
@@ -203,27 +159,8 @@ int vtkEquivalenceSet::ResolveEquivalences()
 {
   // Go through the equivalence array collapsing chains
   // and assigning consecutive ids.
-  int count = 0;
-  int id;
-  int newId;
-
-  int numIds = this->EquivalenceArray->GetNumberOfTuples();
-  for (int ii = 0; ii < numIds; ++ii)
-  {
-    id = this->EquivalenceArray->GetValue(ii);
-    if (id == ii)
-    { // This is a new equivalence set.
-      this->EquivalenceArray->SetValue(ii, count);
-      ++count;
-    }
-    else
-    {
-      // All earlier ids will be resolved already.
-      // This array only point to less than or equal ids. (id <= ii).
-      newId = this->EquivalenceArray->GetValue(id);
-      this->EquivalenceArray->SetValue(ii, newId);
-    }
-  }
+  int count = vtkPVUnionFind::Resolve(
+    this->EquivalenceArray->GetPointer(0), this->EquivalenceArray->GetNumberOfTuples());
   this->Resolved = 1;
   // cerr << "Final number of equivalent sets: " << count << endl;
 
@@ -18,6 +18,7 @@
  *
  * Useful for connectivity on multiple processes.  Run connectivity
  * on each processes, then make touching fragments equivalent.
+ * The equivalences are kept in a union-find structure, see vtkPVUnionFind.
 */
 
 #ifndef vtkEquivalenceSet_h
@@ -80,7 +81,7 @@ protected:
   // traversed by different processes or passes.
   vtkIntArray* EquivalenceArray;
 
-  // Return the id of the equivalent set.
+  // Merge the sets of two existing members.
   void EquateInternal(int id1, int id2);
 
 private:
@@ -52,6 +52,7 @@
 #include "vtkMaterialInterfaceProcessLoading.h"
 #include "vtkMaterialInterfaceProcessRing.h"
 #include "vtkMaterialInterfaceToProcMap.h"
+#include "vtkPVUnionFind.h"
 #include "vtkPointAccumulator.h"
 #include "vtkPointData.h"
 #include "vtkUnsignedCharArray.h"
@@ -244,7 +245,7 @@ int GetEnabledArrayNames(vtkDataArraySelection* das, vector<string>& names)
 // A class that implements an equivalent set.  It is used to combine fragments
 // from different processes.
 //
-// I believe that this class is a strictly ordered tree of equivalences.
+// The equivalences are a union-find structure, see vtkPVUnionFind.
 // Every member points to its own id or an id smaller than itself.
 class vtkMaterialInterfaceEquivalenceSet
 {
@@ -267,6 +268,10 @@ public:
   // You cannot add anymore equivalences after this is called.
   int ResolveEquivalences();
 
+  // Merge the equivalences of all the processes.  Every process
+  // gets the same set.
+  void AllReduce(vtkMultiProcessController* controller, int tag);
+
   void DeepCopy(vtkMaterialInterfaceEquivalenceSet* in);
 
   // Needed for sending the set over MPI.
@@ -289,7 +294,6 @@ private:
 
   // Return the id of the equivalent set.
   int GetReference(int memberId);
-  void EquateInternal(int id1, int id2);
 };
 
 //----------------------------------------------------------------------------
@@ -340,16 +344,11 @@ void vtkMaterialInterfaceEquivalenceSet::Print()
 // Return the id of the equivalent set.
 int vtkMaterialInterfaceEquivalenceSet::GetEquivalentSetId(int memberId)
 {
-  int ref;
-
-  ref = this->GetReference(memberId);
-  while (!this->Resolved && ref != memberId)
+  if (this->Resolved || memberId >= this->EquivalenceArray->GetNumberOfTuples())
   {
-    memberId = ref;
-    ref = this->GetReference(memberId);
+    return this->GetReference(memberId);
   }
-
-  return ref;
+  return vtkPVUnionFind::Find(this->EquivalenceArray->GetPointer(0), memberId);
 }
 
 //----------------------------------------------------------------------------
@@ -385,50 +384,9 @@ void vtkMaterialInterfaceEquivalenceSet::AddEquivalence(int id1, int id2)
     ++num;
   }
 
-  // Our rule for references in the equivalent set is that
-  // all elements must point to a member equal to or smaller
-  // than itself.
-
-  // The only problem we could encounter is changing a reference.
-  // we do not want to orphan anything previously referenced.
-
-  // Replace the larger references.
-  if (id1 < id2)
-  {
-    // We could follow the references to the smallest.  It might
-    // make this processing more efficient.  This is a compromise.
-    // The referenced id will always be smaller than the id so
-    // order does not change.
-    this->EquateInternal(this->GetReference(id1), id2);
-  }
-  else
-  {
-    this->EquateInternal(this->GetReference(id2), id1);
-  }
-}
-
-//----------------------------------------------------------------------------
-// id1 must be less than or equal to id2.
-void vtkMaterialInterfaceEquivalenceSet::EquateInternal(int id1, int id2)
-{
-  // This is the reference that might be orphaned in this process.
-  int oldRef = this->GetEquivalentSetId(id2);
-
-  // The only problem we could encounter is changing a reference.
-  // we do not want to orphan anything previously referenced.
-  if (oldRef == id2 || oldRef == id1)
-  {
-    this->EquivalenceArray->SetValue(id2, id1);
-  }
-  else if (oldRef > id1)
-  {
-    this->EquivalenceArray->SetValue(id2, id1);
-    this->EquateInternal(id1, oldRef);
-  }
-  else
-  { // oldRef < id1
-    this->EquateInternal(oldRef, id1);
-  }
+  // The smallest member of the merged set stays its root, so that all the
+  // members keep pointing to equal or smaller ids.
+  vtkPVUnionFind::Union(this->EquivalenceArray->GetPointer(0), id1, id2);
 }
 
 //----------------------------------------------------------------------------
@@ -437,33 +395,26 @@ int vtkMaterialInterfaceEquivalenceSet::ResolveEquivalences()
 {
   // Go through the equivalence array collapsing chains
   // and assigning consecutive ids.
-  int count = 0;
-  int id;
-  int newId;
-
-  int numIds = this->EquivalenceArray->GetNumberOfTuples();
-  for (int ii = 0; ii < numIds; ++ii)
-  {
-    id = this->EquivalenceArray->GetValue(ii);
-    if (id == ii)
-    { // This is a new equivalence set.
-      this->EquivalenceArray->SetValue(ii, count);
-      ++count;
-    }
-    else
-    {
-      // All earlier ids will be resolved already.
-      // This array only point to less than or equal ids. (id <= ii).
-      newId = this->EquivalenceArray->GetValue(id);
-      this->EquivalenceArray->SetValue(ii, newId);
-    }
-  }
+  int count = vtkPVUnionFind::Resolve(
+    this->EquivalenceArray->GetPointer(0), this->EquivalenceArray->GetNumberOfTuples());
   this->Resolved = 1;
   // cerr << "Final number of equivalent sets: " << count << endl;
 
   return count;
 }
 
+//----------------------------------------------------------------------------
+void vtkMaterialInterfaceEquivalenceSet::AllReduce(
+  vtkMultiProcessController* controller, int tag)
+{
+  if (this->Resolved)
+  {
+    vtkGenericWarningMacro("Set already resolved, you cannot merge it.");
+    return;
+  }
+  vtkPVUnionFind::AllReduce(controller, this->EquivalenceArray, tag);
+}
+
 //============================================================================
 // Helper object to clip hexahedra with implicit half sphere.
 class vtkMaterialInterfaceFilterHalfSphere
@@ -8322,8 +8273,6 @@ void vtkMaterialInterfaceFilter::GatherEquivalenceSets(vtkMaterialInterfaceEquiv
   for (int ii = 0; ii < numLocalMembers; ++ii)
   {
     memberSetId = set->GetEquivalentSetId(ii);
-    // This will be inefficient until I make the scheduled improvemnt to the
-    // add method (Ordered multilevel tree instead of a one level tree).
     globalSet->AddEquivalence(ii + myOffset, memberSetId + myOffset);
   }
 
@@ -8361,59 +8310,14 @@ void vtkMaterialInterfaceFilter::GatherEquivalenceSets(vtkMaterialInterfaceEquiv
 void vtkMaterialInterfaceFilter::MergeGhostEquivalenceSets(
   vtkMaterialInterfaceEquivalenceSet* globalSet)
 {
-  const int myProcId = this->Controller->GetLocalProcessId();
-  int* buf = globalSet->GetPointer();
-  const int numIds = globalSet->GetNumberOfMembers();
-
   // At this point all the sets are global and have the same number of ids.
-  // Send all the sets to process 0 to be merged.
-  if (myProcId > 0)
-  {
-    this->Controller->Send(buf, numIds, 0, 342320);
-    // Now receive the final equivalences.
-    this->Controller->Receive(&this->NumberOfResolvedFragments, 1, 0, 342321);
-    // Domain has numIds,  range has NumberOfResolvedFragments
-    this->Controller->Receive(buf, numIds, 0, 342322);
-    // We have to mark the set as resolved because the set being
-    // received has been resolved.  If we do not do this then
-    // We cannot get the proper set id.  Using the pointer
-    // here is a bad api.  TODO: Fix the API and make "Resolved" private.
-    globalSet->Resolved = 1;
-    return;
-  }
-
-  // Only process 0 from here out.
-
-  int numProcs = this->Controller->GetNumberOfProcesses();
-  int* tmp;
-  tmp = new int[numIds];
-  for (int ii = 1; ii < numProcs; ++ii)
-  {
-    this->Controller->Receive(tmp, numIds, ii, 342320);
-    // Merge the values.
-    for (int jj = 0; jj < numIds; ++jj)
-    {
-      if (tmp[jj] != jj)
-      { // TODO: Make sure this is efficient.  Avoid n^2.
-        globalSet->AddEquivalence(jj, tmp[jj]);
-      }
-    }
-  }
-  delete[] tmp;
+  // Merge the sets of all processes pairwise along a binary tree, every
+  // process gets the merged set.
+  globalSet->AllReduce(this->Controller, 342320);
 
-  // Make the set ids sequential.
+  // Make the set ids sequential.  All processes have the same set, so they
+  // all get the same ids.
   this->NumberOfResolvedFragments = globalSet->ResolveEquivalences();
-
-  // The pointers should still be valid.
-  // The array should not resize here.
-  // Number of resolved fragemnts will be smaller
-  // than TotalNumberOfRawFragments
-  for (int ii = 1; ii < numProcs; ++ii)
-  {
-    this->Controller->Send(&this->NumberOfResolvedFragments, 1, ii, 342321);
-    // Domain has numIds,  range has NumberOfResolvedFragments
-    this->Controller->Send(buf, numIds, ii, 342322);
-  }
 }
 
 //----------------------------------------------------------------------------
@@ -0,0 +1,171 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    BenchmarkImageCompressors.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Benchmark for the image compressors used for remote rendering. Frames, e.g.
+// render window captures saved as PNG, are compressed and decompressed with
+// every compressor configuration and the compression ratio and throughputs
+// are reported. Configurations use the same strings as the `CompressorConfig`
+// setting; by default, every registered compressor is benchmarked with its
+// default configuration, and vtkLZ4Compressor with a single stripe as well.
+//
+// Usage: BenchmarkImageCompressors [--frame=<png>]... [--config=<string>]...
+//                                  [--iterations=N]
+// Without frames, the test image from the data root is used.
+
+#include "vtkImageCompressor.h"
+#include "vtkImageData.h"
+#include "vtkNew.h"
+#include "vtkPNGReader.h"
+#include "vtkPointData.h"
+#include "vtkSmartPointer.h"
+#include "vtkTesting.h"
+#include "vtkTimerLog.h"
+#include "vtkUnsignedCharArray.h"
+
+#include <string>
+#include <vector>
+#include <vtksys/CommandLineArguments.hxx>
+
+namespace
+{
+struct Result
+{
+  double CompressTime = 0;
+  double DecompressTime = 0;
+  double UncompressedSize = 0;
+  double CompressedSize = 0;
+};
+
+bool Benchmark(Result& result, vtkImageCompressor* compressor, vtkUnsignedCharArray* frame)
+{
+  vtkNew<vtkUnsignedCharArray> compressed;
+  vtkNew<vtkUnsignedCharArray> decompressed;
+  decompressed->SetNumberOfComponents(frame->GetNumberOfComponents());
+  decompressed->SetNumberOfTuples(frame->GetNumberOfTuples());
+
+  vtkNew<vtkTimerLog> timer;
+  compressor->SetInput(frame);
+  compressor->SetOutput(compressed);
+  timer->StartTimer();
+  if (!compressor->Compress())
+  {
+    return false;
+  }
+  timer->StopTimer();
+  result.CompressTime += timer->GetElapsedTime();
+
+  compressor->SetInput(compressed);
+  compressor->SetOutput(decompressed);
+  timer->StartTimer();
+  if (!compressor->Decompress())
+  {
+    return false;
+  }
+  timer->StopTimer();
+  result.DecompressTime += timer->GetElapsedTime();
+
+  result.UncompressedSize +=
+    static_cast<double>(frame->GetNumberOfTuples() * frame->GetNumberOfComponents());
+  result.CompressedSize +=
+    static_cast<double>(compressed->GetNumberOfTuples() * compressed->GetNumberOfComponents());
+  return true;
+}
+}
+
+int BenchmarkImageCompressors(int argc, char* argv[])
+{
+  std::vector<std::string> frameFiles;
+  std::vector<std::string> configs;
+  int iterations = 10;
+
+  vtksys::CommandLineArguments arg;
+  arg.Initialize(argc, argv);
+  typedef vtksys::CommandLineArguments argT;
+  arg.AddArgument("--frame", argT::EQUAL_ARGUMENT, &frameFiles, "PNG image to compress.");
+  arg.AddArgument("--config", argT::EQUAL_ARGUMENT, &configs, "Compressor configuration.");
+  arg.AddArgument("--iterations", argT::EQUAL_ARGUMENT, &iterations, "Number of iterations.");
+  arg.StoreUnusedArguments(true);
+  if (!arg.Parse())
+  {
+    cerr << "Problem parsing arguments" << endl;
+    return EXIT_FAILURE;
+  }
+
+  if (frameFiles.empty())
+  {
+    vtkNew<vtkTesting> testing;
+    testing->AddArguments(argc, const_cast<const char**>(argv));
+    frameFiles.push_back(std::string(testing->GetDataRoot()) + "/Testing/Data/NE2_ps_bath.png");
+    iterations = 1;
+  }
+
+  if (configs.empty())
+  {
+    for (const auto& name : vtkImageCompressor::GetRegisteredCompressors())
+    {
+      vtkSmartPointer<vtkImageCompressor> compressor;
+      compressor.TakeReference(vtkImageCompressor::NewCompressor(name.c_str()));
+      configs.push_back(compressor->SaveConfiguration());
+    }
+    configs.push_back("vtkLZ4Compressor 0 3 1");
+  }
+
+  std::vector<vtkSmartPointer<vtkUnsignedCharArray> > frames;
+  for (const auto& fname : frameFiles)
+  {
+    vtkNew<vtkPNGReader> reader;
+    reader->SetFileName(fname.c_str());
+    reader->Update();
+    auto scalars =
+      vtkUnsignedCharArray::SafeDownCast(reader->GetOutput()->GetPointData()->GetScalars());
+    if (!scalars)
+    {
+      cerr << "ERROR: could not read `" << fname << "`." << endl;
+      return EXIT_FAILURE;
+    }
+    frames.push_back(scalars);
+  }
+
+  for (const auto& config : configs)
+  {
+    vtkSmartPointer<vtkImageCompressor> compressor;
+    compressor.TakeReference(vtkImageCompressor::NewFromConfiguration(config.c_str()));
+    if (!compressor)
+    {
+      cerr << "ERROR: invalid configuration `" << config << "`." << endl;
+      return EXIT_FAILURE;
+    }
+
+    Result result;
+    for (int cc = 0; cc < iterations; ++cc)
+    {
+      for (const auto& frame : frames)
+      {
+        if (!Benchmark(result, compressor, frame))
+        {
+          cerr << "ERROR: `" << config << "` failed." << endl;
+          return EXIT_FAILURE;
+        }
+      }
+    }
+
+    const double mb = result.UncompressedSize / (1024.0 * 1024.0);
+    cout << config << " : ratio: "
+         << (result.CompressedSize > 0 ? result.UncompressedSize / result.CompressedSize : 0.0)
+         << " compress: " << (result.CompressTime > 0 ? mb / result.CompressTime : 0.0)
+         << " MB/s decompress: "
+         << (result.DecompressTime > 0 ? mb / result.DecompressTime : 0.0) << " MB/s" << endl;
+  }
+  return EXIT_SUCCESS;
+}
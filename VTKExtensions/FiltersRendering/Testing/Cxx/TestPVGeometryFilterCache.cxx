@@ -0,0 +1,128 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestPVGeometryFilterCache.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Tests that vtkPVGeometryFilter reuses the surface extracted from an
+// unstructured grid when re-executed without the grid or the relevant
+// settings having changed.
+
+#include "vtkCellType.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkPVGeometryFilter.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSmartPointer.h"
+#include "vtkUnstructuredGrid.h"
+
+namespace
+{
+vtkSmartPointer<vtkUnstructuredGrid> GetGrid(double offset)
+{
+  // a row of hexahedra.
+  const int numHexes = 10;
+  vtkNew<vtkPoints> points;
+  for (int i = 0; i <= numHexes; ++i)
+  {
+    for (int k = 0; k < 4; ++k)
+    {
+      points->InsertNextPoint(offset + i, k % 2, k / 2);
+    }
+  }
+
+  auto grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
+  grid->SetPoints(points);
+  grid->Allocate(numHexes);
+  for (vtkIdType i = 0; i < numHexes; ++i)
+  {
+    const vtkIdType a = 4 * i;
+    const vtkIdType b = 4 * (i + 1);
+    vtkIdType ids[8] = { a, b, b + 1, a + 1, a + 2, b + 2, b + 3, a + 3 };
+    grid->InsertNextCell(VTK_HEXAHEDRON, 8, ids);
+  }
+  return grid;
+}
+
+vtkDataArray* GetPointsArray(vtkPolyData* pd)
+{
+  return (pd && pd->GetPoints()) ? pd->GetPoints()->GetData() : nullptr;
+}
+}
+
+int TestPVGeometryFilterCache(int, char* [])
+{
+  auto grid = GetGrid(0);
+
+  vtkNew<vtkPVGeometryFilter> geometry;
+  geometry->SetUseOutline(0);
+  geometry->SetGenerateProcessIds(false);
+  geometry->SetInputData(grid);
+  geometry->Update();
+  vtkDataArray* extracted = GetPointsArray(geometry->GetOutput());
+  if (!extracted || extracted->GetNumberOfTuples() == 0)
+  {
+    cerr << "ERROR: no surface extracted." << endl;
+    return EXIT_FAILURE;
+  }
+
+  // representations modify the filter every time they update.
+  geometry->Modified();
+  geometry->Update();
+  if (GetPointsArray(geometry->GetOutput()) != extracted)
+  {
+    cerr << "ERROR: surface should have been reused." << endl;
+    return EXIT_FAILURE;
+  }
+
+  // changing a relevant setting must extract the surface again.
+  geometry->SetTriangulate(1);
+  geometry->Update();
+  vtkDataArray* triangulated = GetPointsArray(geometry->GetOutput());
+  if (triangulated == extracted)
+  {
+    cerr << "ERROR: surface should have been extracted after changing settings." << endl;
+    return EXIT_FAILURE;
+  }
+
+  // so does modifying the input.
+  grid->Modified();
+  geometry->Update();
+  if (GetPointsArray(geometry->GetOutput()) == triangulated)
+  {
+    cerr << "ERROR: surface should have been extracted after modifying the input." << endl;
+    return EXIT_FAILURE;
+  }
+
+  // for composite datasets, only modified blocks are extracted again.
+  vtkNew<vtkMultiBlockDataSet> mb;
+  mb->SetNumberOfBlocks(2);
+  mb->SetBlock(0, GetGrid(0));
+  mb->SetBlock(1, GetGrid(20));
+  geometry->SetInputData(mb);
+  geometry->Update();
+  auto output = vtkMultiBlockDataSet::SafeDownCast(geometry->GetOutputDataObject(0));
+  vtkDataArray* block0 = GetPointsArray(vtkPolyData::SafeDownCast(output->GetBlock(0)));
+  vtkDataArray* block1 = GetPointsArray(vtkPolyData::SafeDownCast(output->GetBlock(1)));
+
+  mb->GetBlock(1)->Modified();
+  geometry->Modified();
+  geometry->Update();
+  output = vtkMultiBlockDataSet::SafeDownCast(geometry->GetOutputDataObject(0));
+  if (!block0 || GetPointsArray(vtkPolyData::SafeDownCast(output->GetBlock(0))) != block0 ||
+    GetPointsArray(vtkPolyData::SafeDownCast(output->GetBlock(1))) == block1)
+  {
+    cerr << "ERROR: only the modified block should have been extracted again." << endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
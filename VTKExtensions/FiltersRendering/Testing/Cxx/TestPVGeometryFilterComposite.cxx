@@ -0,0 +1,152 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestPVGeometryFilterComposite.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Tests that surfaces extracted from the blocks of a composite dataset, which
+// are computed concurrently, match the surfaces extracted one block at a time.
+
+#include "vtkCellData.h"
+#include "vtkDataArray.h"
+#include "vtkDoubleArray.h"
+#include "vtkFieldData.h"
+#include "vtkImageData.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkPVGeometryFilter.h"
+#include "vtkPointData.h"
+#include "vtkPolyData.h"
+#include "vtkSmartPointer.h"
+
+namespace
+{
+vtkSmartPointer<vtkImageData> GetBlock(int index)
+{
+  auto img = vtkSmartPointer<vtkImageData>::New();
+  img->SetDimensions(4, 3 + index % 3, 5);
+  img->SetOrigin(5.0 * index, 0, 0);
+
+  vtkNew<vtkDoubleArray> values;
+  values->SetName("values");
+  values->SetNumberOfTuples(img->GetNumberOfPoints());
+  for (vtkIdType cc = 0; cc < values->GetNumberOfTuples(); ++cc)
+  {
+    values->SetTypedComponent(cc, 0, index * 1000 + cc);
+  }
+  img->GetPointData()->AddArray(values);
+  return img;
+}
+
+bool Compare(vtkPolyData* pd, vtkPolyData* expected)
+{
+  if (pd->GetNumberOfPoints() != expected->GetNumberOfPoints() ||
+    pd->GetNumberOfCells() != expected->GetNumberOfCells())
+  {
+    cerr << "ERROR: mismatched counts." << endl;
+    return false;
+  }
+
+  for (vtkIdType cc = 0; cc < pd->GetNumberOfPoints(); ++cc)
+  {
+    double pt[3], ept[3];
+    pd->GetPoint(cc, pt);
+    expected->GetPoint(cc, ept);
+    if (pt[0] != ept[0] || pt[1] != ept[1] || pt[2] != ept[2])
+    {
+      cerr << "ERROR: mismatched point " << cc << "." << endl;
+      return false;
+    }
+  }
+
+  vtkDataArray* values = pd->GetPointData()->GetArray("values");
+  vtkDataArray* evalues = expected->GetPointData()->GetArray("values");
+  if (!values || !evalues)
+  {
+    cerr << "ERROR: missing `values` array." << endl;
+    return false;
+  }
+  for (vtkIdType cc = 0; cc < values->GetNumberOfTuples(); ++cc)
+  {
+    if (values->GetTuple1(cc) != evalues->GetTuple1(cc))
+    {
+      cerr << "ERROR: mismatched value " << cc << "." << endl;
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestPVGeometryFilterComposite(int, char* [])
+{
+  const unsigned int numBlocks = 200;
+
+  vtkNew<vtkMultiBlockDataSet> mb;
+  mb->SetNumberOfBlocks(numBlocks);
+  for (unsigned int cc = 0; cc < numBlocks; ++cc)
+  {
+    // leave a few empty blocks.
+    if (cc % 7 != 3)
+    {
+      mb->SetBlock(cc, GetBlock(cc));
+    }
+  }
+
+  vtkNew<vtkPVGeometryFilter> geometry;
+  geometry->SetUseOutline(0);
+  geometry->SetGenerateProcessIds(false);
+  geometry->SetInputData(mb);
+  geometry->Update();
+
+  auto output = vtkMultiBlockDataSet::SafeDownCast(geometry->GetOutputDataObject(0));
+  if (!output || output->GetNumberOfBlocks() != numBlocks)
+  {
+    cerr << "ERROR: unexpected output structure." << endl;
+    return EXIT_FAILURE;
+  }
+
+  for (unsigned int cc = 0; cc < numBlocks; ++cc)
+  {
+    auto block = vtkPolyData::SafeDownCast(output->GetBlock(cc));
+    if (cc % 7 == 3)
+    {
+      if (block != nullptr)
+      {
+        cerr << "ERROR: empty block " << cc << " should not have been surfaced." << endl;
+        return EXIT_FAILURE;
+      }
+      continue;
+    }
+
+    vtkNew<vtkPVGeometryFilter> expected;
+    expected->SetUseOutline(0);
+    expected->SetGenerateProcessIds(false);
+    expected->SetInputData(mb->GetBlock(cc));
+    expected->Update();
+    if (!block || !Compare(block, vtkPolyData::SafeDownCast(expected->GetOutputDataObject(0))))
+    {
+      cerr << "ERROR: surface for block " << cc << " is incorrect." << endl;
+      return EXIT_FAILURE;
+    }
+
+    // composite index and block colors are assigned in block order.
+    vtkDataArray* compositeIndex = block->GetCellData()->GetArray("vtkCompositeIndex");
+    vtkDataArray* blockColors = block->GetFieldData()->GetArray("vtkBlockColors");
+    if (!compositeIndex || compositeIndex->GetTuple1(0) != cc + 1 || !blockColors ||
+      blockColors->GetTuple1(0) != cc % geometry->GetBlockColorsDistinctValues())
+    {
+      cerr << "ERROR: incorrect composite index or block colors for block " << cc << "." << endl;
+      return EXIT_FAILURE;
+    }
+  }
+  return EXIT_SUCCESS;
+}
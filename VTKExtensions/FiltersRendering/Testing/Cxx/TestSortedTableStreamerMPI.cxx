@@ -0,0 +1,196 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestSortedTableStreamerMPI.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Tests the distributed sort of vtkSortedTableStreamer: every block, in both
+// orders, must match a serial sort of the rows of all the ranks. The values
+// have many ties and some ranks have no rows.
+
+#include "vtkDoubleArray.h"
+#include "vtkIdTypeArray.h"
+#include "vtkLogger.h"
+#include "vtkMPIController.h"
+#include "vtkNew.h"
+#include "vtkSortedTableStreamer.h"
+#include "vtkTable.h"
+
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace
+{
+// Value of the row with the given global id, with lots of ties.
+double RowValue(vtkIdType gid)
+{
+  return static_cast<double>((gid * 7) % 11) - 5.0;
+}
+
+// Gathers the values of a column of the output on all ranks, in rank order.
+// Only the merging rank has rows, so this is the block.
+template <class ArrayT, class T>
+std::vector<T> GatherColumn(vtkMultiProcessController* contr, vtkTable* output, const char* name)
+{
+  std::vector<T> local;
+  if (auto array = ArrayT::SafeDownCast(output->GetColumnByName(name)))
+  {
+    for (vtkIdType cc = 0; cc < array->GetNumberOfTuples(); ++cc)
+    {
+      local.push_back(array->GetValue(cc));
+    }
+  }
+
+  const int numRanks = contr->GetNumberOfProcesses();
+  vtkIdType localSize = static_cast<vtkIdType>(local.size());
+  std::vector<vtkIdType> sizes(numRanks);
+  contr->AllGather(&localSize, sizes.data(), 1);
+  std::vector<vtkIdType> offsets(numRanks, 0);
+  for (int cc = 1; cc < numRanks; ++cc)
+  {
+    offsets[cc] = offsets[cc - 1] + sizes[cc - 1];
+  }
+  std::vector<T> all(static_cast<size_t>(offsets[numRanks - 1] + sizes[numRanks - 1]));
+  contr->AllGatherV(local.data(), all.data(), localSize, sizes.data(), offsets.data());
+  return all;
+}
+
+bool RunCase(vtkMultiProcessController* contr, const std::string& label,
+  const std::function<vtkIdType(int)>& rowsOfRank)
+{
+  const int rank = contr->GetLocalProcessId();
+  const int numRanks = contr->GetNumberOfProcesses();
+
+  vtkIdType firstId = 0;
+  vtkIdType total = 0;
+  for (int cc = 0; cc < numRanks; ++cc)
+  {
+    firstId += (cc < rank) ? rowsOfRank(cc) : 0;
+    total += rowsOfRank(cc);
+  }
+
+  vtkNew<vtkDoubleArray> data;
+  data->SetName("data");
+  vtkNew<vtkIdTypeArray> ids;
+  ids->SetName("id");
+  const vtkIdType numRows = rowsOfRank(rank);
+  data->SetNumberOfTuples(numRows);
+  ids->SetNumberOfTuples(numRows);
+  for (vtkIdType cc = 0; cc < numRows; ++cc)
+  {
+    ids->SetValue(cc, firstId + cc);
+    data->SetValue(cc, RowValue(firstId + cc));
+  }
+  vtkNew<vtkTable> input;
+  input->AddColumn(data);
+  input->AddColumn(ids);
+
+  std::vector<double> sorted(static_cast<size_t>(total));
+  for (vtkIdType gid = 0; gid < total; ++gid)
+  {
+    sorted[gid] = RowValue(gid);
+  }
+  std::sort(sorted.begin(), sorted.end());
+
+  vtkNew<vtkSortedTableStreamer> streamer;
+  streamer->SetController(contr);
+  streamer->SetInputData(input);
+  streamer->SetColumnNameToSort("data");
+  streamer->SetSelectedComponent(0);
+  const vtkIdType blockSize = 10;
+  streamer->SetBlockSize(blockSize);
+
+  std::vector<vtkIdType> seen;
+  for (vtkIdType block = 0; block * blockSize < total; ++block)
+  {
+    // toggling the order between blocks reuses the same index.
+    for (int invert = 0; invert < 2; ++invert)
+    {
+      streamer->SetInvertOrder(invert);
+      streamer->SetBlock(block);
+      streamer->Update();
+
+      auto values = GatherColumn<vtkDoubleArray, double>(contr, streamer->GetOutput(), "data");
+      auto rowIds = GatherColumn<vtkIdTypeArray, vtkIdType>(contr, streamer->GetOutput(), "id");
+
+      const vtkIdType start = block * blockSize;
+      const vtkIdType count = std::min(blockSize, total - start);
+      if (static_cast<vtkIdType>(values.size()) != count || rowIds.size() != values.size())
+      {
+        vtkLogF(ERROR, "%s: block %d%s has %d rows, expected %d", label.c_str(),
+          static_cast<int>(block), invert ? " (inverted)" : "", static_cast<int>(values.size()),
+          static_cast<int>(count));
+        return false;
+      }
+      for (vtkIdType cc = 0; cc < count; ++cc)
+      {
+        const double expected = invert ? sorted[total - 1 - start - cc] : sorted[start + cc];
+        if (values[cc] != expected || RowValue(rowIds[cc]) != values[cc])
+        {
+          vtkLogF(ERROR, "%s: block %d%s, row %d: got %g (id %d), expected %g", label.c_str(),
+            static_cast<int>(block), invert ? " (inverted)" : "", static_cast<int>(cc), values[cc],
+            static_cast<int>(rowIds[cc]), expected);
+          return false;
+        }
+        if (!invert)
+        {
+          seen.push_back(rowIds[cc]);
+        }
+      }
+    }
+  }
+
+  // each row must appear exactly once over all the blocks.
+  std::sort(seen.begin(), seen.end());
+  for (vtkIdType gid = 0; gid < total; ++gid)
+  {
+    if (seen.size() != static_cast<size_t>(total) || seen[gid] != gid)
+    {
+      vtkLogF(ERROR, "%s: rows are missing or duplicated", label.c_str());
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestSortedTableStreamerMPI(int argc, char* argv[])
+{
+  vtkMPIController* contr = vtkMPIController::New();
+  contr->Initialize(&argc, &argv);
+  vtkMultiProcessController::SetGlobalController(contr);
+
+  const int numRanks = contr->GetNumberOfProcesses();
+
+  // uneven sizes, the second rank has no rows.
+  bool success = RunCase(contr, "uneven", [](int rank) -> vtkIdType {
+    return rank == 1 ? 0 : 17 + 13 * rank;
+  });
+
+  // all the rows are on the last rank.
+  success = RunCase(contr, "last-rank-only", [numRanks](int rank) -> vtkIdType {
+    return rank == numRanks - 1 ? 45 : 0;
+  }) && success;
+
+  // at most one row per rank, every other rank is empty.
+  success = RunCase(contr, "few-rows", [](int rank) -> vtkIdType { return rank % 2; }) && success;
+
+  int localSuccess = success ? 1 : 0;
+  int allSuccess = 0;
+  contr->AllReduce(&localSuccess, &allSuccess, 1, vtkCommunicator::LOGICAL_AND_OP);
+
+  vtkMultiProcessController::SetGlobalController(nullptr);
+  contr->Finalize();
+  contr->Delete();
+  return allSuccess ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -16,11 +16,45 @@
 #include "vtkObjectFactory.h"
 
 #include "vtkCommand.h"
+#include "vtkLZ4Compressor.h"
 #include "vtkMultiProcessStream.h"
+#include "vtkSquirtCompressor.h"
 #include "vtkUnsignedCharArray.h"
+#include "vtkZlibImageCompressor.h"
+
+#include <map>
+#include <mutex>
 #include <sstream>
 #include <string>
 
+namespace
+{
+struct vtkImageCompressorRegistry
+{
+  std::mutex Mutex;
+  std::map<std::string, vtkImageCompressor::FactoryFunctionType> Factories;
+
+  vtkImageCompressorRegistry()
+  {
+    this->Factories["vtkLZ4Compressor"] = []() -> vtkImageCompressor* {
+      return vtkLZ4Compressor::New();
+    };
+    this->Factories["vtkSquirtCompressor"] = []() -> vtkImageCompressor* {
+      return vtkSquirtCompressor::New();
+    };
+    this->Factories["vtkZlibImageCompressor"] = []() -> vtkImageCompressor* {
+      return vtkZlibImageCompressor::New();
+    };
+  }
+};
+
+vtkImageCompressorRegistry& GetRegistry()
+{
+  static vtkImageCompressorRegistry registry;
+  return registry;
+}
+}
+
 //-----------------------------------------------------------------------------
 vtkCxxSetObjectMacro(vtkImageCompressor, Output, vtkUnsignedCharArray);
 
@@ -101,6 +135,63 @@ const char* vtkImageCompressor::RestoreConfiguration(const char* stream)
   return 0;
 }
 
+//-----------------------------------------------------------------------------
+void vtkImageCompressor::RegisterCompressor(const char* className, FactoryFunctionType factory)
+{
+  auto& registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.Mutex);
+  if (factory)
+  {
+    registry.Factories[className] = factory;
+  }
+  else
+  {
+    registry.Factories.erase(className);
+  }
+}
+
+//-----------------------------------------------------------------------------
+vtkImageCompressor* vtkImageCompressor::NewCompressor(const char* className)
+{
+  FactoryFunctionType factory = nullptr;
+  {
+    auto& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.Mutex);
+    auto iter = className ? registry.Factories.find(className) : registry.Factories.end();
+    factory = iter != registry.Factories.end() ? iter->second : nullptr;
+  }
+  return factory ? factory() : nullptr;
+}
+
+//-----------------------------------------------------------------------------
+std::vector<std::string> vtkImageCompressor::GetRegisteredCompressors()
+{
+  auto& registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.Mutex);
+  std::vector<std::string> names;
+  for (const auto& item : registry.Factories)
+  {
+    names.push_back(item.first);
+  }
+  return names;
+}
+
+//-----------------------------------------------------------------------------
+vtkImageCompressor* vtkImageCompressor::NewFromConfiguration(const char* configuration)
+{
+  std::istringstream iss(configuration ? configuration : "");
+  std::string className;
+  iss >> className;
+
+  vtkImageCompressor* compressor = vtkImageCompressor::NewCompressor(className.c_str());
+  if (compressor && !compressor->RestoreConfiguration(configuration))
+  {
+    compressor->Delete();
+    compressor = nullptr;
+  }
+  return compressor;
+}
+
 //-----------------------------------------------------------------------------
 void vtkImageCompressor::PrintSelf(ostream& os, vtkIndent indent)
 {
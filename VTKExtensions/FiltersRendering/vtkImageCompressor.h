@@ -32,6 +32,9 @@
 #include "vtkObject.h"
 #include "vtkPVVTKExtensionsFiltersRenderingModule.h" // needed for export macro
 
+#include <string> // for std::string
+#include <vector> // for std::vector
+
 class vtkUnsignedCharArray;
 class vtkMultiProcessStream;
 
@@ -108,6 +111,28 @@ public:
    */
   virtual const char* RestoreConfiguration(const char* stream);
 
+  //@{
+  /**
+   * Registry of the compressors that can be selected by class name, e.g. using
+   * the configuration strings passed to
+   * vtkPVClientServerSynchronizedRenderers::ConfigureCompressor().
+   * vtkSquirtCompressor, vtkZlibImageCompressor and vtkLZ4Compressor are always
+   * registered. Plugins may register additional compressors.
+   * NewCompressor() returns nullptr if no compressor is registered with that name.
+   */
+  typedef vtkImageCompressor* (*FactoryFunctionType)();
+  static void RegisterCompressor(const char* className, FactoryFunctionType factory);
+  static vtkImageCompressor* NewCompressor(const char* className);
+  static std::vector<std::string> GetRegisteredCompressors();
+  //@}
+
+  /**
+   * Creates the compressor named by the first token of \c configuration and
+   * restores its configuration from it. Returns nullptr if the compressor is
+   * not registered or the configuration is invalid.
+   */
+  static vtkImageCompressor* NewFromConfiguration(const char* configuration);
+
 protected:
   //@{
   /**
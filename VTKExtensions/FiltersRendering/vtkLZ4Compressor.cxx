@@ -16,16 +16,41 @@
 
 #include "vtkMultiProcessStream.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
 #include "vtkUnsignedCharArray.h"
 
 #include "vtk_lz4.h"
+#include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <sstream>
+#include <vector>
+
+namespace
+{
+// Stripes smaller than this compress noticeably worse and do not benefit from
+// being processed concurrently.
+const vtkIdType MinimumAutomaticStripeSize = 256 * 1024;
+
+// Compressed data starts with the number of stripes followed by the compressed
+// size of each stripe, all stored as 32 bit integers.
+vtkIdType GetHeaderSize(int numStripes)
+{
+  return static_cast<vtkIdType>(sizeof(vtkTypeInt32)) * (numStripes + 1);
+}
+
+// Returns the first tuple of `stripe`. Stripes split the image rows evenly.
+vtkIdType GetStripeStart(vtkIdType numTuples, int numStripes, int stripe)
+{
+  return (numTuples * stripe) / numStripes;
+}
+}
 
 vtkStandardNewMacro(vtkLZ4Compressor);
 //----------------------------------------------------------------------------
 vtkLZ4Compressor::vtkLZ4Compressor()
   : Quality(3)
+  , NumberOfStripes(0)
 {
 }
 
@@ -56,27 +81,73 @@ int vtkLZ4Compressor::Compress()
   memcpy(&compress_mask, &compress_masks[compress_level], 4);
 
   vtkUnsignedCharArray* input = this->Input;
-  int inputSize = input->GetNumberOfTuples() * input->GetNumberOfComponents();
+  const int numComps = input->GetNumberOfComponents();
+  const vtkIdType numTuples = input->GetNumberOfTuples();
+  const vtkIdType inputSize = numTuples * numComps;
 
-  if (this->Quality > 0 && input->GetNumberOfComponents() == 4)
+  if (this->Quality > 0 && numComps == 4)
   {
-    this->TemporaryBuffer->SetNumberOfComponents(input->GetNumberOfComponents());
-    this->TemporaryBuffer->SetNumberOfTuples(input->GetNumberOfTuples());
+    this->TemporaryBuffer->SetNumberOfComponents(numComps);
+    this->TemporaryBuffer->SetNumberOfTuples(numTuples);
     const unsigned int* in = reinterpret_cast<const unsigned int*>(input->GetPointer(0));
     unsigned int* out = reinterpret_cast<unsigned int*>(this->TemporaryBuffer->GetPointer(0));
-    for (vtkIdType cc = 0, max = this->Input->GetNumberOfTuples(); cc < max; ++cc)
+    vtkSMPTools::For(0, numTuples, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType cc = begin; cc < end; ++cc)
+      {
+        out[cc] = in[cc] & compress_mask;
+      }
+    });
+    input = this->TemporaryBuffer.Get();
+  }
+
+  int numStripes = this->NumberOfStripes;
+  if (numStripes == 0)
+  {
+    numStripes = static_cast<int>(std::min<vtkIdType>(vtkSMPTools::GetEstimatedNumberOfThreads(),
+      inputSize / MinimumAutomaticStripeSize));
+  }
+  numStripes = static_cast<int>(std::max<vtkIdType>(1, std::min<vtkIdType>(numStripes, numTuples)));
+
+  // compress each stripe at its worst case offset, then pack them.
+  std::vector<vtkIdType> offsets(numStripes + 1, ::GetHeaderSize(numStripes));
+  for (int stripe = 0; stripe < numStripes; ++stripe)
+  {
+    const vtkIdType stripeSize = numComps *
+      (::GetStripeStart(numTuples, numStripes, stripe + 1) -
+        ::GetStripeStart(numTuples, numStripes, stripe));
+    offsets[stripe + 1] = offsets[stripe] + LZ4_compressBound(static_cast<int>(stripeSize));
+  }
+
+  const char* in = reinterpret_cast<const char*>(input->GetPointer(0));
+  unsigned char* out = this->Output->WritePointer(0, offsets[numStripes]);
+  std::vector<vtkTypeInt32> compressedSizes(numStripes);
+  vtkSMPTools::For(0, numStripes, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType stripe = begin; stripe < end; ++stripe)
     {
-      out[cc] = in[cc] & compress_mask;
+      const vtkIdType start = numComps * ::GetStripeStart(numTuples, numStripes, stripe);
+      const vtkIdType stop = numComps * ::GetStripeStart(numTuples, numStripes, stripe + 1);
+      compressedSizes[stripe] = LZ4_compress_fast(in + start,
+        reinterpret_cast<char*>(out + offsets[stripe]), static_cast<int>(stop - start),
+        static_cast<int>(offsets[stripe + 1] - offsets[stripe]), 16);
     }
-    input = this->TemporaryBuffer.Get();
+  });
+
+  vtkIdType compressedSize = ::GetHeaderSize(numStripes);
+  for (int stripe = 0; stripe < numStripes; ++stripe)
+  {
+    if (compressedSizes[stripe] <= 0)
+    {
+      return VTK_ERROR;
+    }
+    memmove(out + compressedSize, out + offsets[stripe], compressedSizes[stripe]);
+    compressedSize += compressedSizes[stripe];
   }
 
-  int maxOutputSize = LZ4_compressBound(inputSize);
-  int compressedSize = LZ4_compress_fast(reinterpret_cast<const char*>(input->GetPointer(0)),
-    reinterpret_cast<char*>(this->Output->WritePointer(0, maxOutputSize)), inputSize, maxOutputSize,
-    16);
+  const vtkTypeInt32 header = numStripes;
+  memcpy(out, &header, sizeof(vtkTypeInt32));
+  memcpy(out + sizeof(vtkTypeInt32), &compressedSizes[0], sizeof(vtkTypeInt32) * numStripes);
   this->Output->SetNumberOfTuples(compressedSize);
-  return compressedSize > 0 ? VTK_OK : VTK_ERROR;
+  return VTK_OK;
 }
 
 //----------------------------------------------------------------------------
@@ -88,27 +159,56 @@ int vtkLZ4Compressor::Decompress()
     return VTK_ERROR;
   }
 
-  int maxDecompressedSize =
-    this->Output->GetNumberOfComponents() * this->Output->GetNumberOfTuples();
-  int decompressedSize =
-    LZ4_decompress_safe(reinterpret_cast<const char*>(this->Input->GetPointer(0)),
-      reinterpret_cast<char*>(this->Output->GetPointer(0)), this->Input->GetNumberOfTuples(),
-      maxDecompressedSize);
-
-  //  // We use LZ4_decompress_safe for now since there seems to be some bug
-  //  // in LZ4_decompress_fast which is causing segfaults on Windows.
-  //  int decompressedSize = LZ4_decompress_fast(
-  //    reinterpret_cast<const char*>(this->Input->GetPointer(0)),
-  //    reinterpret_cast<char*>(this->Output->GetPointer(0)),
-  //    maxDecompressedSize);
-  return decompressedSize > 0 ? VTK_OK : VTK_ERROR;
+  const vtkIdType inputSize =
+    this->Input->GetNumberOfTuples() * this->Input->GetNumberOfComponents();
+  const unsigned char* in = this->Input->GetPointer(0);
+  vtkTypeInt32 numStripes = 0;
+  if (inputSize >= static_cast<vtkIdType>(sizeof(vtkTypeInt32)))
+  {
+    memcpy(&numStripes, in, sizeof(vtkTypeInt32));
+  }
+  if (numStripes <= 0 || ::GetHeaderSize(numStripes) > inputSize)
+  {
+    vtkWarningMacro("Cannot decompress, invalid header.");
+    return VTK_ERROR;
+  }
+
+  std::vector<vtkTypeInt32> compressedSizes(numStripes);
+  memcpy(&compressedSizes[0], in + sizeof(vtkTypeInt32), sizeof(vtkTypeInt32) * numStripes);
+  std::vector<vtkIdType> offsets(numStripes + 1, ::GetHeaderSize(numStripes));
+  for (int stripe = 0; stripe < numStripes; ++stripe)
+  {
+    offsets[stripe + 1] = offsets[stripe] + compressedSizes[stripe];
+  }
+  if (offsets[numStripes] > inputSize)
+  {
+    vtkWarningMacro("Cannot decompress, truncated input.");
+    return VTK_ERROR;
+  }
+
+  const int numComps = this->Output->GetNumberOfComponents();
+  const vtkIdType numTuples = this->Output->GetNumberOfTuples();
+  char* out = reinterpret_cast<char*>(this->Output->GetPointer(0));
+  std::vector<char> valid(numStripes, 0);
+  vtkSMPTools::For(0, numStripes, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType stripe = begin; stripe < end; ++stripe)
+    {
+      const vtkIdType start = numComps * ::GetStripeStart(numTuples, numStripes, stripe);
+      const vtkIdType stop = numComps * ::GetStripeStart(numTuples, numStripes, stripe + 1);
+      const int decompressedSize =
+        LZ4_decompress_safe(reinterpret_cast<const char*>(in + offsets[stripe]), out + start,
+          compressedSizes[stripe], static_cast<int>(stop - start));
+      valid[stripe] = (decompressedSize == stop - start) ? 1 : 0;
+    }
+  });
+  return std::find(valid.begin(), valid.end(), 0) == valid.end() ? VTK_OK : VTK_ERROR;
 }
 
 //-----------------------------------------------------------------------------
 void vtkLZ4Compressor::SaveConfiguration(vtkMultiProcessStream* stream)
 {
   this->Superclass::SaveConfiguration(stream);
-  *stream << this->Quality;
+  *stream << this->Quality << this->NumberOfStripes;
 }
 
 //-----------------------------------------------------------------------------
@@ -116,9 +216,10 @@ bool vtkLZ4Compressor::RestoreConfiguration(vtkMultiProcessStream* stream)
 {
   if (this->Superclass::RestoreConfiguration(stream))
   {
-    int quality;
-    *stream >> quality;
+    int quality, numStripes;
+    *stream >> quality >> numStripes;
     this->SetQuality(quality);
+    this->SetNumberOfStripes(numStripes);
     return true;
   }
   return false;
@@ -128,7 +229,8 @@ bool vtkLZ4Compressor::RestoreConfiguration(vtkMultiProcessStream* stream)
 const char* vtkLZ4Compressor::SaveConfiguration()
 {
   std::ostringstream oss;
-  oss << this->Superclass::SaveConfiguration() << " " << this->Quality;
+  oss << this->Superclass::SaveConfiguration() << " " << this->Quality << " "
+      << this->NumberOfStripes;
   this->SetConfiguration(oss.str().c_str());
   return this->Configuration;
 }
@@ -143,7 +245,18 @@ const char* vtkLZ4Compressor::RestoreConfiguration(const char* stream)
     int quality;
     iss >> quality;
     this->SetQuality(quality);
-    return stream + iss.tellg();
+
+    // the number of stripes is optional, "vtkLZ4Compressor 0 3" remains valid.
+    int numStripes = 0;
+    if (iss >> numStripes)
+    {
+      this->SetNumberOfStripes(numStripes);
+    }
+    else
+    {
+      this->SetNumberOfStripes(0);
+    }
+    return iss.eof() ? stream + strlen(stream) : stream + iss.tellg();
   }
   return 0;
 }
@@ -152,5 +265,6 @@ const char* vtkLZ4Compressor::RestoreConfiguration(const char* stream)
 void vtkLZ4Compressor::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
-  cout << "Quality: " << this->Quality << endl;
+  os << indent << "Quality: " << this->Quality << endl;
+  os << indent << "NumberOfStripes: " << this->NumberOfStripes << endl;
 }
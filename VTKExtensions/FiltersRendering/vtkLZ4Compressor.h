@@ -18,7 +18,8 @@
  * that uses LZ4 for fast lossless compression.
  *
  * vtkLZ4Compressor uses LZ4 for fast lossless compression and decompression on
- * data.
+ * data. The image is split into horizontal stripes that are compressed and
+ * decompressed concurrently, see SetNumberOfStripes().
 */
 
 #ifndef vtkLZ4Compressor_h
@@ -48,6 +49,18 @@ public:
   vtkGetMacro(Quality, int);
   //@}
 
+  //@{
+  /**
+   * Set the number of stripes the image is split into. Stripes are compressed
+   * independently, and concurrently, using vtkSMPTools. When set to 0, the
+   * default, the number of stripes is chosen based on the number of threads
+   * and the image size. The number of stripes is stored in the compressed
+   * data, hence it need not match when decompressing.
+   */
+  vtkSetClampMacro(NumberOfStripes, int, 0, VTK_INT_MAX);
+  vtkGetMacro(NumberOfStripes, int);
+  //@}
+
   //@{
   /**
    * Compress/Decompress data array on the objects input with results
@@ -72,6 +85,7 @@ protected:
   ~vtkLZ4Compressor() override;
 
   int Quality;
+  int NumberOfStripes;
 
 private:
   vtkLZ4Compressor(const vtkLZ4Compressor&) = delete;
@@ -51,13 +51,18 @@
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkOutlineSource.h"
+#include "vtkPVConcurrentLeavesHelper.h"
 #include "vtkPVRecoverGeometryWireframe.h"
 #include "vtkPVTrivialProducer.h"
 #include "vtkPointData.h"
+#include "vtkPointSet.h"
+#include "vtkPoints.h"
 #include "vtkPolyData.h"
 #include "vtkPolygon.h"
 #include "vtkRectilinearGrid.h"
 #include "vtkRectilinearGridOutlineFilter.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 #include "vtkSelectionNode.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
@@ -76,8 +81,11 @@
 #include <assert.h>
 #include <map>
 #include <math.h>
+#include <mutex>
 #include <set>
 #include <string>
+#include <tuple>
+#include <unordered_map>
 #include <vector>
 
 template <typename T>
@@ -93,6 +101,20 @@ void GetValidWholeExtent(T* ds, const int wholeExt[6], int validWholeExt[6])
   }
 }
 
+namespace
+{
+// Returns true if the blocks can be surfaced concurrently, see
+// vtkPVConcurrentLeavesHelper.
+bool CanExecuteBlocksConcurrently(const std::vector<vtkDataObject*>& blocks)
+{
+  if (blocks.size() < 2 || vtkSMPTools::GetEstimatedNumberOfThreads() < 2)
+  {
+    return false;
+  }
+  return vtkPVConcurrentLeavesHelper::CanProcessConcurrently(blocks);
+}
+}
+
 vtkStandardNewMacro(vtkPVGeometryFilter);
 vtkCxxSetObjectMacro(vtkPVGeometryFilter, Controller, vtkMultiProcessController);
 vtkInformationKeyMacro(vtkPVGeometryFilter, POINT_OFFSETS, IntegerVector);
@@ -150,6 +172,87 @@ public:
   int Commutative() override { return 1; }
 };
 
+//----------------------------------------------------------------------------
+// Surfaces extracted from unstructured grids, keyed on the input block. An
+// entry is only reused if neither the block nor the settings affecting the
+// extraction changed. Entries not accessed during an execution of the filter
+// are discarded when the execution completes.
+class vtkPVGeometryFilter::vtkSurfaceCache
+{
+public:
+  // UseStrips, Triangulate, NonlinearSubdivisionLevel, PassThroughCellIds,
+  // PassThroughPointIds.
+  using SettingsType = std::tuple<int, int, int, int, int>;
+
+  void BeginExecute()
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    ++this->Pass;
+  }
+
+  void EndExecute()
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    for (auto iter = this->Entries.begin(); iter != this->Entries.end();)
+    {
+      if (iter->second.Pass != this->Pass)
+      {
+        iter = this->Entries.erase(iter);
+      }
+      else
+      {
+        ++iter;
+      }
+    }
+  }
+
+  bool Get(vtkDataObject* input, const SettingsType& settings, vtkPolyData* output)
+  {
+    vtkSmartPointer<vtkPolyData> surface;
+    {
+      std::lock_guard<std::mutex> lock(this->Mutex);
+      auto iter = this->Entries.find(input);
+      if (iter == this->Entries.end() || iter->second.MTime != input->GetMTime() ||
+        iter->second.Settings != settings)
+      {
+        return false;
+      }
+      iter->second.Pass = this->Pass;
+      surface = iter->second.Surface;
+    }
+    output->ShallowCopy(surface);
+    return true;
+  }
+
+  void Set(vtkDataObject* input, const SettingsType& settings, vtkPolyData* output)
+  {
+    vtkNew<vtkPolyData> surface;
+    surface->ShallowCopy(output);
+
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    Entry& entry = this->Entries[input];
+    entry.MTime = input->GetMTime();
+    entry.Settings = settings;
+    entry.Surface = surface.GetPointer();
+    entry.Pass = this->Pass;
+  }
+
+private:
+  struct Entry
+  {
+    vtkMTimeType MTime;
+    SettingsType Settings;
+    vtkSmartPointer<vtkPolyData> Surface;
+    unsigned int Pass;
+  };
+
+  // keys are only compared, never dereferenced: a block freed and reallocated
+  // at the same address has a newer MTime.
+  std::unordered_map<vtkDataObject*, Entry> Entries;
+  std::mutex Mutex;
+  unsigned int Pass = 0;
+};
+
 //----------------------------------------------------------------------------
 vtkPVGeometryFilter::vtkPVGeometryFilter()
 {
@@ -195,6 +298,8 @@ vtkPVGeometryFilter::vtkPVGeometryFilter()
 
   this->HideInternalAMRFaces = true;
   this->UseNonOverlappingAMRMetaDataForOutlines = true;
+
+  this->SurfaceCache = std::make_shared<vtkSurfaceCache>();
 }
 
 //----------------------------------------------------------------------------
@@ -548,6 +653,7 @@ int vtkPVGeometryFilter::RequestData(
   vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
 {
   vtkDataObject* input = vtkDataObject::GetData(inputVector[0], 0);
+  this->SurfaceCache->BeginExecute();
   if (vtkCompositeDataSet::SafeDownCast(input))
   {
     vtkTimerLog::MarkStartEvent("vtkPVGeometryFilter::RequestData");
@@ -560,6 +666,7 @@ int vtkPVGeometryFilter::RequestData(
     {
       this->RequestDataObjectTree(request, inputVector, outputVector);
     }
+    this->SurfaceCache->EndExecute();
     vtkTimerLog::MarkStartEvent("vtkPVGeometryFilter::GarbageCollect");
     vtkGarbageCollector::DeferredCollectionPop();
     vtkTimerLog::MarkEndEvent("vtkPVGeometryFilter::GarbageCollect");
@@ -581,6 +688,7 @@ int vtkPVGeometryFilter::RequestData(
     vtkStreamingDemandDrivenPipeline::GetWholeExtent(inputVector[0]->GetInformationObject(0));
   this->ExecuteBlock(input, output, 1, procid, numProcs, 0, wholeExtent);
   this->CleanupOutputData(output, 1);
+  this->SurfaceCache->EndExecute();
   return 1;
 }
 
@@ -924,6 +1032,29 @@ int vtkPVGeometryFilter::RequestAMRData(
   return 1;
 }
 
+//----------------------------------------------------------------------------
+void vtkPVGeometryFilter::CopyExecutionSettings(vtkPVGeometryFilter* worker)
+{
+  worker->SetUseOutline(this->UseOutline);
+  worker->SetGenerateFeatureEdges(this->GenerateFeatureEdges);
+  worker->SetBlockColorsDistinctValues(this->BlockColorsDistinctValues);
+  worker->SetGenerateCellNormals(this->GenerateCellNormals);
+  worker->SetTriangulate(this->Triangulate);
+  worker->SetNonlinearSubdivisionLevel(this->NonlinearSubdivisionLevel);
+  worker->SetController(this->Controller);
+  worker->SetGenerateProcessIds(this->GenerateProcessIds);
+  worker->SetPassThroughCellIds(this->PassThroughCellIds);
+  worker->SetPassThroughPointIds(this->PassThroughPointIds);
+  worker->SetHideInternalAMRFaces(this->HideInternalAMRFaces);
+  worker->SetUseNonOverlappingAMRMetaDataForOutlines(this->UseNonOverlappingAMRMetaDataForOutlines);
+
+  // bypass SetUseStrips() which may modify the worker for surface selection.
+  worker->UseStrips = this->UseStrips;
+  worker->DataSetSurfaceFilter->SetUseStrips(this->UseStrips);
+
+  worker->SurfaceCache = this->SurfaceCache;
+}
+
 //----------------------------------------------------------------------------
 int vtkPVGeometryFilter::RequestDataObjectTree(
   vtkInformation*, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
@@ -965,35 +1096,88 @@ int vtkPVGeometryFilter::RequestDataObjectTree(
 
   int* wholeExtent =
     vtkStreamingDemandDrivenPipeline::GetWholeExtent(inputVector[0]->GetInformationObject(0));
-  int numInputs = 0;
+  // collect the leaves first: blocks are surfaced concurrently and the results
+  // are added to the output in traversal order afterwards.
+  std::vector<vtkDataObject*> blocks;
+  blocks.reserve(totNumBlocks);
   for (inIter->InitTraversal(); !inIter->IsDoneWithTraversal(); inIter->GoToNextItem())
   {
-    vtkDataObject* block = inIter->GetCurrentDataObject();
-    if (!block)
+    if (vtkDataObject* block = inIter->GetCurrentDataObject())
     {
-      continue;
+      blocks.push_back(block);
     }
+  }
 
-    vtkPolyData* tmpOut = vtkPolyData::New();
-    this->ExecuteBlock(block, tmpOut, 0, 0, 1, 0, wholeExtent);
-    this->CleanupOutputData(tmpOut, 0);
-    // skip empty nodes.
-    if (tmpOut->GetNumberOfPoints() > 0)
+  const vtkIdType numBlocks = static_cast<vtkIdType>(blocks.size());
+  std::vector<vtkSmartPointer<vtkPolyData> > outputs(blocks.size());
+  std::vector<int> outlineFlags(blocks.size(), 0);
+
+  // ExecuteBlock() uses the internal filters and sets OutlineFlag, so each
+  // thread surfaces blocks with its own vtkPVGeometryFilter instance.
+  vtkSMPThreadLocal<vtkSmartPointer<vtkPVGeometryFilter> > workers;
+  const bool concurrent = ::CanExecuteBlocksConcurrently(blocks);
+  auto executeRange = [&](vtkIdType begin, vtkIdType end) {
+    vtkPVGeometryFilter* self = this;
+    if (concurrent)
     {
-      output->SetDataSet(inIter, tmpOut);
-      tmpOut->FastDelete();
+      vtkSmartPointer<vtkPVGeometryFilter>& worker = workers.Local();
+      if (!worker)
+      {
+        worker = vtkSmartPointer<vtkPVGeometryFilter>::New();
+        this->CopyExecutionSettings(worker);
+      }
+      self = worker;
+    }
+    for (vtkIdType cc = begin; cc < end; ++cc)
+    {
+      vtkNew<vtkPolyData> tmpOut;
+      self->ExecuteBlock(blocks[cc], tmpOut, 0, 0, 1, 0, wholeExtent);
+      self->CleanupOutputData(tmpOut, 0);
+      outlineFlags[cc] = self->OutlineFlag;
+      // skip empty nodes.
+      if (tmpOut->GetNumberOfPoints() > 0)
+      {
+        outputs[cc] = tmpOut.GetPointer();
+      }
+    }
+  };
 
-      const unsigned int current_flat_index = inIter->GetCurrentFlatIndex();
-      this->AddCompositeIndex(tmpOut, current_flat_index);
+  // blocks are processed in batches so that progress can be reported, and
+  // abort requests honored, from the main thread.
+  const vtkIdType batchSize = std::max<vtkIdType>(
+    numBlocks / 10, 4 * static_cast<vtkIdType>(vtkSMPTools::GetEstimatedNumberOfThreads()));
+  for (vtkIdType first = 0; first < numBlocks && !this->AbortExecute; first += batchSize)
+  {
+    const vtkIdType last = std::min(first + batchSize, numBlocks);
+    if (concurrent)
+    {
+      vtkSMPTools::For(first, last, executeRange);
     }
     else
     {
-      tmpOut->Delete();
-      tmpOut = NULL;
+      executeRange(first, last);
     }
+    this->UpdateProgress(static_cast<float>(last) / totNumBlocks);
+  }
+  if (numBlocks > 0)
+  {
+    this->OutlineFlag = outlineFlags[numBlocks - 1];
+  }
 
-    numInputs++;
-    this->UpdateProgress(static_cast<float>(numInputs) / totNumBlocks);
+  vtkIdType blockIdx = 0;
+  for (inIter->InitTraversal(); !inIter->IsDoneWithTraversal(); inIter->GoToNextItem())
+  {
+    if (inIter->GetCurrentDataObject() == nullptr)
+    {
+      continue;
+    }
+    if (vtkPolyData* tmpOut = outputs[blockIdx++])
+    {
+      output->SetDataSet(inIter, tmpOut);
+
+      const unsigned int current_flat_index = inIter->GetCurrentFlatIndex();
+      this->AddCompositeIndex(tmpOut, current_flat_index);
+    }
   }
   vtkTimerLog::MarkEndEvent("vtkPVGeometryFilter::ExecuteCompositeDataSet");
 
@@ -1417,6 +1601,16 @@ void vtkPVGeometryFilter::UnstructuredGridExecute(
   {
     this->OutlineFlag = 0;
 
+    // re-executing with unchanged input, e.g. after changing the
+    // representation type, reuses the previously extracted surface.
+    vtkUnstructuredGridBase* originalInput = input;
+    const vtkSurfaceCache::SettingsType settings(this->UseStrips, this->Triangulate,
+      this->NonlinearSubdivisionLevel, this->PassThroughCellIds, this->PassThroughPointIds);
+    if (this->SurfaceCache->Get(originalInput, settings, output))
+    {
+      return;
+    }
+
     bool handleSubdivision = (this->Triangulate != 0) && (input->GetNumberOfCells() > 0);
     if (!handleSubdivision && (this->NonlinearSubdivisionLevel > 0))
     {
@@ -1565,6 +1759,7 @@ void vtkPVGeometryFilter::UnstructuredGridExecute(
     }
 
     output->GetCellData()->RemoveArray(vtkPVRecoverGeometryWireframe::ORIGINAL_FACE_IDS());
+    this->SurfaceCache->Set(originalInput, settings, output);
     return;
   }
 
@@ -25,6 +25,9 @@
 
 #include "vtkDataObjectAlgorithm.h"
 #include "vtkPVVTKExtensionsFiltersRenderingModule.h" // needed for export macro
+
+#include <memory> // for std::shared_ptr
+
 class vtkCallbackCommand;
 class vtkDataSet;
 class vtkDataSetSurfaceFilter;
@@ -337,6 +340,21 @@ private:
   void operator=(const vtkPVGeometryFilter&) = delete;
 
   void AddCompositeIndex(vtkPolyData* pd, unsigned int index);
+
+  /**
+   * Copies the settings that affect ExecuteBlock() and CleanupOutputData() to
+   * \c worker. Used to set up the per-thread instances surfacing blocks of
+   * composite datasets concurrently.
+   */
+  void CopyExecutionSettings(vtkPVGeometryFilter* worker);
+
+  /**
+   * Surfaces extracted from unstructured grids, reused when the filter
+   * re-executes without the input or the relevant settings having changed.
+   * Shared with the per-thread instances used for composite datasets.
+   */
+  class vtkSurfaceCache;
+  std::shared_ptr<vtkSurfaceCache> SurfaceCache;
   //@{
   /**
    * Adds a field array called "vtkBlockColors". The array is
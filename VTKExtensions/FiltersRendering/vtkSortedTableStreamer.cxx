@@ -51,6 +51,7 @@
 
 #include <algorithm>
 #include <map>
+#include <numeric>
 #include <set>
 #include <vector>
 
@@ -429,6 +430,7 @@ public:
     {
       this->Array = 0;
       this->Histo = 0;
+      this->ArraySize = 0;
     }
 
     ~ArraySorter() { this->Clear(); }
@@ -550,13 +552,49 @@ public:
       }
     }
   };
+  // Global order of the rows sorted on one component. LocalOrder holds the
+  // local rows in ascending order and GlobalRank the position of each of
+  // them among the rows of all the processes, in the same order.
+  class RankIndex
+  {
+  public:
+    ArraySorter LocalOrder;
+    std::vector<vtkIdType> GlobalRank;
+    vtkIdType NumberOfRows = 0;
+  };
+  // Value received by the process merging a bucket of the global order
+  class BucketItem
+  {
+  public:
+    T Value;
+    int Process;
+    vtkIdType Position;
+
+    bool operator<(const BucketItem& other) const
+    {
+      if (this->Value != other.Value)
+      {
+        return this->Value < other.Value;
+      }
+      if (this->Process != other.Process)
+      {
+        return this->Process < other.Process;
+      }
+      return this->Position < other.Position;
+    }
+  };
+  class ComponentRange
+  {
+  public:
+    bool Sortable;
+    double Range[2];
+  };
 
 public:
   Internals()
   {
     // Only used for testing
     this->LocalSorter = 0;
-    this->GlobalHistogram = 0;
     this->Debug = false;
   }
 
@@ -568,6 +606,7 @@ public:
     this->DataToSort = dataToSort;
 
     this->InputMTime = input->GetMTime();
+    this->DataMTime = 0;
 
     if (dataToSort) // Might be NULL
     {
@@ -581,20 +620,30 @@ public:
 
     // Create internal objects
     this->LocalSorter = new ArraySorter();
-    this->GlobalHistogram = new Histogram(HISTOGRAM_SIZE);
   }
 
   ~Internals() override
   {
     if (this->LocalSorter)
       delete this->LocalSorter;
-    if (this->GlobalHistogram)
-      delete this->GlobalHistogram;
   }
 
   // --------------------------------------------------------------------------
   bool IsSortable() override
   {
+    // The answer only depends on the data and the component, reuse it as long
+    // as every process still has it.
+    auto cached = this->SortableComponents.find(this->SelectedComponent);
+    int localCached = cached != this->SortableComponents.end() ? 1 : 0;
+    int globalCached = 0;
+    this->MPI->AllReduce(&localCached, &globalCached, 1, vtkCommunicator::MIN_OP);
+    if (globalCached)
+    {
+      this->CommonRange[0] = cached->second.Range[0];
+      this->CommonRange[1] = cached->second.Range[1];
+      return cached->second.Sortable;
+    }
+
     // See if one process is able to sort the table,
     // if not then just say NOT sortable
     int localCanSort = (this->DataToSort == NULL) ? 0 : 1;
@@ -602,6 +651,7 @@ public:
     this->MPI->AllReduce(&localCanSort, &globalCanSort, 1, vtkCommunicator::MAX_OP);
     if (globalCanSort == 0)
     {
+      this->SortableComponents[this->SelectedComponent] = { false, { 0, 0 } };
       return false;
     }
 
@@ -652,64 +702,22 @@ public:
     this->CommonRange[0] -= FLT_EPSILON;
     this->CommonRange[1] += FLT_EPSILON;
 
+    this->SortableComponents[this->SelectedComponent] = { sortable,
+      { this->CommonRange[0], this->CommonRange[1] } };
     return sortable;
   }
 
   // --------------------------------------------------------------------------
-  int BuildCache(bool sortableArray, bool invertOrder)
+  int BuildCache()
   {
     // We are building the cache so no need to build it next time
     this->NeedToBuildCache = false;
 
-    // Communication buffer
-    vtkIdType* bufferHistogramValues = new vtkIdType[this->NumProcs * HISTOGRAM_SIZE];
-
-    // Is there something to sort ???
-    if (!sortableArray)
+    // Keep the same order as the local one because all the values are equals
+    if (this->DataToSort)
     {
-      // Keep the same order as the local one because all the values are equals
-      if (this->DataToSort)
-      {
-        this->LocalSorter->FillArray(this->DataToSort->GetNumberOfTuples());
-      }
+      this->LocalSorter->FillArray(this->DataToSort->GetNumberOfTuples());
     }
-    else
-    {
-      if (this->DataToSort)
-      {
-        // Sort and build local histogram
-        this->LocalSorter->Update(static_cast<T*>(this->DataToSort->GetVoidPointer(0)),
-          this->DataToSort->GetNumberOfTuples(), this->DataToSort->GetNumberOfComponents(),
-          this->SelectedComponent, HISTOGRAM_SIZE, this->CommonRange, invertOrder);
-      }
-      else
-      {
-        // Build empty local histogram
-        this->LocalSorter->Clear();
-        this->LocalSorter->Histo = new Histogram(HISTOGRAM_SIZE);
-        this->LocalSorter->Histo->SetScalarRange(this->CommonRange);
-        this->LocalSorter->Histo->Inverted = invertOrder;
-      }
-
-      // Initialize the global histogram with same range
-      this->LocalSorter->Histo->CopyRangeTo(*this->GlobalHistogram);
-
-      // Make sure that the global histogram is properly initialized
-      this->GlobalHistogram->ClearHistogramValues();
-      this->GlobalHistogram->Inverted = invertOrder;
-
-      // Send local histogram and receive every histogram from everybody
-      this->MPI->AllGather(this->LocalSorter->Histo->Values, bufferHistogramValues, HISTOGRAM_SIZE);
-
-      // Merge all histogram into the GlobalHistogram
-      for (int idx = 0, nb = this->NumProcs * HISTOGRAM_SIZE; idx < nb; ++idx)
-      {
-        this->GlobalHistogram->TotalValues += bufferHistogramValues[idx];
-        this->GlobalHistogram->Values[idx % HISTOGRAM_SIZE] += bufferHistogramValues[idx];
-      }
-    }
-
-    delete[] bufferHistogramValues;
     return 1;
   }
 
@@ -725,7 +733,7 @@ public:
     // ------------------------------------------------------------------------
     if (this->NeedToBuildCache)
     {
-      this->BuildCache(false, revertOrder);
+      this->BuildCache();
     }
 
     // Build empty local table with empty arrays so they stay in the same order
@@ -852,46 +860,50 @@ public:
     bool revertOrder) override
   {
     // ------------------------------------------------------------------------
-    // Make sure that the Cache is built
-    //    This will sort the local array, that's why we don't want to do it
-    //    at each execution. Specially when we only change the requested block.
+    // Make sure that the global rank index is built
+    //    This sorts the rows across all processes, that's why we only do it
+    //    once per component and reuse it for any block and for both orders.
     // ------------------------------------------------------------------------
-    if (this->NeedToBuildCache)
+    int localBuilt = this->RankIndices.count(this->SelectedComponent) ? 1 : 0;
+    int globalBuilt = 0;
+    this->MPI->AllReduce(&localBuilt, &globalBuilt, 1, vtkCommunicator::MIN_OP);
+    RankIndex& index = this->RankIndices[this->SelectedComponent];
+    if (!globalBuilt)
     {
-      this->BuildCache(true, revertOrder);
+      this->BuildRankIndex(index);
     }
 
     // ------------------------------------------------------------------------
-    // Search for lower bound
+    // Look up the local rows that belong to the requested block. The index
+    // is in ascending order, the inverted order simply reads it backward.
     // ------------------------------------------------------------------------
-    vtkIdType nbElementsToRemoveFromHead = 0;
-    vtkIdType localOffset = 0;
-    vtkIdType nbElementsInBar = 0;
-    this->SearchGlobalIndexLocation((block * blockSize), this->LocalSorter->Histo,
-      this->GlobalHistogram, nbElementsToRemoveFromHead, localOffset, nbElementsInBar);
-
-    // ------------------------------------------------------------------------
-    // Search for upper bound
-    // ------------------------------------------------------------------------
-    vtkIdType upperOffset = 0;
-    vtkIdType globalUpperOffset = 0;
-    vtkIdType searchIdx = (this->GlobalHistogram->TotalValues < (block + 1) * blockSize)
-      ? this->GlobalHistogram->TotalValues
-      : ((block + 1) * blockSize);
-    searchIdx--; // It is not a size it is an index (so -1)
-
-    this->SearchGlobalIndexLocation(searchIdx, this->LocalSorter->Histo, this->GlobalHistogram,
-      globalUpperOffset, upperOffset, nbElementsInBar);
-
-    // We have to include our searched index (so +1)
-    vtkIdType localSize = (upperOffset + nbElementsInBar) - localOffset + 1;
+    const vtkIdType total = index.NumberOfRows;
+    const vtkIdType lower = std::min(block * blockSize, total);
+    const vtkIdType upper = std::min(lower + blockSize, total);
+    auto first = std::lower_bound(
+      index.GlobalRank.begin(), index.GlobalRank.end(), revertOrder ? total - upper : lower);
+    auto last =
+      std::lower_bound(first, index.GlobalRank.end(), revertOrder ? total - lower : upper);
+    vtkIdType localOffset = static_cast<vtkIdType>(first - index.GlobalRank.begin());
+    vtkIdType localSize = static_cast<vtkIdType>(last - first);
 
     // ------------------------------------------------------------------------
     // Build local subset table
     // ------------------------------------------------------------------------
     vtkSmartPointer<vtkTable> localSubset;
     localSubset.TakeReference(
-      this->NewSubsetTable(input, this->LocalSorter, localOffset, localSize));
+      this->NewSubsetTable(input, &index.LocalOrder, localOffset, localSize));
+
+    // Keep the position of each row in the block to order the merged rows
+    vtkSmartPointer<vtkIdTypeArray> positions = vtkSmartPointer<vtkIdTypeArray>::New();
+    positions->SetName("vtkSortedBlockPositions");
+    positions->SetNumberOfTuples(localSize);
+    for (vtkIdType idx = 0; idx < localSize; ++idx)
+    {
+      vtkIdType rank = index.GlobalRank[localOffset + idx];
+      positions->SetValue(idx, revertOrder ? total - 1 - rank - lower : rank - lower);
+    }
+    localSubset->GetRowData()->AddArray(positions);
 
     // ------------------------------------------------------------------------
     // Find the process that will merge all subset table
@@ -906,7 +918,7 @@ public:
       vtkSmartPointer<vtkIdTypeArray> processIdArray = vtkSmartPointer<vtkIdTypeArray>::New();
       processIdArray->SetName("vtkOriginalProcessIds");
       processIdArray->SetNumberOfComponents(1);
-      processIdArray->Allocate((blockSize < localSize) ? localSize : blockSize);
+      processIdArray->Allocate(blockSize);
       for (vtkIdType idx = 0; idx < localSubset->GetNumberOfRows(); idx++)
       {
         processIdArray->InsertNextTuple1(mergePid);
@@ -937,29 +949,24 @@ public:
         this->MergeTable(i, tmp.GetPointer(), localSubset.GetPointer(), blockSize);
       }
 
-      // Sort new table/array
-      if (!this->DataToSort)
-      {
-        // This mean that no output can be provided
-        // cout << "ERROR the merge process have no DataArray." << endl;
-        return 1;
-      }
-      vtkDataArray* subsetArray =
-        vtkDataArray::SafeDownCast(localSubset->GetColumnByName(this->DataToSort->GetName()));
-
-      if (!subsetArray)
+      // Put the merged rows in the block order, no need to compare values
+      // again as every row knows its position.
+      vtkIdTypeArray* mergedPositions =
+        vtkIdTypeArray::SafeDownCast(localSubset->GetColumnByName("vtkSortedBlockPositions"));
+      vtkIdType numRows = mergedPositions ? mergedPositions->GetNumberOfTuples() : 0;
+      ArraySorter sorter;
+      sorter.FillArray(numRows);
+      for (vtkIdType idx = 0; idx < numRows; ++idx)
       {
-        vtkSortedTableStreamer::PrintInfo(localSubset.GetPointer());
+        vtkIdType position = mergedPositions->GetValue(idx);
+        if (position >= 0 && position < numRows)
+        {
+          sorter.Array[position].OriginalIndex = idx;
+        }
       }
-
-      ArraySorter sorter;
-      sorter.Update(static_cast<T*>(subsetArray->GetVoidPointer(0)),
-        subsetArray->GetNumberOfTuples(), subsetArray->GetNumberOfComponents(),
-        this->SelectedComponent, HISTOGRAM_SIZE, this->CommonRange, revertOrder);
-
-      // trim it (remove head and tail that don't belong to the result)
-      localSubset.TakeReference(this->NewSubsetTable(
-        localSubset.GetPointer(), &sorter, nbElementsToRemoveFromHead, blockSize));
+      localSubset->GetRowData()->RemoveArray("vtkSortedBlockPositions");
+      localSubset.TakeReference(
+        this->NewSubsetTable(localSubset.GetPointer(), &sorter, 0, localSubset->GetNumberOfRows()));
 
       // Add extra information such as structured indices, block number...
       this->DecorateTable(input, localSubset.GetPointer(), mergePid);
@@ -977,70 +984,230 @@ public:
   }
 
   // --------------------------------------------------------------------------
-  // nbGlobalToSkip is the number of elements that should be skipped at the end
-  // if you exactly want to reach the searchedGlobalIndex.
-  // localOffset is the corresponding local index in the sorted table to the
-  // global index of (searchedGlobalIndex - nbGlobalToSkip)
-  // nbInLocalBar is the local number of elements that are available
-  // in the histogram bar where the searchedGlobalIndex has been found.
-  // nbInLocalBar is used when you want to get an upper bound that
-  // will include the searchedGlobalIndex.
-  void SearchGlobalIndexLocation(vtkIdType searchedGlobalIndex, Histogram* localHistogram,
-    Histogram* globalHistogram, vtkIdType& nbGlobalToSkip, vtkIdType& localOffset,
-    vtkIdType& nbInLocalBar)
+  // Sort the rows of all the processes on the selected component (sample
+  // sort) and store, for each local row, its position in the global order.
+  // Each process holding rows owns a bucket of values delimited by splitters
+  // picked from regular samples of the locally sorted rows. The values are
+  // sent to the bucket owners which merge them and send back the global rank
+  // of every value. Only values and ranks are exchanged, not the rows.
+  void BuildRankIndex(RankIndex& index)
   {
-    // Communication buffer
-    vtkIdType* bufferHistogramValues = new vtkIdType[this->NumProcs * HISTOGRAM_SIZE];
-
-    // Local internal working var
-    vtkIdType histogramBarIdx = -1;
-    double currentRange[2];
-    vtkIdType idx, idxEnd;
+    // Sort the local rows, always in ascending order: the global order is a
+    // total order and the inverted one is exactly its reverse.
+    vtkIdType localSize = 0;
+    index.LocalOrder.Clear();
+    index.LocalOrder.ArraySize = 0;
+    if (this->DataToSort)
+    {
+      localSize = this->DataToSort->GetNumberOfTuples();
+      index.LocalOrder.Update(static_cast<T*>(this->DataToSort->GetVoidPointer(0)), localSize,
+        this->DataToSort->GetNumberOfComponents(), this->SelectedComponent, HISTOGRAM_SIZE,
+        this->CommonRange, false);
+    }
+    const SortableArrayItem* items = index.LocalOrder.Array;
+    index.GlobalRank.resize(localSize);
+
+    std::vector<vtkIdType> sizes(this->NumProcs);
+    this->MPI->AllGather(&localSize, sizes.data(), 1);
+    index.NumberOfRows = std::accumulate(sizes.begin(), sizes.end(), vtkIdType(0));
+    if (this->NumProcs == 1)
+    {
+      std::iota(index.GlobalRank.begin(), index.GlobalRank.end(), 0);
+      return;
+    }
 
-    // Setup initial histogram range and values
-    Histogram _globalHistogram;
-    Histogram _localHistogram;
-    localHistogram->CopyTo(_localHistogram);
-    globalHistogram->CopyTo(_globalHistogram);
+    std::vector<int> bucketOfProcess(this->NumProcs, -1);
+    int numBuckets = 0;
+    for (int pid = 0; pid < this->NumProcs; ++pid)
+    {
+      if (sizes[pid] > 0)
+      {
+        bucketOfProcess[pid] = numBuckets++;
+      }
+    }
+    if (numBuckets == 0)
+    {
+      return;
+    }
+    const int myBucket = bucketOfProcess[this->Me];
 
-    // Reset local offsets
-    localOffset = 0;
-    nbGlobalToSkip = searchedGlobalIndex;
+    // Pick the splitters among regular samples of every process. Samples are
+    // exchanged as double: the conversion keeps the order and equal values
+    // always end up in the same bucket, which is all the partition needs.
+    vtkIdType numSamples = std::min(localSize, static_cast<vtkIdType>(numBuckets));
+    std::vector<double> samples(numSamples);
+    for (vtkIdType idx = 0; idx < numSamples; ++idx)
+    {
+      vtkIdType sampleIdx = ((2 * idx + 1) * localSize) / (2 * numSamples);
+      samples[idx] = static_cast<double>(items[sampleIdx].Value);
+    }
+    std::vector<vtkIdType> sampleCounts(this->NumProcs);
+    std::vector<vtkIdType> sampleOffsets(this->NumProcs, 0);
+    this->MPI->AllGather(&numSamples, sampleCounts.data(), 1);
+    for (int pid = 1; pid < this->NumProcs; ++pid)
+    {
+      sampleOffsets[pid] = sampleOffsets[pid - 1] + sampleCounts[pid - 1];
+    }
+    std::vector<double> allSamples(sampleOffsets.back() + sampleCounts.back());
+    this->MPI->AllGatherV(samples.data(), allSamples.data(), numSamples, sampleCounts.data(),
+      sampleOffsets.data());
+    std::sort(allSamples.begin(), allSamples.end());
 
-    do
+    // Bucket b holds the values v such that splitter[b - 1] < v <= splitter[b]
+    std::vector<vtkIdType> bucketStart(numBuckets + 1, localSize);
+    bucketStart[0] = 0;
+    for (int bucket = 1; bucket < numBuckets; ++bucket)
     {
-      nbGlobalToSkip -= _globalHistogram.GetNewRange(nbGlobalToSkip, histogramBarIdx, currentRange);
+      double splitter = allSamples[(bucket * allSamples.size()) / numBuckets];
+      bucketStart[bucket] = std::upper_bound(items + bucketStart[bucket - 1], items + localSize,
+                              splitter,
+                              [](double value, const SortableArrayItem& item) {
+                                return value < static_cast<double>(item.Value);
+                              }) -
+        items;
+    }
 
-      localOffset += _localHistogram.GetNumberOfElements(0, histogramBarIdx);
-      nbInLocalBar = _localHistogram.GetNumberOfElements(histogramBarIdx, histogramBarIdx + 1);
+    // Global position of the first value of each bucket
+    std::vector<vtkIdType> localBucketSizes(numBuckets);
+    std::vector<vtkIdType> bucketSizes(numBuckets);
+    for (int bucket = 0; bucket < numBuckets; ++bucket)
+    {
+      localBucketSizes[bucket] = bucketStart[bucket + 1] - bucketStart[bucket];
+    }
+    this->MPI->AllReduce(
+      localBucketSizes.data(), bucketSizes.data(), numBuckets, vtkCommunicator::SUM_OP);
 
-      // Based on a narrowed range, build local histogram to get closer to the
-      // real index of the object
-      _localHistogram.SetScalarRange(currentRange);
-      _localHistogram.ClearHistogramValues();
+    // Send each bucket to its owner. The values of a process come sorted.
+    auto getRun = [&](int bucket) {
+      std::vector<T> run;
+      run.reserve(localBucketSizes[bucket]);
+      for (vtkIdType idx = bucketStart[bucket]; idx < bucketStart[bucket + 1]; ++idx)
+      {
+        run.push_back(items[idx].Value);
+      }
+      return run;
+    };
+    std::vector<std::vector<T> > runs(this->NumProcs);
+    if (myBucket >= 0)
+    {
+      runs[this->Me] = getRun(myBucket);
+    }
+    this->ExchangeWithAll(
+      [&](int pid) {
+        if (bucketOfProcess[pid] >= 0)
+        {
+          this->SendVector(getRun(bucketOfProcess[pid]), pid);
+        }
+      },
+      [&](int pid) {
+        if (myBucket >= 0)
+        {
+          this->ReceiveVector(runs[pid], pid);
+        }
+      });
 
-      idxEnd = localOffset + nbInLocalBar;
-      for (idx = localOffset; idx < idxEnd; ++idx)
+    // Merge the bucket. Equal values are ordered by process id then by local
+    // order, which is the order the local sort gives on each process.
+    std::vector<std::vector<vtkIdType> > ranks(this->NumProcs);
+    if (myBucket >= 0)
+    {
+      std::vector<BucketItem> merged;
+      merged.reserve(bucketSizes[myBucket]);
+      for (int pid = 0; pid < this->NumProcs; ++pid)
       {
-        _localHistogram.AddValue(this->LocalSorter->Array[idx].Value);
+        for (size_t pos = 0; pos < runs[pid].size(); ++pos)
+        {
+          merged.push_back(BucketItem{ runs[pid][pos], pid, static_cast<vtkIdType>(pos) });
+        }
+        ranks[pid].resize(runs[pid].size());
+        std::vector<T>().swap(runs[pid]);
       }
+      std::sort(merged.begin(), merged.end());
 
-      // Exchange local histo with everyone
-      this->MPI->AllGather(_localHistogram.Values, bufferHistogramValues, HISTOGRAM_SIZE);
+      vtkIdType rank = std::accumulate(
+        bucketSizes.begin(), bucketSizes.begin() + myBucket, static_cast<vtkIdType>(0));
+      for (const BucketItem& item : merged)
+      {
+        ranks[item.Process][item.Position] = rank++;
+      }
+    }
 
-      // Build global histogram
-      _globalHistogram.SetScalarRange(currentRange);
-      _globalHistogram.ClearHistogramValues();
+    // Get back the global rank of the local values
+    auto setRanks = [&](int bucket, const std::vector<vtkIdType>& bucketRanks) {
+      vtkIdType count =
+        std::min(static_cast<vtkIdType>(bucketRanks.size()), localBucketSizes[bucket]);
+      std::copy(bucketRanks.begin(), bucketRanks.begin() + count,
+        index.GlobalRank.begin() + bucketStart[bucket]);
+    };
+    if (myBucket >= 0)
+    {
+      setRanks(myBucket, ranks[this->Me]);
+    }
+    this->ExchangeWithAll(
+      [&](int pid) {
+        if (myBucket >= 0)
+        {
+          this->SendVector(ranks[pid], pid);
+        }
+      },
+      [&](int pid) {
+        if (bucketOfProcess[pid] >= 0)
+        {
+          std::vector<vtkIdType> bucketRanks;
+          this->ReceiveVector(bucketRanks, pid);
+          setRanks(bucketOfProcess[pid], bucketRanks);
+        }
+      });
+  }
 
-      idxEnd = this->NumProcs * HISTOGRAM_SIZE;
-      for (idx = 0; idx < idxEnd; ++idx)
+  // --------------------------------------------------------------------------
+  // Call send(pid) and receive(pid) with every other process. The pairs of
+  // processes are visited in the same order everywhere and the lowest id of a
+  // pair sends first, so that blocking communications can not deadlock.
+  template <typename SendFunctor, typename ReceiveFunctor>
+  void ExchangeWithAll(SendFunctor send, ReceiveFunctor receive)
+  {
+    for (int first = 0; first < this->NumProcs; ++first)
+    {
+      for (int second = first + 1; second < this->NumProcs; ++second)
       {
-        _globalHistogram.TotalValues += bufferHistogramValues[idx];
-        _globalHistogram.Values[idx % HISTOGRAM_SIZE] += bufferHistogramValues[idx];
+        if (this->Me == first)
+        {
+          send(second);
+          receive(second);
+        }
+        else if (this->Me == second)
+        {
+          receive(first);
+          send(first);
+        }
       }
-    } while (nbGlobalToSkip > 0 && _globalHistogram.CanBeReduced());
+    }
+  }
 
-    delete[] bufferHistogramValues;
+  // --------------------------------------------------------------------------
+  template <typename V>
+  void SendVector(const std::vector<V>& values, int pid)
+  {
+    vtkIdType size = static_cast<vtkIdType>(values.size());
+    this->MPI->Send(&size, 1, pid, VTK_RANK_INDEX_TAG);
+    if (size > 0)
+    {
+      this->MPI->Send(values.data(), size, pid, VTK_RANK_INDEX_TAG);
+    }
+  }
+
+  // --------------------------------------------------------------------------
+  template <typename V>
+  void ReceiveVector(std::vector<V>& values, int pid)
+  {
+    vtkIdType size = 0;
+    this->MPI->Receive(&size, 1, pid, VTK_RANK_INDEX_TAG);
+    values.resize(size);
+    if (size > 0)
+    {
+      this->MPI->Receive(values.data(), size, pid, VTK_RANK_INDEX_TAG);
+    }
   }
 
   // --------------------------------------------------------------------------
@@ -1111,8 +1278,11 @@ public:
   // --------------------------------------------------------------------------
   bool IsInvalid(vtkTable* input, vtkDataArray* dataToProcess) override
   {
-    return !dataToProcess || input->GetMTime() != this->InputMTime ||
-      dataToProcess->GetMTime() != this->DataMTime;
+    if (dataToProcess != this->DataToSort || input->GetMTime() != this->InputMTime)
+    {
+      return true;
+    }
+    return dataToProcess && dataToProcess->GetMTime() != this->DataMTime;
   }
 
   // --------------------------------------------------------------------------
@@ -1305,20 +1475,22 @@ public:
   }
   // --------------------------------------------------------------------------
 private:
-  vtkMTimeType InputMTime;    // Keep the original input MTime
-  vtkMTimeType DataMTime;     // Keep the original data MTime
-  vtkDataArray* DataToSort;   // DataArray to sort
-  ArraySorter* LocalSorter;   // Local ArraySorter based on global range
-  Histogram* GlobalHistogram; // Globaly merged Histogram based on global range
-  double CommonRange[2];      // Scalar range used across processes
-  int Me;                     // Current process ID
-  int NumProcs;               // Number of processes involved
-  vtkCommunicator* MPI;       // MPI communicator to send/receive/gather
-  int SelectedComponent;      // Component used to sort array
+  vtkMTimeType InputMTime;  // Keep the original input MTime
+  vtkMTimeType DataMTime;   // Keep the original data MTime
+  vtkDataArray* DataToSort; // DataArray to sort
+  ArraySorter* LocalSorter; // Local ArraySorter used to extract unsorted rows
+  double CommonRange[2];    // Scalar range used across processes
+  int Me;                   // Current process ID
+  int NumProcs;             // Number of processes involved
+  vtkCommunicator* MPI;     // MPI communicator to send/receive/gather
+  int SelectedComponent;    // Component used to sort array
   bool NeedToBuildCache;
   bool Debug;
+  std::map<int, ComponentRange> SortableComponents; // IsSortable() per component
+  std::map<int, RankIndex> RankIndices;             // Global order per component
 
   const static int VTK_TABLE_EXCHANGE_TAG = 50;
+  const static int VTK_RANK_INDEX_TAG = 51;
   // HISTOGRAM_SIZE could be computed dynamically based on the type of the
   // array to sort but to make sure that unsigned char won't be distributed
   // correctly we set the histogram size to be their max number of element
@@ -1342,6 +1514,7 @@ vtkSortedTableStreamer::vtkSortedTableStreamer()
   this->BlockSize = 1024;
   this->Internal = 0;
   this->SelectedComponent = 0;
+  this->MergedInputMTime = 0;
   this->SetController(vtkMultiProcessController::GetGlobalController());
 }
 
@@ -1546,24 +1719,36 @@ int vtkSortedTableStreamer::RequestData(vtkInformation* vtkNotUsed(request),
   bool orderInverted = this->InvertOrder > 0;
 
   // Convert a composite dataset into a vtkTable input.
+  // The merged table is kept until the input changes so that the sorted
+  // index built on it can be reused when fetching other blocks.
   if (auto inputCD = vtkCompositeDataSet::SafeDownCast(inputDO))
   {
-    input = this->MergeBlocks(inputCD);
-    if (input->GetColumnByName("vtkCompositeIndexArray") == nullptr)
+    if (!this->MergedInput || this->MergedInputMTime != inputCD->GetMTime())
     {
-      auto array = this->GenerateCompositeIndexArray(inputCD, input->GetNumberOfRows());
-      input->GetRowData()->AddArray(array);
-    }
-    if (input->GetColumnByName("vtkBlockNameIndices") == nullptr)
-    {
-      // add name array.
-      auto array_pair = this->GenerateBlockNameArray(inputCD, input->GetNumberOfRows());
-      if (array_pair.first && array_pair.second)
+      input = this->MergeBlocks(inputCD);
+      if (input->GetColumnByName("vtkCompositeIndexArray") == nullptr)
       {
-        input->GetRowData()->AddArray(array_pair.second);
-        input->GetFieldData()->AddArray(array_pair.first);
+        auto array = this->GenerateCompositeIndexArray(inputCD, input->GetNumberOfRows());
+        input->GetRowData()->AddArray(array);
       }
+      if (input->GetColumnByName("vtkBlockNameIndices") == nullptr)
+      {
+        // add name array.
+        auto array_pair = this->GenerateBlockNameArray(inputCD, input->GetNumberOfRows());
+        if (array_pair.first && array_pair.second)
+        {
+          input->GetRowData()->AddArray(array_pair.second);
+          input->GetFieldData()->AddArray(array_pair.first);
+        }
+      }
+      this->MergedInput = input;
+      this->MergedInputMTime = inputCD->GetMTime();
     }
+    input = this->MergedInput;
+  }
+  else
+  {
+    this->MergedInput = nullptr;
   }
 
   // Get input data
@@ -1639,16 +1824,8 @@ void vtkSortedTableStreamer::SetColumnNameToSort(const char* columnName)
 //----------------------------------------------------------------------------
 void vtkSortedTableStreamer::SetInvertOrder(int newValue)
 {
-  bool changed = this->InvertOrder != newValue;
-  bool removeInternal = changed && strcmp("vtkOriginalProcessIds", this->GetColumnToSort()) != 0;
-
-  if (removeInternal && this->Internal)
-  {
-    delete this->Internal;
-    this->Internal = 0;
-  }
-
-  if (changed)
+  // The sorted index is valid for both orders, no need to reset it.
+  if (this->InvertOrder != newValue)
   {
     this->InvertOrder = newValue;
     this->Modified();
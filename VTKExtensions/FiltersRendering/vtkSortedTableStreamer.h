@@ -20,6 +20,11 @@
  * This filter is used quickly get a sorted subset of a given vtkTable.
  * By sorted we mean a subset build from a global sort even if some optimisation
  * allow us to skip a global table sorting.
+ *
+ * The first request for a given column and component sorts the rows across
+ * all processes and keeps the global position of every local row. Requesting
+ * another block, or inverting the order, then only looks up that index until
+ * the input or the column to sort changes.
 */
 
 #ifndef vtkSortedTableStreamer_h
@@ -142,6 +147,9 @@ private:
     vtkCompositeDataSet* cd, vtkIdType maxSize);
   std::pair<vtkSmartPointer<vtkStringArray>, vtkSmartPointer<vtkIdTypeArray> >
   GenerateBlockNameArray(vtkCompositeDataSet* cd, vtkIdType maxSize);
+
+  vtkSmartPointer<vtkTable> MergedInput;
+  vtkMTimeType MergedInputMTime;
 };
 
 #endif
@@ -0,0 +1,205 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestCSVWriterPerformance.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Benchmark for vtkCSVWriter. Tables with a single int, double or string
+// column are written with vtkCSVWriter and with the stream based formatting
+// it used previously. The throughput of both is reported and the files must
+// be identical. Doubles written with UseShortestRoundTrip must read back to
+// the same values.
+//
+// Usage: TestCSVWriterPerformance -T <tempdir> [--rows N]
+
+#include "vtkCSVWriter.h"
+#include "vtkDoubleArray.h"
+#include "vtkIntArray.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkStringArray.h"
+#include "vtkTable.h"
+#include "vtkTesting.h"
+#include "vtkTimerLog.h"
+
+#include "vtksys/FStream.hxx"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+namespace
+{
+std::string ReadFile(const std::string& fname)
+{
+  vtksys::ifstream file(fname.c_str(), ios::in | ios::binary);
+  std::ostringstream contents;
+  contents << file.rdbuf();
+  return contents.str();
+}
+
+// formats the column as vtkCSVWriter did before values were formatted in
+// parallel: through an ostream, one value at a time.
+template <typename ArrayT>
+void WriteReference(const std::string& fname, ArrayT* array, int precision)
+{
+  vtksys::ofstream stream(fname.c_str(), ios::out);
+  stream << "\"" << array->GetName() << "\"\n";
+  stream << std::setprecision(precision);
+  for (vtkIdType cc = 0, max = array->GetNumberOfValues(); cc < max; ++cc)
+  {
+    stream << array->GetValue(cc) << "\n";
+  }
+}
+
+template <>
+void WriteReference(const std::string& fname, vtkStringArray* array, int)
+{
+  vtksys::ofstream stream(fname.c_str(), ios::out);
+  stream << "\"" << array->GetName() << "\"\n";
+  for (vtkIdType cc = 0, max = array->GetNumberOfValues(); cc < max; ++cc)
+  {
+    stream << "\"" << array->GetValue(cc) << "\"\n";
+  }
+}
+
+void WriteCSV(const std::string& fname, vtkAbstractArray* array, int precision, bool shortest)
+{
+  vtkNew<vtkTable> table;
+  table->AddColumn(array);
+
+  vtkNew<vtkCSVWriter> writer;
+  writer->SetController(nullptr);
+  writer->SetFileName(fname.c_str());
+  writer->SetPrecision(precision);
+  writer->SetUseScientificNotation(false);
+  writer->SetUseShortestRoundTrip(shortest);
+  writer->SetInputDataObject(table);
+  writer->Write();
+}
+
+double Throughput(const std::string& fname, double elapsed)
+{
+  const double megabytes = static_cast<double>(ReadFile(fname).size()) / (1024.0 * 1024.0);
+  return elapsed > 0 ? megabytes / elapsed : 0.0;
+}
+
+template <typename ArrayT>
+bool Compare(const std::string& tempDir, ArrayT* array)
+{
+  const int precision = 12;
+  const std::string refName = tempDir + "/TestCSVWriterPerformance-reference.csv";
+  const std::string csvName = tempDir + "/TestCSVWriterPerformance.csv";
+
+  vtkNew<vtkTimerLog> timer;
+  timer->StartTimer();
+  WriteReference(refName, array, precision);
+  timer->StopTimer();
+  const double refRate = Throughput(refName, timer->GetElapsedTime());
+
+  timer->StartTimer();
+  WriteCSV(csvName, array, precision, false);
+  timer->StopTimer();
+  const double csvRate = Throughput(csvName, timer->GetElapsedTime());
+
+  cout << array->GetName() << ": stream " << refRate << " MB/s, vtkCSVWriter " << csvRate
+       << " MB/s" << endl;
+
+  if (ReadFile(refName) != ReadFile(csvName))
+  {
+    vtkLogF(ERROR, "'%s' column differs from the stream formatting.", array->GetName());
+    return false;
+  }
+  return true;
+}
+
+bool CheckShortestRoundTrip(const std::string& tempDir, vtkDoubleArray* array)
+{
+  const std::string csvName = tempDir + "/TestCSVWriterPerformance-shortest.csv";
+  vtkNew<vtkTimerLog> timer;
+  timer->StartTimer();
+  WriteCSV(csvName, array, 5, true);
+  timer->StopTimer();
+  cout << array->GetName() << " (shortest round trip): vtkCSVWriter "
+       << Throughput(csvName, timer->GetElapsedTime()) << " MB/s" << endl;
+
+  std::istringstream lines(ReadFile(csvName));
+  std::string line;
+  std::getline(lines, line); // header
+  vtkIdType cc = 0;
+  for (; std::getline(lines, line); ++cc)
+  {
+    if (cc >= array->GetNumberOfValues() || strtod(line.c_str(), nullptr) != array->GetValue(cc))
+    {
+      vtkLogF(ERROR, "value %lld does not round trip ('%s').", static_cast<long long>(cc),
+        line.c_str());
+      return false;
+    }
+    // short decimal values must not be padded with digits.
+    if (array->GetValue(cc) == 0.1 && line != "0.1")
+    {
+      vtkLogF(ERROR, "0.1 written as '%s'.", line.c_str());
+      return false;
+    }
+  }
+  if (cc != array->GetNumberOfValues())
+  {
+    vtkLogF(ERROR, "incorrect row count, expected %lld, got %lld.",
+      static_cast<long long>(array->GetNumberOfValues()), static_cast<long long>(cc));
+    return false;
+  }
+  return true;
+}
+}
+
+int TestCSVWriterPerformance(int argc, char* argv[])
+{
+  vtkIdType numRows = 200000;
+  for (int cc = 1; cc + 1 < argc; ++cc)
+  {
+    if (strcmp(argv[cc], "--rows") == 0)
+    {
+      numRows = atoi(argv[cc + 1]);
+    }
+  }
+
+  vtkNew<vtkTesting> testing;
+  testing->AddArguments(argc, argv);
+  if (!testing->GetTempDirectory())
+  {
+    vtkLogF(ERROR, "no temp directory specified!");
+    return EXIT_FAILURE;
+  }
+  const std::string tempDir = testing->GetTempDirectory();
+
+  vtkNew<vtkIntArray> ints;
+  ints->SetName("Int");
+  vtkNew<vtkDoubleArray> doubles;
+  doubles->SetName("Double");
+  vtkNew<vtkStringArray> strings;
+  strings->SetName("String");
+  ints->SetNumberOfTuples(numRows);
+  doubles->SetNumberOfTuples(numRows);
+  strings->SetNumberOfTuples(numRows);
+  for (vtkIdType cc = 0; cc < numRows; ++cc)
+  {
+    ints->SetValue(cc, static_cast<int>((cc * 7919) % 2000003) - 1000000);
+    doubles->SetValue(cc, cc % 10 == 0 ? 0.1 : std::sin(0.001 * cc) * std::pow(10.0, cc % 9 - 4));
+    strings->SetValue(cc, "row " + std::to_string(cc));
+  }
+
+  const bool success = Compare(tempDir, ints.Get()) && Compare(tempDir, doubles.Get()) &&
+    Compare(tempDir, strings.Get()) && CheckShortestRoundTrip(tempDir, doubles);
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -28,14 +28,23 @@
 #include "vtkPointData.h"
 #include "vtkPointSet.h"
 #include "vtkPolyData.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
+#include "vtkStdString.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkTable.h"
 
 #include "vtksys/FStream.hxx"
 
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
 #include <numeric>
 #include <sstream>
+#include <type_traits>
 #include <vector>
 
 vtkStandardNewMacro(vtkCSVWriter);
@@ -51,6 +60,7 @@ vtkCSVWriter::vtkCSVWriter()
   this->FileName = 0;
   this->Precision = 5;
   this->UseScientificNotation = true;
+  this->UseShortestRoundTrip = false;
   this->FieldAssociation = 0;
   this->AddMetaData = false;
   this->AddTime = false;
@@ -97,93 +107,142 @@ int vtkCSVWriter::ProcessRequest(
 namespace
 {
 //-----------------------------------------------------------------------------
-template <class iterT>
-void vtkCSVWriterGetDataString(
-  iterT* iter, vtkIdType tupleIndex, ostream& stream, vtkCSVWriter* writer, bool* first)
+// Settings used to format the values. Numbers are formatted as
+// `ostream << std::setprecision(Precision)` (optionally with `std::scientific`)
+// would, but directly into a character buffer.
+struct vtkCSVWriterFormat
 {
-  int numComps = iter->GetNumberOfComponents();
-  vtkIdType index = tupleIndex * numComps;
-  for (int cc = 0; cc < numComps; cc++)
+  std::string FieldDelimiter;
+  std::string StringDelimiter;
+  int Precision = 5;
+  bool UseScientificNotation = false;
+  bool UseShortestRoundTrip = false;
+};
+
+//-----------------------------------------------------------------------------
+void vtkCSVWriterAppendFormatted(std::string& out, const char* format, int precision, double value)
+{
+  char buffer[64];
+  const int length = snprintf(buffer, sizeof(buffer), format, precision, value);
+  if (length < 0)
   {
-    if (!(*first))
-    {
-      stream << writer->GetFieldDelimiter();
-    }
-    *first = false;
-    if ((index + cc) < iter->GetNumberOfValues())
-    {
-      stream << iter->GetValue(index + cc);
-    }
+    return;
+  }
+  if (static_cast<size_t>(length) < sizeof(buffer))
+  {
+    out.append(buffer, static_cast<size_t>(length));
+  }
+  else
+  {
+    // large precision, format in place.
+    const size_t offset = out.size();
+    out.resize(offset + static_cast<size_t>(length) + 1);
+    snprintf(&out[offset], static_cast<size_t>(length) + 1, format, precision, value);
+    out.resize(offset + static_cast<size_t>(length));
   }
 }
 
 //-----------------------------------------------------------------------------
-template <>
-void vtkCSVWriterGetDataString(vtkArrayIteratorTemplate<vtkStdString>* iter, vtkIdType tupleIndex,
-  ostream& stream, vtkCSVWriter* writer, bool* first)
+// Appends the shortest representation, with `minDigits` to `maxDigits`
+// significant digits, that reads back to the same value. Any normal decimal
+// number with up to `minDigits` (DBL_DIG or FLT_DIG) digits is recovered
+// exactly, so only values that need more digits are formatted more than once.
+template <typename T>
+void vtkCSVWriterAppendShortest(std::string& out, T value, int minDigits, int maxDigits)
 {
-  int numComps = iter->GetNumberOfComponents();
-  vtkIdType index = tupleIndex * numComps;
-  for (int cc = 0; cc < numComps; cc++)
+  char buffer[32];
+  int length = 0;
+  for (int digits = minDigits; digits <= maxDigits; ++digits)
   {
-    if (!(*first))
+    length = snprintf(buffer, sizeof(buffer), "%.*g", digits, static_cast<double>(value));
+    if (!std::isfinite(value) || static_cast<T>(strtod(buffer, nullptr)) == value)
     {
-      stream << writer->GetFieldDelimiter();
-    }
-    (*first) = false;
-    if ((index + cc) < iter->GetNumberOfValues())
-    {
-      stream << writer->GetString(iter->GetValue(index + cc));
+      break;
     }
   }
+  out.append(buffer, static_cast<size_t>(length));
 }
 
 //-----------------------------------------------------------------------------
-template <>
-void vtkCSVWriterGetDataString(vtkArrayIteratorTemplate<char>* iter, vtkIdType tupleIndex,
-  ostream& stream, vtkCSVWriter* writer, bool* first)
+// integral values, including char and bits, are written as numbers.
+template <typename T>
+void vtkCSVWriterAppendValue(std::string& out, T value, const vtkCSVWriterFormat&)
 {
-  int numComps = iter->GetNumberOfComponents();
-  vtkIdType index = tupleIndex * numComps;
-  for (int cc = 0; cc < numComps; cc++)
+  typedef typename std::make_unsigned<T>::type UnsignedType;
+  char buffer[32];
+  char* const end = buffer + sizeof(buffer);
+  char* cursor = end;
+  const bool negative = value < static_cast<T>(0);
+  UnsignedType magnitude = negative ? static_cast<UnsignedType>(UnsignedType(0) -
+                                        static_cast<UnsignedType>(value))
+                                    : static_cast<UnsignedType>(value);
+  do
   {
-    if (!(*first))
-    {
-      stream << writer->GetFieldDelimiter();
-    }
-    (*first) = false;
-    if ((index + cc) < iter->GetNumberOfValues())
-    {
-      stream << static_cast<int>(iter->GetValue(index + cc));
-    }
+    *--cursor = static_cast<char>('0' + magnitude % 10);
+    magnitude = static_cast<UnsignedType>(magnitude / 10);
+  } while (magnitude != 0);
+  if (negative)
+  {
+    *--cursor = '-';
   }
+  out.append(cursor, static_cast<size_t>(end - cursor));
 }
 
 //-----------------------------------------------------------------------------
-template <>
-void vtkCSVWriterGetDataString(vtkArrayIteratorTemplate<unsigned char>* iter, vtkIdType tupleIndex,
-  ostream& stream, vtkCSVWriter* writer, bool* first)
+void vtkCSVWriterAppendValue(std::string& out, double value, const vtkCSVWriterFormat& format)
 {
-  int numComps = iter->GetNumberOfComponents();
-  vtkIdType index = tupleIndex * numComps;
+  if (format.UseShortestRoundTrip)
+  {
+    vtkCSVWriterAppendShortest(out, value, DBL_DIG, std::numeric_limits<double>::max_digits10);
+  }
+  else
+  {
+    vtkCSVWriterAppendFormatted(
+      out, format.UseScientificNotation ? "%.*e" : "%.*g", format.Precision, value);
+  }
+}
+
+//-----------------------------------------------------------------------------
+void vtkCSVWriterAppendValue(std::string& out, float value, const vtkCSVWriterFormat& format)
+{
+  if (format.UseShortestRoundTrip)
+  {
+    vtkCSVWriterAppendShortest(out, value, FLT_DIG, std::numeric_limits<float>::max_digits10);
+  }
+  else
+  {
+    vtkCSVWriterAppendFormatted(out, format.UseScientificNotation ? "%.*e" : "%.*g",
+      format.Precision, static_cast<double>(value));
+  }
+}
+
+//-----------------------------------------------------------------------------
+void vtkCSVWriterAppendValue(
+  std::string& out, const vtkStdString& value, const vtkCSVWriterFormat& format)
+{
+  out += format.StringDelimiter;
+  out += value;
+  out += format.StringDelimiter;
+}
+
+//-----------------------------------------------------------------------------
+template <class iterT>
+void vtkCSVWriterAppendTuple(iterT* iter, vtkIdType tupleIndex, const vtkCSVWriterFormat& format,
+  std::string& out, bool& first)
+{
+  const int numComps = iter->GetNumberOfComponents();
+  const vtkIdType numValues = iter->GetNumberOfValues();
+  const vtkIdType index = tupleIndex * numComps;
   for (int cc = 0; cc < numComps; cc++)
   {
-    if ((index + cc) < iter->GetNumberOfValues())
+    if (!first)
     {
-      if (*first == false)
-      {
-        stream << writer->GetFieldDelimiter();
-      }
-      *first = false;
-      stream << static_cast<int>(iter->GetValue(index + cc));
+      out += format.FieldDelimiter;
     }
-    else
+    first = false;
+    if ((index + cc) < numValues)
     {
-      if (*first == false)
-      {
-        stream << writer->GetFieldDelimiter();
-      }
-      *first = false;
+      vtkCSVWriterAppendValue(out, iter->GetValue(index + cc), format);
     }
   }
 }
@@ -195,6 +254,8 @@ class vtkCSVWriter::CSVFile
   vtksys::ofstream Stream;
   std::vector<std::pair<std::string, int> > ColumnInfo;
   double Time = vtkMath::Nan();
+  std::string TimeString;
+  vtkCSVWriterFormat Format;
 
 public:
   CSVFile(double time)
@@ -259,13 +320,19 @@ public:
     }
     this->Stream << "\n";
 
-    // push the floating point precision/notation type.
-    if (self->GetUseScientificNotation())
+    // save the floating point precision/notation type and delimiters.
+    this->Format.FieldDelimiter = self->GetFieldDelimiter() ? self->GetFieldDelimiter() : "";
+    this->Format.StringDelimiter =
+      self->GetUseStringDelimiter() && self->GetStringDelimiter() ? self->GetStringDelimiter() : "";
+    this->Format.Precision = self->GetPrecision();
+    this->Format.UseScientificNotation = self->GetUseScientificNotation();
+    this->Format.UseShortestRoundTrip = self->GetUseShortestRoundTrip();
+
+    this->TimeString.clear();
+    if (!vtkMath::IsNan(this->Time))
     {
-      this->Stream << std::scientific;
+      vtkCSVWriterAppendValue(this->TimeString, this->Time, this->Format);
     }
-
-    this->Stream << std::setprecision(self->GetPrecision());
   }
 
   void WriteData(vtkTable* table, vtkCSVWriter* self)
@@ -288,14 +355,53 @@ public:
       iter->FastDelete();
     }
 
-    const auto num_tuples = dsa->GetNumberOfTuples();
-    for (vtkIdType cc = 0; cc < num_tuples; ++cc)
+    // Rows are formatted in parallel, one chunk of rows per buffer, and the
+    // buffers are then written in order. Chunks are sized for about 1 MiB of
+    // text and only a few chunks per thread are kept in memory at once.
+    const vtkIdType num_tuples = dsa->GetNumberOfTuples();
+    vtkIdType num_values_per_row = 1;
+    for (auto& iter : columnsIters)
+    {
+      num_values_per_row += iter->GetNumberOfComponents();
+    }
+    const vtkIdType chunk_size = std::max<vtkIdType>(1, (1 << 16) / num_values_per_row);
+    const vtkIdType num_threads = vtkSMPTools::GetEstimatedNumberOfThreads();
+    const vtkIdType batch_size = 4 * std::max<vtkIdType>(1, num_threads);
+    std::vector<std::string> buffers(static_cast<size_t>(batch_size));
+
+    for (vtkIdType batch_start = 0; batch_start < num_tuples;
+         batch_start += batch_size * chunk_size)
+    {
+      const vtkIdType num_chunks =
+        std::min(batch_size, (num_tuples - batch_start + chunk_size - 1) / chunk_size);
+      vtkSMPTools::For(0, num_chunks, 1, [&](vtkIdType first, vtkIdType last) {
+        for (vtkIdType chunk = first; chunk < last; ++chunk)
+        {
+          const vtkIdType start = batch_start + chunk * chunk_size;
+          std::string& buffer = buffers[static_cast<size_t>(chunk)];
+          buffer.clear();
+          this->FormatRows(columnsIters, start, std::min(start + chunk_size, num_tuples), buffer);
+        }
+      });
+      for (vtkIdType chunk = 0; chunk < num_chunks; ++chunk)
+      {
+        const std::string& buffer = buffers[static_cast<size_t>(chunk)];
+        this->Stream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+      }
+    }
+  }
+
+private:
+  void FormatRows(const std::vector<vtkSmartPointer<vtkArrayIterator> >& columnsIters,
+    vtkIdType start, vtkIdType end, std::string& out) const
+  {
+    for (vtkIdType cc = start; cc < end; ++cc)
     {
       bool first_column = true;
       if (!vtkMath::IsNan(this->Time))
       {
         // add a time column.
-        this->Stream << this->Time;
+        out += this->TimeString;
         first_column = false;
       }
 
@@ -303,15 +409,14 @@ public:
       {
         switch (iter->GetDataType())
         {
-          vtkArrayIteratorTemplateMacro(vtkCSVWriterGetDataString(
-            static_cast<VTK_TT*>(iter.GetPointer()), cc, this->Stream, self, &first_column));
+          vtkArrayIteratorTemplateMacro(vtkCSVWriterAppendTuple(
+            static_cast<VTK_TT*>(iter.GetPointer()), cc, this->Format, out, first_column));
         }
       }
-      this->Stream << "\n";
+      out += '\n';
     }
   }
 
-private:
   CSVFile(const CSVFile&) = delete;
   void operator=(const CSVFile&) = delete;
 };
@@ -491,6 +596,7 @@ void vtkCSVWriter::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "FileName: " << (this->FileName ? this->FileName : "none") << endl;
   os << indent << "UseScientificNotation: " << this->UseScientificNotation << endl;
   os << indent << "Precision: " << this->Precision << endl;
+  os << indent << "UseShortestRoundTrip: " << this->UseShortestRoundTrip << endl;
   os << indent << "FieldAssociation: " << this->FieldAssociation << endl;
   os << indent << "AddMetaData: " << this->AddMetaData << endl;
   if (this->Controller)
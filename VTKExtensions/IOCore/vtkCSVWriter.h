@@ -98,6 +98,17 @@ public:
   vtkBooleanMacro(UseScientificNotation, bool);
   //@}
 
+  //@{
+  /**
+   * When set to true (default is false), floating point values are written
+   * with the fewest digits needed to read back exactly the same value, and
+   * Precision and UseScientificNotation are ignored for them.
+   */
+  vtkSetMacro(UseShortestRoundTrip, bool);
+  vtkGetMacro(UseShortestRoundTrip, bool);
+  vtkBooleanMacro(UseShortestRoundTrip, bool);
+  //@}
+
   //@{
   /**
    * Get/set the attribute data to write if the input is either
@@ -159,6 +170,7 @@ protected:
   bool UseStringDelimiter;
   int Precision;
   bool UseScientificNotation;
+  bool UseShortestRoundTrip;
   int FieldAssociation;
   bool AddMetaData;
   bool AddTime;
@@ -34,10 +34,12 @@
 #include "vtkInformationVector.h"
 #include "vtkLogger.h"
 #include "vtkMath.h"
+#include "vtkMultiProcessController.h"
 #include "vtkObjectFactory.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStringArray.h"
 #include "vtkTypeTraits.h"
+#include "vtkXMLReader.h"
 
 #include "vtksys/FStream.hxx"
 #include "vtksys/SystemTools.hxx"
@@ -46,6 +48,7 @@
 #define VTK_CREATE(type, name) vtkSmartPointer<type> name = vtkSmartPointer<type>::New()
 
 #include <algorithm>
+#include <cstdlib>
 #include <ctype.h> // for isprint().
 #include <map>
 #include <set>
@@ -379,6 +382,120 @@ private:
 };
 }
 
+//=============================================================================
+// Time information reported by the reader for one file.
+struct vtkFileSeriesReaderFileTimes
+{
+  std::vector<double> TimeSteps;
+  std::vector<double> TimeRange;
+
+  void Get(vtkInformation* info)
+  {
+    this->TimeSteps.clear();
+    this->TimeRange.clear();
+    if (info->Has(vtkStreamingDemandDrivenPipeline::TIME_STEPS()))
+    {
+      double* steps = info->Get(vtkStreamingDemandDrivenPipeline::TIME_STEPS());
+      this->TimeSteps.assign(
+        steps, steps + info->Length(vtkStreamingDemandDrivenPipeline::TIME_STEPS()));
+    }
+    if (info->Has(vtkStreamingDemandDrivenPipeline::TIME_RANGE()))
+    {
+      double* range = info->Get(vtkStreamingDemandDrivenPipeline::TIME_RANGE());
+      this->TimeRange.assign(range, range + 2);
+    }
+  }
+
+  void Set(vtkInformation* info) const
+  {
+    info->Remove(vtkStreamingDemandDrivenPipeline::TIME_STEPS());
+    info->Remove(vtkStreamingDemandDrivenPipeline::TIME_RANGE());
+    if (!this->TimeSteps.empty())
+    {
+      info->Set(vtkStreamingDemandDrivenPipeline::TIME_STEPS(), &this->TimeSteps[0],
+        static_cast<int>(this->TimeSteps.size()));
+    }
+    if (this->TimeRange.size() == 2)
+    {
+      info->Set(vtkStreamingDemandDrivenPipeline::TIME_RANGE(), &this->TimeRange[0], 2);
+    }
+  }
+};
+
+namespace
+{
+// Appends the times of files [begin, end) to buffer: for each file, the number
+// of time steps, the number of time range values, then the values.
+void SerializeFileTimes(const std::vector<vtkFileSeriesReaderFileTimes>& fileTimes, size_t begin,
+  size_t end, std::vector<double>& buffer)
+{
+  for (size_t cc = begin; cc < end; ++cc)
+  {
+    const vtkFileSeriesReaderFileTimes& times = fileTimes[cc];
+    buffer.push_back(static_cast<double>(times.TimeSteps.size()));
+    buffer.push_back(static_cast<double>(times.TimeRange.size()));
+    buffer.insert(buffer.end(), times.TimeSteps.begin(), times.TimeSteps.end());
+    buffer.insert(buffer.end(), times.TimeRange.begin(), times.TimeRange.end());
+  }
+}
+
+// Reads the times serialized by SerializeFileTimes into fileTimes, starting
+// at file begin.
+bool DeserializeFileTimes(
+  const std::vector<double>& buffer, std::vector<vtkFileSeriesReaderFileTimes>& fileTimes,
+  size_t begin)
+{
+  size_t pos = 0;
+  for (size_t cc = begin; cc < fileTimes.size(); ++cc)
+  {
+    if (pos + 2 > buffer.size())
+    {
+      return false;
+    }
+    const size_t numSteps = static_cast<size_t>(buffer[pos]);
+    const size_t numRange = static_cast<size_t>(buffer[pos + 1]);
+    pos += 2;
+    if (pos + numSteps + numRange > buffer.size())
+    {
+      return false;
+    }
+    fileTimes[cc].TimeSteps.assign(buffer.data() + pos, buffer.data() + pos + numSteps);
+    pos += numSteps;
+    fileTimes[cc].TimeRange.assign(buffer.data() + pos, buffer.data() + pos + numRange);
+    pos += numRange;
+  }
+  return pos == buffer.size();
+}
+
+// Signature of a file in the index file.
+Json::Value FileModifiedTime(const std::string& fname)
+{
+  return Json::Value(static_cast<Json::Int64>(vtksys::SystemTools::ModifiedTime(fname)));
+}
+
+Json::Value FileSize(const std::string& fname)
+{
+  return Json::Value(static_cast<Json::Int64>(vtksys::SystemTools::FileLength(fname)));
+}
+
+bool ReadTimes(const Json::Value& values, std::vector<double>& times)
+{
+  if (!values.isArray())
+  {
+    return false;
+  }
+  for (Json::ArrayIndex cc = 0; cc < values.size(); ++cc)
+  {
+    if (!values[cc].isNumeric())
+    {
+      return false;
+    }
+    times.push_back(values[cc].asDouble());
+  }
+  return true;
+}
+}
+
 //=============================================================================
 struct vtkFileSeriesReaderInternals
 {
@@ -387,8 +504,12 @@ struct vtkFileSeriesReaderInternals
   std::vector<double> TimeValues;
   bool FileNameIsSet;
   vtkFileSeriesReaderTimeRanges* TimeRanges;
+  std::vector<vtkFileSeriesReaderFileTimes> FileTimes;
 };
 
+//=============================================================================
+vtkCxxSetObjectMacro(vtkFileSeriesReader, Controller, vtkMultiProcessController);
+
 //=============================================================================
 vtkFileSeriesReader::vtkFileSeriesReader()
 {
@@ -403,11 +524,17 @@ vtkFileSeriesReader::vtkFileSeriesReader()
   this->UseJsonMetaFile = false;
 
   this->IgnoreReaderTime = false;
+
+  const char* useIndexFile = getenv("PARAVIEW_FILE_SERIES_INDEX");
+  this->UseIndexFile = useIndexFile && atoi(useIndexFile) == 1;
+
+  this->Controller = nullptr;
 }
 
 //-----------------------------------------------------------------------------
 vtkFileSeriesReader::~vtkFileSeriesReader()
 {
+  this->SetController(nullptr);
   delete this->Internal->TimeRanges;
   delete this->Internal;
 }
@@ -648,14 +775,17 @@ int vtkFileSeriesReader::RequestInformation(vtkInformation* request,
     this->Internal->TimeRanges->AddTimeRange(0, outInfo);
 
     // Query all the other files for time info.
+    this->Internal->FileTimes.resize(numFiles);
+    this->Internal->FileTimes[0].Get(outInfo);
+    this->QueryFileTimes(request, outputVector, requestFromPort);
+
+    VTK_CREATE(vtkInformation, fileInfo);
     for (unsigned int i = 1; i < numFiles; i++)
     {
-      // Expose current file number as information key for potential use in the internal reader
-      outputVector->GetInformationObject(requestFromPort)
-        ->Set(FILE_SERIES_CURRENT_FILE_NUMBER(), static_cast<int>(i));
-      this->RequestInformationForInput(static_cast<int>(i), request, outputVector);
-      this->Internal->TimeRanges->AddTimeRange(static_cast<int>(i), outInfo);
+      this->Internal->FileTimes[i].Set(fileInfo);
+      this->Internal->TimeRanges->AddTimeRange(static_cast<int>(i), fileInfo);
     }
+    this->Internal->FileTimes.clear();
   }
 
   // Now that we have collected all of the time information, set the aggregate
@@ -668,6 +798,232 @@ int vtkFileSeriesReader::RequestInformation(vtkInformation* request,
   return 1;
 }
 
+//----------------------------------------------------------------------------
+void vtkFileSeriesReader::SetDistributeTimeQueries(bool distribute)
+{
+  this->SetController(distribute ? vtkMultiProcessController::GetGlobalController() : nullptr);
+}
+
+//----------------------------------------------------------------------------
+bool vtkFileSeriesReader::GetDistributeTimeQueries()
+{
+  return this->Controller != nullptr || vtkXMLReader::SafeDownCast(this->Reader) != nullptr;
+}
+
+//----------------------------------------------------------------------------
+void vtkFileSeriesReader::QueryFileTimes(
+  vtkInformation* request, vtkInformationVector* outputVector, int port)
+{
+  std::vector<vtkFileSeriesReaderFileTimes>& fileTimes = this->Internal->FileTimes;
+  const size_t numFiles = fileTimes.size();
+  if (numFiles < 2)
+  {
+    return;
+  }
+
+  // the VTK XML readers do not communicate in RequestInformation.
+  vtkMultiProcessController* globalController = vtkMultiProcessController::GetGlobalController();
+  vtkMultiProcessController* controller = this->Controller;
+  if (!controller && vtkXMLReader::SafeDownCast(this->Reader))
+  {
+    controller = globalController;
+  }
+  const int numProcs = controller ? controller->GetNumberOfProcesses() : 1;
+  const int rank = controller ? controller->GetLocalProcessId() : 0;
+
+  // without a controller, every process queries all the files but only the
+  // first one of the job may read and write the index, or they would race.
+  const bool indexRank =
+    controller ? rank == 0 : (!globalController || globalController->GetLocalProcessId() == 0);
+
+  // the first process checks the index, all use it or none does.
+  int useIndex = (this->UseIndexFile && indexRank && this->ReadIndexFile()) ? 1 : 0;
+  if (numProcs > 1)
+  {
+    controller->Broadcast(&useIndex, 1, 0);
+  }
+
+  if (useIndex)
+  {
+    vtkLogF(TRACE, "%s: time read from '%s'", vtkLogIdentifier(this),
+      this->GetIndexFileName().c_str());
+    if (numProcs > 1)
+    {
+      std::vector<double> buffer;
+      if (rank == 0)
+      {
+        SerializeFileTimes(fileTimes, 1, numFiles, buffer);
+      }
+      vtkIdType length = static_cast<vtkIdType>(buffer.size());
+      controller->Broadcast(&length, 1, 0);
+      buffer.resize(static_cast<size_t>(length));
+      controller->Broadcast(buffer.data(), length, 0);
+      DeserializeFileTimes(buffer, fileTimes, 1);
+    }
+  }
+  else
+  {
+    // each process queries a contiguous block of files, gathered in order.
+    const size_t begin = 1 + (numFiles - 1) * rank / numProcs;
+    const size_t end = 1 + (numFiles - 1) * (rank + 1) / numProcs;
+    vtkInformation* outInfo = outputVector->GetInformationObject(port);
+    for (size_t i = begin; i < end; ++i)
+    {
+      // Expose current file number as information key for potential use in the internal reader
+      outInfo->Set(FILE_SERIES_CURRENT_FILE_NUMBER(), static_cast<int>(i));
+      this->RequestInformationForInput(static_cast<int>(i), request, outputVector);
+      fileTimes[i].Get(outInfo);
+    }
+
+    if (numProcs > 1)
+    {
+      std::vector<double> buffer;
+      SerializeFileTimes(fileTimes, begin, end, buffer);
+      vtkIdType length = static_cast<vtkIdType>(buffer.size());
+      std::vector<vtkIdType> lengths(numProcs);
+      controller->AllGather(&length, &lengths[0], 1);
+      std::vector<vtkIdType> offsets(numProcs, 0);
+      for (int cc = 1; cc < numProcs; ++cc)
+      {
+        offsets[cc] = offsets[cc - 1] + lengths[cc - 1];
+      }
+      std::vector<double> allBuffer(
+        static_cast<size_t>(offsets[numProcs - 1] + lengths[numProcs - 1]));
+      controller->AllGatherV(
+        buffer.data(), allBuffer.data(), length, lengths.data(), offsets.data());
+      DeserializeFileTimes(allBuffer, fileTimes, 1);
+    }
+
+    if (this->UseIndexFile && indexRank)
+    {
+      this->WriteIndexFile();
+    }
+  }
+
+  // as when all the files were queried in turn, leave the output information
+  // of the last file.
+  if (this->_FileIndex != static_cast<int>(numFiles - 1))
+  {
+    outputVector->GetInformationObject(port)->Set(
+      FILE_SERIES_CURRENT_FILE_NUMBER(), static_cast<int>(numFiles - 1));
+    this->RequestInformationForInput(static_cast<int>(numFiles - 1), request, outputVector);
+  }
+}
+
+//----------------------------------------------------------------------------
+std::string vtkFileSeriesReader::GetIndexFileName()
+{
+  if (this->GetNumberOfFileNames() == 0)
+  {
+    return std::string();
+  }
+  const std::string firstFile = this->GetFileName(0);
+  const std::string path = vtksys::SystemTools::GetFilenamePath(firstFile);
+  const std::string name = "." + vtksys::SystemTools::GetFilenameName(firstFile) + ".series-index";
+  return path.empty() ? name : path + "/" + name;
+}
+
+//----------------------------------------------------------------------------
+bool vtkFileSeriesReader::ReadIndexFile()
+{
+  const std::string indexFileName = this->GetIndexFileName();
+  vtksys::ifstream indexFile(indexFileName.c_str());
+  if (!indexFile)
+  {
+    return false;
+  }
+
+  Json::Value root;
+  Json::CharReaderBuilder builder;
+  builder["collectComments"] = false;
+  if (!parseFromStream(builder, indexFile, &root, nullptr) || !root.isObject() ||
+    root["file-series-index-version"] != Json::Value("1.0") ||
+    root["reader"] != Json::Value(this->Reader ? this->Reader->GetClassName() : ""))
+  {
+    return false;
+  }
+
+  std::vector<vtkFileSeriesReaderFileTimes>& fileTimes = this->Internal->FileTimes;
+  const Json::Value& files = root["files"];
+  if (!files.isArray() || files.size() != fileTimes.size())
+  {
+    return false;
+  }
+
+  // modification times are in seconds: a file modified in the same second as,
+  // or after, the index was written may have changed since it was indexed.
+  const Json::Int64 indexTime =
+    static_cast<Json::Int64>(vtksys::SystemTools::ModifiedTime(indexFileName));
+  std::vector<vtkFileSeriesReaderFileTimes> indexTimes(fileTimes.size());
+  for (Json::ArrayIndex cc = 0; cc < files.size(); ++cc)
+  {
+    const Json::Value& file = files[cc];
+    const std::string fname = this->GetFileName(static_cast<unsigned int>(cc));
+    const Json::Value mtime = FileModifiedTime(fname);
+    if (!file.isObject() || file["name"] != Json::Value(fname) || file["mtime"] != mtime ||
+      mtime.asInt64() >= indexTime || file["size"] != FileSize(fname) ||
+      !ReadTimes(file["time-steps"], indexTimes[cc].TimeSteps) ||
+      !ReadTimes(file["time-range"], indexTimes[cc].TimeRange))
+    {
+      return false;
+    }
+  }
+
+  // the first file was queried already.
+  std::copy(indexTimes.begin() + 1, indexTimes.end(), fileTimes.begin() + 1);
+  return true;
+}
+
+//----------------------------------------------------------------------------
+void vtkFileSeriesReader::WriteIndexFile()
+{
+  const std::vector<vtkFileSeriesReaderFileTimes>& fileTimes = this->Internal->FileTimes;
+  Json::Value root(Json::objectValue);
+  root["file-series-index-version"] = "1.0";
+  root["reader"] = this->Reader ? this->Reader->GetClassName() : "";
+  Json::Value& files = root["files"] = Json::Value(Json::arrayValue);
+  for (size_t cc = 0; cc < fileTimes.size(); ++cc)
+  {
+    const std::string fname = this->GetFileName(static_cast<unsigned int>(cc));
+    Json::Value file(Json::objectValue);
+    file["name"] = fname;
+    file["mtime"] = FileModifiedTime(fname);
+    file["size"] = FileSize(fname);
+    Json::Value& steps = file["time-steps"] = Json::Value(Json::arrayValue);
+    for (double step : fileTimes[cc].TimeSteps)
+    {
+      steps.append(step);
+    }
+    Json::Value& range = file["time-range"] = Json::Value(Json::arrayValue);
+    for (double value : fileTimes[cc].TimeRange)
+    {
+      range.append(value);
+    }
+    files.append(file);
+  }
+
+  // the index is only an optimization, e.g. the directory may be read-only.
+  // It is renamed once complete so that other jobs never read a partial one.
+  const std::string indexFileName = this->GetIndexFileName();
+  const std::string tmpFileName = indexFileName + ".tmp";
+  {
+    vtksys::ofstream indexFile(tmpFileName.c_str());
+    if (!indexFile)
+    {
+      vtkLogF(TRACE, "%s: cannot write '%s'", vtkLogIdentifier(this), tmpFileName.c_str());
+      return;
+    }
+    Json::StreamWriterBuilder writer;
+    writer["indentation"] = "";
+    indexFile << Json::writeString(writer, root);
+  }
+  if (!vtksys::SystemTools::RenameFile(tmpFileName, indexFileName))
+  {
+    vtkLogF(TRACE, "%s: cannot write '%s'", vtkLogIdentifier(this), indexFileName.c_str());
+    vtksys::SystemTools::RemoveFile(tmpFileName);
+  }
+}
+
 //----------------------------------------------------------------------------
 int vtkFileSeriesReader::RequestUpdateExtent(vtkInformation* request,
   vtkInformationVector** vtkNotUsed(inputVector), vtkInformationVector* outputVector)
@@ -988,6 +1344,8 @@ void vtkFileSeriesReader::PrintSelf(ostream& os, vtkIndent indent)
      << endl;
   os << indent << "UseMetaFile: " << this->UseMetaFile << endl;
   os << indent << "IgnoreReaderTime: " << this->IgnoreReaderTime << endl;
+  os << indent << "UseIndexFile: " << this->UseIndexFile << endl;
+  os << indent << "Controller: " << this->Controller << endl;
 }
 
 //-----------------------------------------------------------------------------
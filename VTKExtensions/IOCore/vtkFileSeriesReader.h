@@ -75,6 +75,20 @@
  * with SetMetaFileName in this case. Do not use the AddFileName() method when
  * using SetMetaFileName() as names set with AddFileName() will be ignored.
  *
+ * When the reader reports time, RequestInformation asks it for the time of
+ * every file. These queries are distributed between the processes of the
+ * controller and the results gathered on all of them, which makes
+ * RequestInformation a collective operation when the controller has several
+ * processes. The reader must not communicate in its own RequestInformation in
+ * that case, so the distribution is only enabled when a controller is set,
+ * e.g. with SetDistributeTimeQueries(), or for the VTK XML readers which use
+ * the global controller by default. When
+ * UseIndexFile is true, the time of each file is also saved in an index file,
+ * `.<first file name>.series-index` next to the first file, and read from it
+ * instead of querying the reader as long as the files keep the same size and
+ * modification time. Only the first process of the global controller reads
+ * and writes the index file.
+ *
 */
 
 #ifndef vtkFileSeriesReader_h
@@ -83,10 +97,12 @@
 #include "vtkMetaReader.h"
 #include "vtkPVVTKExtensionsIOCoreModule.h" //needed for exports
 
+#include <string> // Needed for public API
 #include <vector> // Needed for protected API
 
 class vtkInformationIntegerKey;
 class vtkInformationStringKey;
+class vtkMultiProcessController;
 class vtkStringArray;
 
 struct vtkFileSeriesReaderInternals;
@@ -153,6 +169,48 @@ public:
   vtkBooleanMacro(IgnoreReaderTime, bool);
   //@}
 
+  //@{
+  /**
+   * Get/Set the controller used to distribute the time queries of the files
+   * between the processes. If nullptr, this process queries all the files,
+   * unless the reader is a vtkXMLReader: these do not communicate in
+   * RequestInformation and use the global controller. Default is nullptr.
+   */
+  void SetController(vtkMultiProcessController*);
+  vtkGetObjectMacro(Controller, vtkMultiProcessController);
+  //@}
+
+  //@{
+  /**
+   * Convenience to distribute the time queries between the processes of the
+   * global controller, i.e. to set the controller to
+   * `vtkMultiProcessController::GetGlobalController()` or to nullptr. Only
+   * enable it for readers that do not communicate in RequestInformation.
+   * False by default, but the queries of a vtkXMLReader are always
+   * distributed.
+   */
+  void SetDistributeTimeQueries(bool);
+  bool GetDistributeTimeQueries();
+  vtkBooleanMacro(DistributeTimeQueries, bool);
+  //@}
+
+  //@{
+  /**
+   * If true, the time of each file is saved in an index file next to the first
+   * file and read back while the files are unchanged. False by default, unless
+   * the environment variable PARAVIEW_FILE_SERIES_INDEX is set to 1.
+   */
+  vtkGetMacro(UseIndexFile, bool);
+  vtkSetMacro(UseIndexFile, bool);
+  vtkBooleanMacro(UseIndexFile, bool);
+  //@}
+
+  /**
+   * Returns the name of the index file of the series, empty if there are no
+   * files.
+   */
+  std::string GetIndexFileName();
+
   // Expose number of files, first filename and current file number as
   // information keys for potential use in the internal reader
   static vtkInformationIntegerKey* FILE_SERIES_NUMBER_OF_FILES();
@@ -232,6 +290,8 @@ protected:
   void CopyRealFileNamesFromFileNames();
 
   bool IgnoreReaderTime;
+  bool UseIndexFile;
+  vtkMultiProcessController* Controller;
 
   int ChooseInput(vtkInformation*);
 
@@ -239,6 +299,21 @@ private:
   vtkFileSeriesReader(const vtkFileSeriesReader&) = delete;
   void operator=(const vtkFileSeriesReader&) = delete;
 
+  /**
+   * Fills the time information of all the files but the first one, from the
+   * index file when it is up to date or from the reader otherwise.
+   */
+  void QueryFileTimes(vtkInformation* request, vtkInformationVector* outputVector, int port);
+
+  //@{
+  /**
+   * Reads/writes the time information of the files from/to the index file.
+   * ReadIndexFile returns false if the index does not match the files.
+   */
+  bool ReadIndexFile();
+  void WriteIndexFile();
+  //@}
+
   vtkFileSeriesReaderInternals* Internal;
 };
 
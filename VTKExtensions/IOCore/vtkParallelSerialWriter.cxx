@@ -14,9 +14,11 @@
 =========================================================================*/
 #include "vtkParallelSerialWriter.h"
 
+#include "vtkCharArray.h"
 #include "vtkClientServerInterpreter.h"
 #include "vtkClientServerInterpreterInitializer.h"
 #include "vtkClientServerStream.h"
+#include "vtkCommunicator.h"
 #include "vtkCompositeDataIterator.h"
 #include "vtkCompositeDataSet.h"
 #include "vtkDataSet.h"
@@ -24,15 +26,21 @@
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMultiProcessController.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
+#include "vtkPVLogger.h"
 #include "vtkReductionFilter.h"
+#include "vtkSelection.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkTrivialProducer.h"
 
 #include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <sstream>
 #include <string>
+#include <vector>
 #include <vtksys/SystemTools.hxx>
 
 namespace
@@ -48,6 +56,85 @@ bool vtkIsEmpty(vtkDataObject* dobj)
   }
   return true;
 }
+
+double vtkElapsedSeconds(const std::chrono::steady_clock::time_point& start)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+enum
+{
+  STREAM_READY_TAG = 22001,
+  STREAM_SIZE_TAG = 22002,
+  STREAM_DATA_TAG = 22003
+};
+
+// Same as vtkReductionFilter::PreProcess.
+vtkSmartPointer<vtkDataObject> vtkPreGather(
+  vtkAlgorithm* preGatherHelper, vtkAlgorithm* postGatherHelper, vtkDataObject* input)
+{
+  if (!input || !preGatherHelper)
+  {
+    return input;
+  }
+
+  // don't use the input directly, the PreGatherHelper would not have the
+  // piece or time information.
+  vtkSmartPointer<vtkDataObject> incopy;
+  incopy.TakeReference(input->NewInstance());
+  incopy->ShallowCopy(input);
+  vtkNew<vtkTrivialProducer> incopyProducer;
+  incopyProducer->SetOutput(incopy);
+  preGatherHelper->RemoveAllInputs();
+  preGatherHelper->AddInputConnection(0, incopyProducer->GetOutputPort());
+  preGatherHelper->Update();
+  vtkDataObject* result = preGatherHelper->GetOutputDataObject(0);
+  preGatherHelper->RemoveAllInputs();
+
+  vtkInformation* info =
+    postGatherHelper ? postGatherHelper->GetInputPortInformation(0) : nullptr;
+  const char* expectedType = info ? info->Get(vtkAlgorithm::INPUT_REQUIRED_DATA_TYPE()) : nullptr;
+  if (expectedType && !result->IsA(expectedType))
+  {
+    vtkGenericWarningMacro("PreGatherHelper's output type is not compatible with "
+                           "the PostGatherHelper's input type.");
+    return input;
+  }
+
+  vtkSmartPointer<vtkDataObject> clone;
+  clone.TakeReference(result->NewInstance());
+  clone->ShallowCopy(result);
+  return clone;
+}
+
+// Same as vtkReductionFilter::PostProcess.
+vtkSmartPointer<vtkDataObject> vtkPostGather(
+  vtkAlgorithm* postGatherHelper, const std::vector<vtkSmartPointer<vtkDataObject> >& pieces)
+{
+  if (pieces.empty())
+  {
+    return nullptr;
+  }
+  if (!postGatherHelper)
+  {
+    // allow a passthrough, in this case just use the data from one rank.
+    return pieces[0];
+  }
+
+  postGatherHelper->RemoveAllInputs();
+  for (const auto& piece : pieces)
+  {
+    postGatherHelper->AddInputDataObject(piece);
+  }
+  postGatherHelper->Update();
+  postGatherHelper->RemoveAllInputs();
+
+  vtkDataObject* reduced = postGatherHelper->GetOutputDataObject(0);
+  vtkSmartPointer<vtkDataObject> result;
+  result.TakeReference(reduced->NewInstance());
+  result->ShallowCopy(reduced);
+  return result;
+}
 }
 
 vtkStandardNewMacro(vtkParallelSerialWriter);
@@ -59,6 +146,8 @@ vtkCxxSetObjectMacro(vtkParallelSerialWriter, Controller, vtkMultiProcessControl
 vtkParallelSerialWriter::vtkParallelSerialWriter()
   : NumberOfIORanks(1)
   , RankAssignmentMode(vtkParallelSerialWriter::ASSIGNMENT_MODE_CONTIGUOUS)
+  , AggregationMode(vtkParallelSerialWriter::AGGREGATION_MODE_GATHER)
+  , MaximumChunkSize(64 * 1024)
   , Controller(nullptr)
   , SubController(nullptr)
 {
@@ -280,21 +369,40 @@ void vtkParallelSerialWriter::WriteAFile(const std::string& filename_arg, vtkDat
 
   const auto filename = this->GetPartitionFileName(filename_arg);
 
-  vtkSmartPointer<vtkReductionFilter> reductionFilter = vtkSmartPointer<vtkReductionFilter>::New();
-  reductionFilter->SetController(controller);
-  reductionFilter->SetPreGatherHelper(this->PreGatherHelper);
-  reductionFilter->SetPostGatherHelper(this->PostGatherHelper);
-  reductionFilter->SetInputDataObject(input);
-  reductionFilter->UpdateInformation();
-  vtkInformation* outInfo = reductionFilter->GetExecutive()->GetOutputInformation(0);
-  outInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_PIECE_NUMBER(), this->Piece);
-  outInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_PIECES(), this->NumberOfPieces);
-  outInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_GHOST_LEVELS(), this->GhostLevel);
-  reductionFilter->Update();
+  double gatherTime = 0.0;
+  double serializeTime = 0.0;
+  const bool streaming = this->AggregationMode == AGGREGATION_MODE_STREAMING &&
+    controller->GetNumberOfProcesses() > 1 && vtkSelection::SafeDownCast(input) == nullptr;
+
+  vtkSmartPointer<vtkDataObject> output;
+  if (streaming)
+  {
+    output = this->StreamToIORank(controller, input, gatherTime, serializeTime);
+  }
+  else
+  {
+    const auto start = std::chrono::steady_clock::now();
+    vtkSmartPointer<vtkReductionFilter> reductionFilter =
+      vtkSmartPointer<vtkReductionFilter>::New();
+    reductionFilter->SetController(controller);
+    reductionFilter->SetPreGatherHelper(this->PreGatherHelper);
+    reductionFilter->SetPostGatherHelper(this->PostGatherHelper);
+    reductionFilter->SetInputDataObject(input);
+    reductionFilter->UpdateInformation();
+    vtkInformation* outInfo = reductionFilter->GetExecutive()->GetOutputInformation(0);
+    outInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_PIECE_NUMBER(), this->Piece);
+    outInfo->Set(
+      vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_PIECES(), this->NumberOfPieces);
+    outInfo->Set(
+      vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_GHOST_LEVELS(), this->GhostLevel);
+    reductionFilter->Update();
+    output = reductionFilter->GetOutputDataObject(0);
+    gatherTime = vtkElapsedSeconds(start);
+  }
 
+  double writeTime = 0.0;
   if (controller->GetLocalProcessId() == 0)
   {
-    vtkDataObject* output = reductionFilter->GetOutputDataObject(0);
     if (vtkIsEmpty(output) == false)
     {
       std::ostringstream fname;
@@ -319,12 +427,114 @@ void vtkParallelSerialWriter::WriteAFile(const std::string& filename_arg, vtkDat
       {
         fname << filename;
       }
+      const auto start = std::chrono::steady_clock::now();
       this->Writer->SetInputDataObject(output);
       this->SetWriterFileName(fname.str().c_str());
       this->WriteInternal();
       this->Writer->SetInputConnection(0);
+      writeTime = vtkElapsedSeconds(start);
+    }
+  }
+
+  if (streaming)
+  {
+    vtkVLogF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(),
+      "%s: gather %.3f s, serialize %.3f s, write %.3f s (streaming)", filename.c_str(),
+      gatherTime, serializeTime, writeTime);
+  }
+  else
+  {
+    vtkVLogF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(),
+      "%s: gather (and serialize) %.3f s, write %.3f s", filename.c_str(), gatherTime,
+      writeTime);
+  }
+}
+
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkDataObject> vtkParallelSerialWriter::StreamToIORank(
+  vtkMultiProcessController* controller, vtkDataObject* input, double& gatherTime,
+  double& serializeTime)
+{
+  const int myid = controller->GetLocalProcessId();
+  const int numRanks = controller->GetNumberOfProcesses();
+  const vtkIdType chunkSize = static_cast<vtkIdType>(this->MaximumChunkSize) * 1024;
+
+  auto start = std::chrono::steady_clock::now();
+  vtkSmartPointer<vtkDataObject> local =
+    vtkPreGather(this->PreGatherHelper, this->PostGatherHelper, input);
+  gatherTime += vtkElapsedSeconds(start);
+
+  vtkNew<vtkCharArray> buffer;
+  if (myid != 0)
+  {
+    // serialize while the IO rank receives the data of the previous ranks.
+    start = std::chrono::steady_clock::now();
+    vtkIdType size = 0;
+    if (!vtkIsEmpty(local) && vtkCommunicator::MarshalDataObject(local, buffer))
+    {
+      size = buffer->GetNumberOfValues();
+    }
+    local = nullptr;
+    serializeTime += vtkElapsedSeconds(start);
+
+    start = std::chrono::steady_clock::now();
+    int ready = 0;
+    controller->Receive(&ready, 1, 0, STREAM_READY_TAG);
+    controller->Send(&size, 1, 0, STREAM_SIZE_TAG);
+    for (vtkIdType offset = 0; offset < size; offset += chunkSize)
+    {
+      controller->Send(
+        buffer->GetPointer(offset), std::min(chunkSize, size - offset), 0, STREAM_DATA_TAG);
+    }
+    gatherTime += vtkElapsedSeconds(start);
+    return nullptr;
+  }
+
+  std::vector<vtkSmartPointer<vtkDataObject> > pieces;
+  if (!vtkIsEmpty(local))
+  {
+    pieces.push_back(local);
+  }
+  local = nullptr;
+
+  for (int rank = 1; rank < numRanks; ++rank)
+  {
+    // ranks only send once asked to, so that a single serialized piece is
+    // held here at a time.
+    start = std::chrono::steady_clock::now();
+    int ready = 1;
+    controller->Send(&ready, 1, rank, STREAM_READY_TAG);
+    vtkIdType size = 0;
+    controller->Receive(&size, 1, rank, STREAM_SIZE_TAG);
+    buffer->SetNumberOfValues(size);
+    for (vtkIdType offset = 0; offset < size; offset += chunkSize)
+    {
+      controller->Receive(
+        buffer->GetPointer(offset), std::min(chunkSize, size - offset), rank, STREAM_DATA_TAG);
+    }
+    gatherTime += vtkElapsedSeconds(start);
+
+    if (size > 0)
+    {
+      start = std::chrono::steady_clock::now();
+      vtkSmartPointer<vtkDataObject> piece = vtkCommunicator::UnMarshalDataObject(buffer);
+      serializeTime += vtkElapsedSeconds(start);
+      if (piece)
+      {
+        pieces.push_back(piece);
+      }
+      else
+      {
+        vtkErrorMacro("Failed to deserialize the data received from rank " << rank << ".");
+      }
     }
   }
+  buffer->Initialize();
+
+  start = std::chrono::steady_clock::now();
+  vtkSmartPointer<vtkDataObject> result = vtkPostGather(this->PostGatherHelper, pieces);
+  gatherTime += vtkElapsedSeconds(start);
+  return result;
 }
 
 //----------------------------------------------------------------------------
@@ -387,4 +597,8 @@ void vtkParallelSerialWriter::SetWriterFileName(const char* fname)
 void vtkParallelSerialWriter::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "NumberOfIORanks: " << this->NumberOfIORanks << endl;
+  os << indent << "RankAssignmentMode: " << this->RankAssignmentMode << endl;
+  os << indent << "AggregationMode: " << this->AggregationMode << endl;
+  os << indent << "MaximumChunkSize: " << this->MaximumChunkSize << endl;
 }
@@ -191,6 +191,41 @@ public:
   vtkGetMacro(RankAssignmentMode, int);
   //@}
 
+  enum
+  {
+    AGGREGATION_MODE_GATHER,
+    AGGREGATION_MODE_STREAMING
+  };
+
+  //@{
+  /**
+   * Controls how the data of the ranks of a group is moved to the rank that
+   * writes it to disk.
+   *
+   * In AGGREGATION_MODE_GATHER (default), the data of all the ranks of the group
+   * is gathered at once using vtkReductionFilter, thus the IO rank holds the
+   * serialized data of all ranks in addition to the deserialized data.
+   *
+   * In AGGREGATION_MODE_STREAMING, the IO rank receives the data of one rank at
+   * a time, in messages of at most `MaximumChunkSize` KiB, and deserializes it
+   * before receiving the next one. The other ranks serialize their data while
+   * the IO rank receives from the ranks before them. The IO rank thus holds the
+   * serialized data of a single rank at a time. Selections are always gathered.
+   */
+  vtkSetClampMacro(
+    AggregationMode, int, AGGREGATION_MODE_GATHER, AGGREGATION_MODE_STREAMING);
+  vtkGetMacro(AggregationMode, int);
+  //@}
+
+  //@{
+  /**
+   * Maximum size, in KiB, of the messages sent to the IO ranks in
+   * AGGREGATION_MODE_STREAMING. Default is 65536 (64 MiB).
+   */
+  vtkSetClampMacro(MaximumChunkSize, int, 1, VTK_INT_MAX);
+  vtkGetMacro(MaximumChunkSize, int);
+  //@}
+
   //@{
   /**
    * Get/Set the controller to use. By default initialized to
@@ -223,6 +258,15 @@ private:
 
   std::string GetPartitionFileName(const std::string& fname);
 
+  /**
+   * Moves the data of all ranks of `controller` to its rank 0, one rank at a
+   * time, see AGGREGATION_MODE_STREAMING. Returns the reduced data on rank 0,
+   * nullptr elsewhere. The time spent moving and serializing data is added to
+   * `gatherTime` and `serializeTime`.
+   */
+  vtkSmartPointer<vtkDataObject> StreamToIORank(vtkMultiProcessController* controller,
+    vtkDataObject* input, double& gatherTime, double& serializeTime);
+
   vtkAlgorithm* PreGatherHelper;
   vtkAlgorithm* PostGatherHelper;
 
@@ -244,6 +288,8 @@ private:
 
   int NumberOfIORanks;
   int RankAssignmentMode;
+  int AggregationMode;
+  int MaximumChunkSize;
 
   vtkMultiProcessController* Controller;
   vtkSmartPointer<vtkMultiProcessController> SubController;
@@ -1,10 +1,46 @@
+#include "vtkCellData.h"
 #include "vtkCellTypes.h"
+#include "vtkDataArray.h"
 #include "vtkMultiBlockDataSet.h"
 #include "vtkNew.h"
 #include "vtkPGenericEnSightReader.h"
+#include "vtkPointData.h"
 #include "vtkTestUtilities.h"
 #include "vtkUnstructuredGrid.h"
 
+namespace
+{
+bool CompareArrays(vtkFieldData* fd, vtkFieldData* expected)
+{
+  if (fd->GetNumberOfArrays() != expected->GetNumberOfArrays())
+  {
+    std::cerr << "Wrong number of arrays." << std::endl;
+    return false;
+  }
+  for (int cc = 0; cc < expected->GetNumberOfArrays(); ++cc)
+  {
+    vtkDataArray* expectedArray = expected->GetArray(cc);
+    vtkDataArray* array = fd->GetArray(expectedArray->GetName());
+    if (!array || array->GetNumberOfTuples() != expectedArray->GetNumberOfTuples() ||
+      array->GetNumberOfComponents() != expectedArray->GetNumberOfComponents())
+    {
+      std::cerr << "Mismatched array " << expectedArray->GetName() << "." << std::endl;
+      return false;
+    }
+    for (vtkIdType i = 0; i < array->GetNumberOfValues(); ++i)
+    {
+      const int nc = array->GetNumberOfComponents();
+      if (array->GetComponent(i / nc, i % nc) != expectedArray->GetComponent(i / nc, i % nc))
+      {
+        std::cerr << "Mismatched values in " << expectedArray->GetName() << "." << std::endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+}
+
 int TestPEnSightBinaryGoldReader(int argc, char* argv[])
 {
   char* fname =
@@ -43,5 +79,21 @@ int TestPEnSightBinaryGoldReader(int argc, char* argv[])
     }
   }
 
+  // reading the memory-mapped files must give the same arrays.
+  vtkNew<vtkPGenericEnSightReader> mappedReader;
+  mappedReader->SetCaseFileName(fname);
+  mappedReader->UseMemoryMappedIOOn();
+  mappedReader->Update();
+  vtkUnstructuredGrid* mappedUG =
+    vtkUnstructuredGrid::SafeDownCast(mappedReader->GetOutput()->GetBlock(0));
+  if (!mappedUG || mappedUG->GetNumberOfPoints() != ug->GetNumberOfPoints() ||
+    mappedUG->GetNumberOfCells() != ug->GetNumberOfCells() ||
+    !CompareArrays(mappedUG->GetPointData(), ug->GetPointData()) ||
+    !CompareArrays(mappedUG->GetCellData(), ug->GetCellData()))
+  {
+    std::cerr << "Memory-mapped read differs from the stream read." << std::endl;
+    return EXIT_FAILURE;
+  }
+
   return EXIT_SUCCESS;
 }
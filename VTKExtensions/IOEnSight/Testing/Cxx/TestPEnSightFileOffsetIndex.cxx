@@ -0,0 +1,244 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestPEnSightFileOffsetIndex.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Tests the file offset index of vtkPEnSightGoldBinaryReader on a single file
+// transient EnSight Gold binary geometry: the index is saved, reloaded and
+// used by another reader, and rebuilt when the geometry file is rewritten.
+
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkPGenericEnSightReader.h"
+#include "vtkTestUtilities.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <vtksys/FStream.hxx>
+#include <vtksys/SystemTools.hxx>
+
+#include <cstring>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+const int NumberOfTimeSteps = 3;
+
+void WriteLine(vtksys::ofstream& file, const char* text)
+{
+  char line[80];
+  memset(line, 0, sizeof(line));
+  strncpy(line, text, sizeof(line) - 1);
+  file.write(line, sizeof(line));
+}
+
+template <class T>
+void WriteValue(vtksys::ofstream& file, T value)
+{
+  file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+// Size of a time step of the geometry file, in bytes.
+long TimeStepSize(int numberOfQuads)
+{
+  const int numberOfPoints = 2 * (numberOfQuads + 1);
+  return static_cast<long>(10 * 80 + 3 * sizeof(int) + 3 * sizeof(float) * numberOfPoints +
+    4 * sizeof(int) * numberOfQuads);
+}
+
+// Each time step is a strip of quads whose x coordinates start at
+// 10 * time step.
+void WriteGeometry(const std::string& fileName, int numberOfQuads)
+{
+  vtksys::ofstream file(fileName.c_str(), ios::out | ios::binary);
+  WriteLine(file, "C Binary");
+  for (int step = 0; step < NumberOfTimeSteps; ++step)
+  {
+    WriteLine(file, "BEGIN TIME STEP");
+    WriteLine(file, "file offset index test");
+    WriteLine(file, "geometry");
+    WriteLine(file, "node id off");
+    WriteLine(file, "element id off");
+    WriteLine(file, "part");
+    WriteValue<int>(file, 1);
+    WriteLine(file, "strip");
+    WriteLine(file, "coordinates");
+    const int numberOfPoints = 2 * (numberOfQuads + 1);
+    WriteValue<int>(file, numberOfPoints);
+    for (int cc = 0; cc < numberOfPoints; ++cc)
+    {
+      WriteValue<float>(file, static_cast<float>(10 * step + cc / 2));
+    }
+    for (int cc = 0; cc < numberOfPoints; ++cc)
+    {
+      WriteValue<float>(file, static_cast<float>(cc % 2));
+    }
+    for (int cc = 0; cc < numberOfPoints; ++cc)
+    {
+      WriteValue<float>(file, 0.f);
+    }
+    WriteLine(file, "quad4");
+    WriteValue<int>(file, numberOfQuads);
+    for (int cc = 0; cc < numberOfQuads; ++cc)
+    {
+      WriteValue<int>(file, 2 * cc + 1);
+      WriteValue<int>(file, 2 * cc + 3);
+      WriteValue<int>(file, 2 * cc + 4);
+      WriteValue<int>(file, 2 * cc + 2);
+    }
+    WriteLine(file, "END TIME STEP");
+  }
+}
+
+void WriteCase(const std::string& fileName, const std::string& geometryName)
+{
+  vtksys::ofstream file(fileName.c_str(), ios::out);
+  file << "FORMAT\n"
+       << "type: ensight gold\n"
+       << "\n"
+       << "GEOMETRY\n"
+       << "model: 1 1 " << geometryName << "\n"
+       << "\n"
+       << "TIME\n"
+       << "time set: 1\n"
+       << "number of steps: " << NumberOfTimeSteps << "\n"
+       << "time values: 0 1 2\n"
+       << "\n"
+       << "FILE\n"
+       << "file set: 1\n"
+       << "number of steps: " << NumberOfTimeSteps << "\n";
+}
+
+// Reads the lines of the index and the offsets it lists.
+bool ReadIndex(const std::string& indexName, std::vector<std::string>& lines,
+  std::map<int, long>& offsets)
+{
+  lines.clear();
+  offsets.clear();
+  vtksys::ifstream index(indexName.c_str(), ios::in);
+  std::string line;
+  while (std::getline(index, line))
+  {
+    lines.push_back(line);
+  }
+  // header, file name, file information, then one line per offset.
+  for (size_t cc = 3; cc < lines.size(); ++cc)
+  {
+    std::istringstream offsetLine(lines[cc]);
+    int timeStep;
+    long offset;
+    if (!(offsetLine >> timeStep >> offset))
+    {
+      return false;
+    }
+    offsets[timeStep] = offset;
+  }
+  return lines.size() > 3;
+}
+
+// Reads the last time step and checks the strip it holds.
+bool ReadLastTimeStep(
+  const std::string& caseName, double expectedX, vtkIdType expectedPoints, const char* label)
+{
+  vtkNew<vtkPGenericEnSightReader> reader;
+  reader->SetCaseFileName(caseName.c_str());
+  reader->UseFileOffsetIndexOn();
+  reader->UpdateTimeStep(NumberOfTimeSteps - 1);
+  vtkUnstructuredGrid* ug = vtkUnstructuredGrid::SafeDownCast(reader->GetOutput()->GetBlock(0));
+  if (!ug || ug->GetNumberOfPoints() != expectedPoints || ug->GetPoint(0)[0] != expectedX)
+  {
+    std::cerr << label << ": expected " << expectedPoints << " points starting at x = "
+              << expectedX << ", got " << (ug ? ug->GetNumberOfPoints() : -1) << " points"
+              << (ug && ug->GetNumberOfPoints() > 0 ? " starting at x = " : "")
+              << (ug && ug->GetNumberOfPoints() > 0 ? ug->GetPoint(0)[0] : 0.) << "."
+              << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool CheckOffsets(const std::map<int, long>& offsets, int numberOfQuads, const char* label)
+{
+  // the offsets of the time steps skipped to reach the last one.
+  std::map<int, long> expected;
+  for (int step = 1; step < NumberOfTimeSteps; ++step)
+  {
+    expected[step] = 80 + step * TimeStepSize(numberOfQuads);
+  }
+  if (offsets != expected)
+  {
+    std::cerr << label << ": unexpected offsets in the index." << std::endl;
+    return false;
+  }
+  return true;
+}
+}
+
+int TestPEnSightFileOffsetIndex(int argc, char* argv[])
+{
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  const std::string caseName = std::string(tempDir) + "/TestPEnSightFileOffsetIndex.case";
+  const std::string geometryName = "TestPEnSightFileOffsetIndex.geo";
+  const std::string indexName = caseName + ".offsets";
+  const std::string fullGeometryName = std::string(tempDir) + "/" + geometryName;
+  delete[] tempDir;
+
+  vtksys::SystemTools::RemoveFile(indexName);
+  WriteCase(caseName, geometryName);
+  WriteGeometry(fullGeometryName, 1);
+
+  // the first read scans the file and saves the index.
+  std::vector<std::string> lines;
+  std::map<int, long> offsets;
+  if (!ReadLastTimeStep(caseName, 20, 4, "first read") ||
+    !ReadIndex(indexName, lines, offsets) || !CheckOffsets(offsets, 1, "first read"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // make the index point the last time step to the previous one: a reader
+  // using the index reads the previous time step.
+  {
+    vtksys::ofstream index(indexName.c_str(), ios::out);
+    for (size_t cc = 0; cc < lines.size(); ++cc)
+    {
+      std::istringstream offsetLine(lines[cc]);
+      int timeStep;
+      if (cc >= 3 && offsetLine >> timeStep && timeStep == 2)
+      {
+        index << "2 " << offsets[1] << "\n";
+      }
+      else
+      {
+        index << lines[cc] << "\n";
+      }
+    }
+  }
+  if (!ReadLastTimeStep(caseName, 10, 4, "reloaded index"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // rewriting the geometry file invalidates its offsets, the index is rebuilt.
+  WriteGeometry(fullGeometryName, 2);
+  if (!ReadLastTimeStep(caseName, 20, 6, "rewritten file") ||
+    !ReadIndex(indexName, lines, offsets) || !CheckOffsets(offsets, 2, "rewritten file"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  vtksys::SystemTools::RemoveFile(indexName);
+  return EXIT_SUCCESS;
+}
@@ -6,6 +6,7 @@
 #include "vtkFloatArray.h"
 #include "vtkIdList.h"
 #include "vtkImageData.h"
+#include "vtkInformation.h"
 #include "vtkMultiBlockDataSet.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
@@ -15,17 +16,224 @@
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
 
+#include "vtksys/Encoding.hxx"
 #include "vtksys/FStream.hxx"
 #include "vtksys/SystemTools.hxx"
 
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
 #include <ctype.h>
+#include <sstream>
+#include <streambuf>
 #include <string>
 
+#if defined(_WIN32)
+#include <windows.h> // CreateFileMapping, MapViewOfFile
+#else
+#include <fcntl.h>    // open
+#include <sys/mman.h> // mmap, munmap
+#include <unistd.h>   // close
+#endif
+
 vtkStandardNewMacro(vtkPEnSightGoldBinaryReader);
 
 // This is half the precision of an int.
 #define MAXIMUM_PART_ID 65536
 
+namespace
+{
+//----------------------------------------------------------------------------
+// Read-only memory mapping of a whole file, exposed as a stream buffer so that
+// the same parsing code is used whether the file is mapped or not. Reads are
+// plain copies from the mapping and seeks only move the get pointer.
+class vtkMappedFileBuffer : public std::streambuf
+{
+public:
+  ~vtkMappedFileBuffer() override { this->Close(); }
+
+  bool Open(const char* filename, size_t size)
+  {
+    this->Close();
+    if (size == 0)
+    {
+      return false;
+    }
+#if defined(_WIN32)
+    const std::wstring wfilename = vtksys::Encoding::ToWindowsExtendedPath(filename);
+    this->File = CreateFileW(wfilename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+      OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (this->File == INVALID_HANDLE_VALUE)
+    {
+      return false;
+    }
+    this->Mapping = CreateFileMappingW(this->File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    void* data =
+      this->Mapping ? MapViewOfFile(this->Mapping, FILE_MAP_READ, 0, 0, size) : nullptr;
+#else
+    const int fd = ::open(filename, O_RDONLY);
+    if (fd < 0)
+    {
+      return false;
+    }
+    void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // the mapping stays valid once the descriptor is closed.
+    ::close(fd);
+    if (data == MAP_FAILED)
+    {
+      data = nullptr;
+    }
+#endif
+    if (!data)
+    {
+      this->Close();
+      return false;
+    }
+    this->Size = size;
+    char* begin = static_cast<char*>(data);
+    this->setg(begin, begin, begin + size);
+    return true;
+  }
+
+  void Close()
+  {
+    char* begin = this->eback();
+    if (begin)
+    {
+#if defined(_WIN32)
+      UnmapViewOfFile(begin);
+#else
+      munmap(begin, this->Size);
+#endif
+    }
+#if defined(_WIN32)
+    if (this->Mapping)
+    {
+      CloseHandle(this->Mapping);
+      this->Mapping = nullptr;
+    }
+    if (this->File != INVALID_HANDLE_VALUE)
+    {
+      CloseHandle(this->File);
+      this->File = INVALID_HANDLE_VALUE;
+    }
+#endif
+    this->Size = 0;
+    this->setg(nullptr, nullptr, nullptr);
+  }
+
+  // Returns the `count` bytes following the next `offset` bytes, without
+  // moving the get pointer, or nullptr if the file is too short.
+  const char* Peek(size_t offset, size_t count) const
+  {
+    const size_t available = static_cast<size_t>(this->egptr() - this->gptr());
+    return (offset <= available && count <= available - offset) ? this->gptr() + offset
+                                                                : nullptr;
+  }
+
+protected:
+  std::streamsize xsgetn(char* s, std::streamsize count) override
+  {
+    std::streamsize n = this->egptr() - this->gptr();
+    n = count < n ? count : n;
+    if (n > 0)
+    {
+      memcpy(s, this->gptr(), static_cast<size_t>(n));
+      // gbump() only takes an int.
+      this->setg(this->eback(), this->gptr() + n, this->egptr());
+    }
+    return n;
+  }
+
+  std::streamsize showmanyc() override
+  {
+    const std::streamsize n = this->egptr() - this->gptr();
+    return n > 0 ? n : -1;
+  }
+
+  pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode) override
+  {
+    off_type base = 0;
+    if (dir == std::ios_base::cur)
+    {
+      base = this->gptr() - this->eback();
+    }
+    else if (dir == std::ios_base::end)
+    {
+      base = static_cast<off_type>(this->Size);
+    }
+    return this->seekpos(pos_type(base + off), std::ios_base::in);
+  }
+
+  pos_type seekpos(pos_type pos, std::ios_base::openmode) override
+  {
+    const off_type offset = off_type(pos);
+    if (!this->eback() || offset < 0 || offset > static_cast<off_type>(this->Size))
+    {
+      return pos_type(off_type(-1));
+    }
+    this->setg(this->eback(), this->eback() + offset, this->egptr());
+    return pos;
+  }
+
+private:
+  size_t Size = 0;
+#if defined(_WIN32)
+  HANDLE File = INVALID_HANDLE_VALUE;
+  HANDLE Mapping = nullptr;
+#endif
+};
+
+//----------------------------------------------------------------------------
+class vtkMappedFileStream : public std::istream
+{
+public:
+  vtkMappedFileStream()
+    : std::istream(nullptr)
+  {
+    this->rdbuf(&this->Buffer);
+  }
+
+  vtkMappedFileBuffer Buffer;
+};
+
+//----------------------------------------------------------------------------
+// Returns the mapping `file` reads from, if any.
+vtkMappedFileBuffer* GetMappedFileBuffer(istream* file)
+{
+  vtkMappedFileStream* mapped = dynamic_cast<vtkMappedFileStream*>(file);
+  return mapped ? &mapped->Buffer : nullptr;
+}
+
+//----------------------------------------------------------------------------
+std::string GetFullFileName(const char* filePath, const std::string& fileName)
+{
+  std::string sfilename;
+  if (filePath)
+  {
+    sfilename = filePath;
+    if (!sfilename.empty() && sfilename.back() != '/')
+    {
+      sfilename += "/";
+    }
+  }
+  return sfilename + fileName;
+}
+
+//----------------------------------------------------------------------------
+size_t GetNumberOfOffsets(const std::map<std::string, std::map<int, long> >& fileOffsets)
+{
+  size_t count = 0;
+  for (const auto& offsets : fileOffsets)
+  {
+    count += offsets.second.size();
+  }
+  return count;
+}
+
+const char* const FileOffsetIndexHeader = "EnSight Gold binary file offsets 1";
+}
+
 //----------------------------------------------------------------------------
 vtkPEnSightGoldBinaryReader::vtkPEnSightGoldBinaryReader()
 {
@@ -56,6 +264,150 @@ vtkPEnSightGoldBinaryReader::~vtkPEnSightGoldBinaryReader()
   free(this->FloatBuffer);
 }
 
+//----------------------------------------------------------------------------
+int vtkPEnSightGoldBinaryReader::RequestData(
+  vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  if (!this->UseFileOffsetIndex)
+  {
+    return this->Superclass::RequestData(request, inputVector, outputVector);
+  }
+
+  const std::string indexName = this->GetFileOffsetIndexName();
+  if (indexName != this->FileOffsetIndexName)
+  {
+    this->FileOffsetIndexName = indexName;
+    this->LoadFileOffsetIndex();
+  }
+
+  // only save the index when new time steps were found in the files.
+  const size_t numberOfOffsets = ::GetNumberOfOffsets(this->FileOffsets);
+  const int ret = this->Superclass::RequestData(request, inputVector, outputVector);
+  if (::GetNumberOfOffsets(this->FileOffsets) != numberOfOffsets)
+  {
+    this->SaveFileOffsetIndex();
+  }
+  return ret;
+}
+
+//----------------------------------------------------------------------------
+std::string vtkPEnSightGoldBinaryReader::GetFileOffsetIndexName()
+{
+  if (!this->CaseFileName)
+  {
+    return std::string();
+  }
+  return ::GetFullFileName(this->FilePath, this->CaseFileName) + ".offsets";
+}
+
+//----------------------------------------------------------------------------
+// The index lists, for each data file, its name, size, modification time and
+// the offsets of its time steps:
+//   <name>
+//   <size> <modification time> <number of offsets>
+//   <time step> <offset>
+//   ...
+void vtkPEnSightGoldBinaryReader::LoadFileOffsetIndex()
+{
+  this->FileOffsets.clear();
+
+  vtksys::ifstream index(this->FileOffsetIndexName.c_str(), ios::in);
+  std::string line;
+  if (!index || !std::getline(index, line) || line != ::FileOffsetIndexHeader)
+  {
+    return;
+  }
+
+  std::string fileName;
+  while (std::getline(index, fileName) && !fileName.empty())
+  {
+    unsigned long size;
+    long modifiedTime;
+    size_t count;
+    std::getline(index, line);
+    std::istringstream fileInfo(line);
+    if (!(fileInfo >> size >> modifiedTime >> count))
+    {
+      vtkWarningMacro("Ignoring corrupted file offset index " << this->FileOffsetIndexName);
+      this->FileOffsets.clear();
+      return;
+    }
+
+    // offsets of files modified since the index was saved are discarded.
+    const std::string fullName = ::GetFullFileName(this->FilePath, fileName);
+    const bool valid = vtksys::SystemTools::FileExists(fullName) &&
+      vtksys::SystemTools::FileLength(fullName) == size &&
+      vtksys::SystemTools::ModifiedTime(fullName) == modifiedTime;
+
+    std::map<int, long> offsets;
+    for (size_t cc = 0; cc < count; ++cc)
+    {
+      int timeStep;
+      long offset;
+      if (!(index >> timeStep >> offset))
+      {
+        vtkWarningMacro("Ignoring corrupted file offset index " << this->FileOffsetIndexName);
+        this->FileOffsets.clear();
+        return;
+      }
+      offsets[timeStep] = offset;
+    }
+    std::getline(index, line); // end of the last offset line
+    if (valid)
+    {
+      this->FileOffsets[fileName].swap(offsets);
+    }
+  }
+  vtkDebugMacro(<< "Loaded the offsets of " << this->FileOffsets.size() << " files from "
+                << this->FileOffsetIndexName);
+}
+
+//----------------------------------------------------------------------------
+void vtkPEnSightGoldBinaryReader::SaveFileOffsetIndex()
+{
+  // all ranks find the same offsets.
+  if (this->FileOffsetIndexName.empty() || this->GetMultiProcessLocalProcessId() > 0)
+  {
+    return;
+  }
+
+  // write to a temporary file first so that readers never see a partial index.
+  const std::string tmpName = this->FileOffsetIndexName + ".tmp";
+  {
+    vtksys::ofstream index(tmpName.c_str(), ios::out);
+    if (!index)
+    {
+      vtkDebugMacro(<< "Cannot write file offset index " << tmpName);
+      return;
+    }
+    index << ::FileOffsetIndexHeader << "\n";
+    for (const auto& offsets : this->FileOffsets)
+    {
+      const std::string fullName = ::GetFullFileName(this->FilePath, offsets.first);
+      index << offsets.first << "\n"
+            << vtksys::SystemTools::FileLength(fullName) << " "
+            << vtksys::SystemTools::ModifiedTime(fullName) << " " << offsets.second.size() << "\n";
+      for (const auto& offset : offsets.second)
+      {
+        index << offset.first << " " << offset.second << "\n";
+      }
+    }
+    if (!index)
+    {
+      index.close();
+      vtksys::SystemTools::RemoveFile(tmpName);
+      return;
+    }
+  }
+#if defined(_WIN32)
+  vtksys::SystemTools::RemoveFile(this->FileOffsetIndexName);
+#endif
+  if (std::rename(tmpName.c_str(), this->FileOffsetIndexName.c_str()) != 0)
+  {
+    vtksys::SystemTools::RemoveFile(tmpName);
+  }
+}
+
 //----------------------------------------------------------------------------
 int vtkPEnSightGoldBinaryReader::OpenFile(const char* filename)
 {
@@ -77,11 +429,27 @@ int vtkPEnSightGoldBinaryReader::OpenFile(const char* filename)
     // Find out how big the file is.
     this->FileSize = (long)(fs.st_size);
 
+    if (this->UseMemoryMappedIO)
+    {
+      vtkMappedFileStream* mapped = new vtkMappedFileStream;
+      if (mapped->Buffer.Open(filename, static_cast<size_t>(fs.st_size)))
+      {
+        this->IFile = mapped;
+      }
+      else
+      {
+        vtkDebugMacro(<< "Could not map " << filename << ", reading it as a stream.");
+        delete mapped;
+      }
+    }
+    if (!this->IFile)
+    {
 #ifdef _WIN32
-    this->IFile = new vtksys::ifstream(filename, ios::in | ios::binary);
+      this->IFile = new vtksys::ifstream(filename, ios::in | ios::binary);
 #else
-    this->IFile = new vtksys::ifstream(filename, ios::in);
+      this->IFile = new vtksys::ifstream(filename, ios::in);
 #endif
+    }
   }
   else
   {
@@ -1273,7 +1641,8 @@ int vtkPEnSightGoldBinaryReader::ReadScalarsPerNode(const char* fileName, const
   char line[80];
   int partId, realId, numPts, i, lineRead;
   vtkFloatArray* scalars;
-  float* scalarsRead;
+  const float* scalarsRead;
+  float* scalarsBuffer;
   vtkDataSet* output;
 
   // Initialize
@@ -1389,8 +1758,7 @@ int vtkPEnSightGoldBinaryReader::ReadScalarsPerNode(const char* fileName, const
       scalars = vtkFloatArray::New();
       scalars->SetNumberOfComponents(numberOfComponents);
       scalars->SetNumberOfTuples(this->GetPointIds(partId)->GetLocalNumberOfIds());
-      scalarsRead = new float[numPts];
-      this->ReadFloatArray(scalarsRead, numPts);
+      scalarsRead = this->MapFloatArray(numPts, scalarsBuffer);
       // Why are we setting only one component here?
       // Only one component is set because scalars are single-component arrays.
       // For complex scalars, there is a file for the real part and another
@@ -1408,7 +1776,7 @@ int vtkPEnSightGoldBinaryReader::ReadScalarsPerNode(const char* fileName, const
         output->GetPointData()->SetScalars(scalars);
       }
       scalars->Delete();
-      delete[] scalarsRead;
+      delete[] scalarsBuffer;
     }
 
     delete this->IFile;
@@ -1441,8 +1809,7 @@ int vtkPEnSightGoldBinaryReader::ReadScalarsPerNode(const char* fileName, const
         scalars = (vtkFloatArray*)(output->GetPointData()->GetArray(description));
       }
 
-      scalarsRead = new float[numPts];
-      this->ReadFloatArray(scalarsRead, numPts);
+      scalarsRead = this->MapFloatArray(numPts, scalarsBuffer);
 
       for (i = 0; i < numPts; i++)
       {
@@ -1463,7 +1830,7 @@ int vtkPEnSightGoldBinaryReader::ReadScalarsPerNode(const char* fileName, const
       {
         output->GetPointData()->AddArray(scalars);
       }
-      delete[] scalarsRead;
+      delete[] scalarsBuffer;
     }
 
     this->IFile->peek();
@@ -1489,7 +1856,8 @@ int vtkPEnSightGoldBinaryReader::ReadVectorsPerNode(const char* fileName, const
   int partId, realId, numPts, i, lineRead;
   vtkFloatArray* vectors;
   float tuple[3];
-  float *comp1, *comp2, *comp3;
+  const float *comp1, *comp2, *comp3;
+  float *buffer1, *buffer2, *buffer3;
   float* vectorsRead;
   vtkDataSet* output;
 
@@ -1647,12 +2015,9 @@ int vtkPEnSightGoldBinaryReader::ReadVectorsPerNode(const char* fileName, const
       this->ReadLine(line); // "coordinates" or "block"
       vectors->SetNumberOfComponents(3);
       vectors->SetNumberOfTuples(this->GetPointIds(realId)->GetLocalNumberOfIds());
-      comp1 = new float[numPts];
-      comp2 = new float[numPts];
-      comp3 = new float[numPts];
-      this->ReadFloatArray(comp1, numPts);
-      this->ReadFloatArray(comp2, numPts);
-      this->ReadFloatArray(comp3, numPts);
+      comp1 = this->MapFloatArray(numPts, buffer1);
+      comp2 = this->MapFloatArray(numPts, buffer2);
+      comp3 = this->MapFloatArray(numPts, buffer3);
       for (i = 0; i < numPts; i++)
       {
         tuple[0] = comp1[i];
@@ -1667,9 +2032,9 @@ int vtkPEnSightGoldBinaryReader::ReadVectorsPerNode(const char* fileName, const
         output->GetPointData()->SetVectors(vectors);
       }
       vectors->Delete();
-      delete[] comp1;
-      delete[] comp2;
-      delete[] comp3;
+      delete[] buffer1;
+      delete[] buffer2;
+      delete[] buffer3;
     }
 
     this->IFile->peek();
@@ -1694,7 +2059,8 @@ int vtkPEnSightGoldBinaryReader::ReadTensorsPerNode(const char* fileName, const
   char line[80];
   int partId, realId, numPts, i, lineRead;
   vtkFloatArray* tensors;
-  float *comp1, *comp2, *comp3, *comp4, *comp5, *comp6;
+  const float *comp1, *comp2, *comp3, *comp4, *comp5, *comp6;
+  float *buffer1, *buffer2, *buffer3, *buffer4, *buffer5, *buffer6;
   float tuple[6];
   vtkDataSet* output;
 
@@ -1798,18 +2164,12 @@ int vtkPEnSightGoldBinaryReader::ReadTensorsPerNode(const char* fileName, const
       this->ReadLine(line); // "coordinates" or "block"
       tensors->SetNumberOfComponents(6);
       tensors->SetNumberOfTuples(this->GetPointIds(realId)->GetLocalNumberOfIds());
-      comp1 = new float[numPts];
-      comp2 = new float[numPts];
-      comp3 = new float[numPts];
-      comp4 = new float[numPts];
-      comp5 = new float[numPts];
-      comp6 = new float[numPts];
-      this->ReadFloatArray(comp1, numPts);
-      this->ReadFloatArray(comp2, numPts);
-      this->ReadFloatArray(comp3, numPts);
-      this->ReadFloatArray(comp4, numPts);
-      this->ReadFloatArray(comp6, numPts);
-      this->ReadFloatArray(comp5, numPts);
+      comp1 = this->MapFloatArray(numPts, buffer1);
+      comp2 = this->MapFloatArray(numPts, buffer2);
+      comp3 = this->MapFloatArray(numPts, buffer3);
+      comp4 = this->MapFloatArray(numPts, buffer4);
+      comp6 = this->MapFloatArray(numPts, buffer6);
+      comp5 = this->MapFloatArray(numPts, buffer5);
       for (i = 0; i < numPts; i++)
       {
         tuple[0] = comp1[i];
@@ -1823,12 +2183,12 @@ int vtkPEnSightGoldBinaryReader::ReadTensorsPerNode(const char* fileName, const
       tensors->SetName(description);
       output->GetPointData()->AddArray(tensors);
       tensors->Delete();
-      delete[] comp1;
-      delete[] comp2;
-      delete[] comp3;
-      delete[] comp4;
-      delete[] comp5;
-      delete[] comp6;
+      delete[] buffer1;
+      delete[] buffer2;
+      delete[] buffer3;
+      delete[] buffer4;
+      delete[] buffer5;
+      delete[] buffer6;
     }
 
     this->IFile->peek();
@@ -2002,8 +2362,7 @@ int vtkPEnSightGoldBinaryReader::ReadScalarsPerElement(const char* fileName,
       // type (and what their ids are) -- IF THIS IS NOT A BLOCK SECTION
       if (strncmp(line, "block", 5) == 0)
       {
-        scalarsRead = new float[numCells];
-        this->ReadFloatArray(scalarsRead, numCells);
+        scalarsRead = this->MapFloatArray(numCells, scalarsBuffer);
         for (i = 0; i < numCells; i++)
         {
           this->InsertVariableComponent(
@@ -2017,7 +2376,7 @@ int vtkPEnSightGoldBinaryReader::ReadScalarsPerElement(const char* fileName,
         {
           lineRead = this->ReadLine(line);
         }
-        delete[] scalarsRead;
+        delete[] scalarsBuffer;
       }
       else
       {
@@ -2038,8 +2397,7 @@ int vtkPEnSightGoldBinaryReader::ReadScalarsPerElement(const char* fileName,
           }
           idx = this->UnstructuredPartIds->IsId(realId);
           numCellsPerElement = this->GetCellIds(idx, elementType)->GetNumberOfIds();
-          scalarsRead = new float[numCellsPerElement];
-          this->ReadFloatArray(scalarsRead, numCellsPerElement);
+          scalarsRead = this->MapFloatArray(numCellsPerElement, scalarsBuffer);
           for (i = 0; i < numCellsPerElement; i++)
           {
             this->InsertVariableComponent(
@@ -2054,7 +2412,7 @@ int vtkPEnSightGoldBinaryReader::ReadScalarsPerElement(const char* fileName,
           {
             lineRead = this->ReadLine(line);
           }
-          delete[] scalarsRead;
+          delete[] scalarsBuffer;
         } // end while
       }   // end else
       if (component == 0)
@@ -2241,12 +2599,9 @@ int vtkPEnSightGoldBinaryReader::ReadVectorsPerElement(const char* fileName,
       // type (and what their ids are) -- IF THIS IS NOT A BLOCK SECTION
       if (strncmp(line, "block", 5) == 0)
       {
-        comp1 = new float[numCells];
-        comp2 = new float[numCells];
-        comp3 = new float[numCells];
-        this->ReadFloatArray(comp1, numCells);
-        this->ReadFloatArray(comp2, numCells);
-        this->ReadFloatArray(comp3, numCells);
+        comp1 = this->MapFloatArray(numCells, buffer1);
+        comp2 = this->MapFloatArray(numCells, buffer2);
+        comp3 = this->MapFloatArray(numCells, buffer3);
         for (i = 0; i < numCells; i++)
         {
           tuple[0] = comp1[i];
@@ -2263,9 +2618,9 @@ int vtkPEnSightGoldBinaryReader::ReadVectorsPerElement(const char* fileName,
         {
           lineRead = this->ReadLine(line);
         }
-        delete[] comp1;
-        delete[] comp2;
-        delete[] comp3;
+        delete[] buffer1;
+        delete[] buffer2;
+        delete[] buffer3;
       }
       else
       {
@@ -2282,12 +2637,9 @@ int vtkPEnSightGoldBinaryReader::ReadVectorsPerElement(const char* fileName,
           }
           idx = this->UnstructuredPartIds->IsId(realId);
           numCellsPerElement = this->GetCellIds(idx, elementType)->GetNumberOfIds();
-          comp1 = new float[numCellsPerElement];
-          comp2 = new float[numCellsPerElement];
-          comp3 = new float[numCellsPerElement];
-          this->ReadFloatArray(comp1, numCellsPerElement);
-          this->ReadFloatArray(comp2, numCellsPerElement);
-          this->ReadFloatArray(comp3, numCellsPerElement);
+          comp1 = this->MapFloatArray(numCellsPerElement, buffer1);
+          comp2 = this->MapFloatArray(numCellsPerElement, buffer2);
+          comp3 = this->MapFloatArray(numCellsPerElement, buffer3);
           for (i = 0; i < numCellsPerElement; i++)
           {
             tuple[0] = comp1[i];
@@ -2305,9 +2657,9 @@ int vtkPEnSightGoldBinaryReader::ReadVectorsPerElement(const char* fileName,
           {
             lineRead = this->ReadLine(line);
           }
-          delete[] comp1;
-          delete[] comp2;
-          delete[] comp3;
+          delete[] buffer1;
+          delete[] buffer2;
+          delete[] buffer3;
         } // end while
       }   // end else
       vectors->SetName(description);
@@ -2488,18 +2840,12 @@ int vtkPEnSightGoldBinaryReader::ReadTensorsPerElement(const char* fileName,
       // type (and what their ids are) -- IF THIS IS NOT A BLOCK SECTION
       if (strncmp(line, "block", 5) == 0)
       {
-        comp1 = new float[numCells];
-        comp2 = new float[numCells];
-        comp3 = new float[numCells];
-        comp4 = new float[numCells];
-        comp5 = new float[numCells];
-        comp6 = new float[numCells];
-        this->ReadFloatArray(comp1, numCells);
-        this->ReadFloatArray(comp2, numCells);
-        this->ReadFloatArray(comp3, numCells);
-        this->ReadFloatArray(comp4, numCells);
-        this->ReadFloatArray(comp6, numCells);
-        this->ReadFloatArray(comp5, numCells);
+        comp1 = this->MapFloatArray(numCells, buffer1);
+        comp2 = this->MapFloatArray(numCells, buffer2);
+        comp3 = this->MapFloatArray(numCells, buffer3);
+        comp4 = this->MapFloatArray(numCells, buffer4);
+        comp6 = this->MapFloatArray(numCells, buffer6);
+        comp5 = this->MapFloatArray(numCells, buffer5);
         for (i = 0; i < numCells; i++)
         {
           tuple[0] = comp1[i];
@@ -2519,12 +2865,12 @@ int vtkPEnSightGoldBinaryReader::ReadTensorsPerElement(const char* fileName,
         {
           lineRead = this->ReadLine(line);
         }
-        delete[] comp1;
-        delete[] comp2;
-        delete[] comp3;
-        delete[] comp4;
-        delete[] comp5;
-        delete[] comp6;
+        delete[] buffer1;
+        delete[] buffer2;
+        delete[] buffer3;
+        delete[] buffer4;
+        delete[] buffer5;
+        delete[] buffer6;
       }
       else
       {
@@ -2541,18 +2887,12 @@ int vtkPEnSightGoldBinaryReader::ReadTensorsPerElement(const char* fileName,
           }
           idx = this->UnstructuredPartIds->IsId(realId);
           numCellsPerElement = this->GetCellIds(idx, elementType)->GetNumberOfIds();
-          comp1 = new float[numCellsPerElement];
-          comp2 = new float[numCellsPerElement];
-          comp3 = new float[numCellsPerElement];
-          comp4 = new float[numCellsPerElement];
-          comp5 = new float[numCellsPerElement];
-          comp6 = new float[numCellsPerElement];
-          this->ReadFloatArray(comp1, numCellsPerElement);
-          this->ReadFloatArray(comp2, numCellsPerElement);
-          this->ReadFloatArray(comp3, numCellsPerElement);
-          this->ReadFloatArray(comp4, numCellsPerElement);
-          this->ReadFloatArray(comp6, numCellsPerElement);
-          this->ReadFloatArray(comp5, numCellsPerElement);
+          comp1 = this->MapFloatArray(numCellsPerElement, buffer1);
+          comp2 = this->MapFloatArray(numCellsPerElement, buffer2);
+          comp3 = this->MapFloatArray(numCellsPerElement, buffer3);
+          comp4 = this->MapFloatArray(numCellsPerElement, buffer4);
+          comp6 = this->MapFloatArray(numCellsPerElement, buffer6);
+          comp5 = this->MapFloatArray(numCellsPerElement, buffer5);
           for (i = 0; i < numCellsPerElement; i++)
           {
             tuple[0] = comp1[i];
@@ -2573,12 +2913,12 @@ int vtkPEnSightGoldBinaryReader::ReadTensorsPerElement(const char* fileName,
           {
             lineRead = this->ReadLine(line);
           }
-          delete[] comp1;
-          delete[] comp2;
-          delete[] comp3;
-          delete[] comp4;
-          delete[] comp5;
-          delete[] comp6;
+          delete[] buffer1;
+          delete[] buffer2;
+          delete[] buffer3;
+          delete[] buffer4;
+          delete[] buffer5;
+          delete[] buffer6;
         } // end while
       }   // end else
       tensors->SetName(description);
@@ -4295,6 +4635,34 @@ int vtkPEnSightGoldBinaryReader::ReadFloatArray(float* result, int numFloats)
   return 1;
 }
 
+// Internal function to get a float array, from the mapped file if possible.
+const float* vtkPEnSightGoldBinaryReader::MapFloatArray(int numFloats, float*& buffer)
+{
+  buffer = nullptr;
+#ifdef VTK_WORDS_BIGENDIAN
+  const bool nativeByteOrder = this->ByteOrder != FILE_LITTLE_ENDIAN;
+#else
+  const bool nativeByteOrder = this->ByteOrder == FILE_LITTLE_ENDIAN;
+#endif
+  vtkMappedFileBuffer* mapped = ::GetMappedFileBuffer(this->IFile);
+  if (mapped && nativeByteOrder && numFloats > 0)
+  {
+    // skip the fortran record marker, if any.
+    const size_t marker = this->Fortran ? 4 : 0;
+    const size_t numBytes = sizeof(float) * static_cast<size_t>(numFloats);
+    const char* data = mapped->Peek(marker, numBytes + marker);
+    if (data && reinterpret_cast<std::uintptr_t>(data) % alignof(float) == 0 &&
+      this->IFile->seekg(static_cast<std::streamoff>(numBytes + 2 * marker), ios::cur))
+    {
+      return reinterpret_cast<const float*>(data);
+    }
+  }
+
+  buffer = new float[numFloats > 0 ? numFloats : 1];
+  this->ReadFloatArray(buffer, numFloats);
+  return buffer;
+}
+
 //----------------------------------------------------------------------------
 int vtkPEnSightGoldBinaryReader::ReadOrSkipCoordinates(
   vtkPoints* points, long offset, int partId, bool skip)
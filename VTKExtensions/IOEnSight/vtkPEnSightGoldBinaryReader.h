@@ -35,6 +35,8 @@
 #include "vtkPEnSightReader.h"
 #include "vtkPVVTKExtensionsIOEnSightModule.h" //needed for exports
 
+#include <string> // for std::string
+
 class vtkMultiBlockDataSet;
 class vtkUnstructuredGrid;
 class vtkPoints;
@@ -50,7 +52,10 @@ protected:
   vtkPEnSightGoldBinaryReader();
   ~vtkPEnSightGoldBinaryReader() override;
 
+  int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+
   // Returns 1 if successful.  Sets file size as a side action.
+  // The file is memory-mapped when UseMemoryMappedIO is set and possible.
   int OpenFile(const char* filename);
 
   // Returns 1 if successful.  Handles constructing the filename, opening the file and checking
@@ -170,6 +175,15 @@ protected:
    */
   int ReadFloatArray(float* result, int numFloats);
 
+  /**
+   * Internal function to get a float array from the file. When the file is
+   * memory-mapped and stored in the native byte order, the returned pointer
+   * refers to the mapped file directly and `buffer` is set to nullptr.
+   * Otherwise the values are read into a new `buffer`, which is returned.
+   * In both cases the caller must `delete[] buffer`.
+   */
+  const float* MapFloatArray(int numFloats, float*& buffer);
+
   /**
    * Read Coordinates, or just skip the part in the file.
    */
@@ -200,6 +214,19 @@ protected:
   int SkipImageData(char line[256]);
   //@}
 
+  //@{
+  /**
+   * Load or save the FileOffsets found while skipping time steps of
+   * single-file transient data, see UseFileOffsetIndex.
+   */
+  std::string GetFileOffsetIndexName();
+  void LoadFileOffsetIndex();
+  void SaveFileOffsetIndex();
+  //@}
+
+  // The index FileOffsets was loaded from, if any.
+  std::string FileOffsetIndexName;
+
   int NodeIdsListed;
   int ElementIdsListed;
   int Fortran;
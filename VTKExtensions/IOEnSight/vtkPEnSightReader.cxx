@@ -2262,7 +2262,7 @@ vtkIdType vtkPEnSightReader::GetLocalTotalNumberOfCellIds(int index)
 
 //----------------------------------------------------------------------------
 void vtkPEnSightReader::InsertVariableComponent(vtkFloatArray* array, int i, int component,
-  float* content, int partId, int ensightCellType, int insertionType)
+  const float* content, int partId, int ensightCellType, int insertionType)
 {
 
   vtkIdType realId;
@@ -784,7 +784,7 @@ protected:
   void InsertNextCellAndId(vtkUnstructuredGrid*, int vtkCellType, vtkIdType numPoints,
     vtkIdType* points, int partId, int ensightCellType, vtkIdType globalId, vtkIdType numElements,
     const std::vector<vtkIdType>& faces = {});
-  void InsertVariableComponent(vtkFloatArray* array, int i, int component, float* content,
+  void InsertVariableComponent(vtkFloatArray* array, int i, int component, const float* content,
     int partId, int ensightCellType, int insertionType);
   //@}
 
@@ -44,6 +44,8 @@ vtkPGenericEnSightReader::vtkPGenericEnSightReader()
   // -2 is the default starting value
   this->MultiProcessLocalProcessId = -2;
   this->MultiProcessNumberOfProcesses = -2;
+  this->UseMemoryMappedIO = false;
+  this->UseFileOffsetIndex = false;
 }
 
 //----------------------------------------------------------------------------
@@ -139,6 +141,8 @@ int vtkPGenericEnSightReader::RequestInformation(
   if (reader)
   {
     // this dynamic cast never should fail
+    reader->SetUseMemoryMappedIO(this->UseMemoryMappedIO);
+    reader->SetUseFileOffsetIndex(this->UseFileOffsetIndex);
     reader->RequestInformation(request, inputVector, outputVector);
   }
   this->Reader->SetParticleCoordinatesByIndex(this->ParticleCoordinatesByIndex);
@@ -203,4 +207,6 @@ void vtkPGenericEnSightReader::PrintSelf(ostream& os, vtkIndent indent)
   this->Superclass::PrintSelf(os, indent);
   os << indent << "MultiProcessLocalProcessId: " << this->MultiProcessLocalProcessId << endl;
   os << indent << "MultiProcessNumberOfProcesses: " << this->MultiProcessNumberOfProcesses << endl;
+  os << indent << "UseMemoryMappedIO: " << this->UseMemoryMappedIO << endl;
+  os << indent << "UseFileOffsetIndex: " << this->UseFileOffsetIndex << endl;
 }
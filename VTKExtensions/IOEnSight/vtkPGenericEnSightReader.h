@@ -38,6 +38,31 @@ public:
   vtkTypeMacro(vtkPGenericEnSightReader, vtkGenericEnSightReader);
   void PrintSelf(ostream& os, vtkIndent indent) override;
 
+  //@{
+  /**
+   * When set, EnSight Gold binary files are memory-mapped instead of being
+   * read through a file stream. Variable arrays are then converted straight
+   * from the mapped file, without an intermediate buffer. Files that cannot
+   * be mapped are read through a file stream. Default is off.
+   */
+  vtkSetMacro(UseMemoryMappedIO, bool);
+  vtkGetMacro(UseMemoryMappedIO, bool);
+  vtkBooleanMacro(UseMemoryMappedIO, bool);
+  //@}
+
+  //@{
+  /**
+   * When set, the offsets of the time steps found in EnSight Gold binary
+   * single-file transient data are saved in a `<case file>.offsets` index
+   * next to the case file, and reloaded when the case is opened again so
+   * that the files are not scanned again. Entries are discarded when the
+   * size or modification time of their data file changed. Default is off.
+   */
+  vtkSetMacro(UseFileOffsetIndex, bool);
+  vtkGetMacro(UseFileOffsetIndex, bool);
+  vtkBooleanMacro(UseFileOffsetIndex, bool);
+  //@}
+
 protected:
   vtkPGenericEnSightReader();
   ~vtkPGenericEnSightReader() override;
@@ -56,6 +81,9 @@ protected:
   int MultiProcessLocalProcessId;
   int MultiProcessNumberOfProcesses;
 
+  bool UseMemoryMappedIO;
+  bool UseFileOffsetIndex;
+
 private:
   vtkPGenericEnSightReader(const vtkPGenericEnSightReader&) = delete;
   void operator=(const vtkPGenericEnSightReader&) = delete;
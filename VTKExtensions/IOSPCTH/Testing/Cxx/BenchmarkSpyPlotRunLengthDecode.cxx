@@ -0,0 +1,267 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    BenchmarkSpyPlotRunLengthDecode.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Benchmark for the run-length decoding of SpyPlot cell fields. A synthetic
+// stream of planes, mixing repeated and literal runs like CTH fields, is
+// decoded with the previous scalar implementation, with
+// vtkSpyPlotUniReader::RunLengthDataDecode, and with the latter over all the
+// planes concurrently, as the reader does. The results must be identical and
+// the throughputs are reported in GB/s of decoded values.
+//
+// Usage: BenchmarkSpyPlotRunLengthDecode [--planes=N] [--plane-size=N]
+//                                        [--iterations=N]
+
+#include "vtkByteSwap.h"
+#include "vtkNew.h"
+#include "vtkSMPTools.h"
+#include "vtkSpyPlotUniReader.h"
+#include "vtkTimerLog.h"
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <type_traits>
+#include <vector>
+#include <vtksys/CommandLineArguments.hxx>
+
+namespace
+{
+// previous implementation, checking every value and swapping bytes with
+// vtkByteSwap.
+template <class t>
+int ScalarRunLengthDataDecode(
+  const unsigned char* in, int inSize, t* out, int outSize, t scale = 1)
+{
+  int outIndex = 0, inIndex = 0;
+  const unsigned char* ptmp = in;
+  while ((outIndex < outSize) && (inIndex < inSize))
+  {
+    unsigned char runLength = *ptmp;
+    ptmp++;
+    if (runLength < 128)
+    {
+      float val;
+      memcpy(&val, ptmp, sizeof(float));
+      vtkByteSwap::SwapBE(&val);
+      ptmp += 4;
+      for (int k = 0; k < runLength; ++k)
+      {
+        if (outIndex >= outSize)
+        {
+          return 0;
+        }
+        out[outIndex] = static_cast<t>(val * scale);
+        outIndex++;
+      }
+      inIndex += 5;
+    }
+    else
+    {
+      for (int k = 0; k < runLength - 128; ++k)
+      {
+        if (outIndex >= outSize)
+        {
+          return 0;
+        }
+        float val;
+        memcpy(&val, ptmp, sizeof(float));
+        vtkByteSwap::SwapBE(&val);
+        out[outIndex] = static_cast<t>(val * scale);
+        outIndex++;
+        ptmp += 4;
+      }
+      inIndex += 4 * (runLength - 128) + 1;
+    }
+  }
+  return 1;
+}
+
+void AppendFloat(std::vector<unsigned char>& stream, float val)
+{
+  vtkByteSwap::SwapBE(&val);
+  const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&val);
+  stream.insert(stream.end(), bytes, bytes + sizeof(float));
+}
+
+// Planes of values in [0, 1], half of them in repeated runs.
+struct Stream
+{
+  std::vector<unsigned char> Bytes;
+  std::vector<size_t> Offsets;
+  int PlaneSize;
+
+  Stream(int numPlanes, int planeSize)
+    : PlaneSize(planeSize)
+  {
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> lengths(1, 127);
+    std::uniform_real_distribution<float> values(0.0f, 1.0f);
+    for (int plane = 0; plane < numPlanes; ++plane)
+    {
+      this->Offsets.push_back(this->Bytes.size());
+      int remaining = planeSize;
+      while (remaining > 0)
+      {
+        const int count = std::min(remaining, lengths(generator));
+        if (generator() % 2)
+        {
+          this->Bytes.push_back(static_cast<unsigned char>(count));
+          AppendFloat(this->Bytes, values(generator));
+        }
+        else
+        {
+          this->Bytes.push_back(static_cast<unsigned char>(count + 128));
+          for (int k = 0; k < count; ++k)
+          {
+            AppendFloat(this->Bytes, values(generator));
+          }
+        }
+        remaining -= count;
+      }
+    }
+    this->Offsets.push_back(this->Bytes.size());
+  }
+
+  int GetNumberOfPlanes() const { return static_cast<int>(this->Offsets.size()) - 1; }
+  const unsigned char* GetPlane(int plane) const
+  {
+    return this->Bytes.data() + this->Offsets[plane];
+  }
+  int GetPlaneBytes(int plane) const
+  {
+    return static_cast<int>(this->Offsets[plane + 1] - this->Offsets[plane]);
+  }
+};
+
+enum Mode
+{
+  SCALAR,
+  SERIAL,
+  CONCURRENT
+};
+
+template <class t>
+bool Decode(const Stream& stream, std::vector<t>& out, Mode mode)
+{
+  const int planeSize = stream.PlaneSize;
+  const t scale = std::is_same<t, unsigned char>::value ? 255 : 1;
+  auto decodePlane = [&](int plane) {
+    t* ptr = out.data() + static_cast<size_t>(plane) * planeSize;
+    return mode == SCALAR
+      ? ScalarRunLengthDataDecode(
+          stream.GetPlane(plane), stream.GetPlaneBytes(plane), ptr, planeSize, scale)
+      : vtkSpyPlotUniReader::RunLengthDataDecode(
+          stream.GetPlane(plane), stream.GetPlaneBytes(plane), ptr, planeSize);
+  };
+
+  bool valid = true;
+  if (mode == CONCURRENT)
+  {
+    std::vector<int> status(stream.GetNumberOfPlanes());
+    vtkSMPTools::For(0, stream.GetNumberOfPlanes(), [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType plane = begin; plane < end; ++plane)
+      {
+        status[plane] = decodePlane(static_cast<int>(plane));
+      }
+    });
+    valid = std::find(status.begin(), status.end(), 0) == status.end();
+  }
+  else
+  {
+    for (int plane = 0; plane < stream.GetNumberOfPlanes(); ++plane)
+    {
+      valid = decodePlane(plane) && valid;
+    }
+  }
+  return valid;
+}
+
+template <class t>
+bool Benchmark(const Stream& stream, int iterations, const char* type)
+{
+  const size_t numValues = static_cast<size_t>(stream.GetNumberOfPlanes()) * stream.PlaneSize;
+  std::vector<t> expected(numValues);
+  const char* names[] = { "scalar", "vectorized", "vectorized, concurrent planes" };
+  for (Mode mode : { SCALAR, SERIAL, CONCURRENT })
+  {
+    std::vector<t> out(numValues);
+    vtkNew<vtkTimerLog> timer;
+    timer->StartTimer();
+    for (int cc = 0; cc < iterations; ++cc)
+    {
+      if (!Decode(stream, out, mode))
+      {
+        cerr << "ERROR: " << names[mode] << " " << type << " decoding failed." << endl;
+        return false;
+      }
+    }
+    timer->StopTimer();
+    if (mode == SCALAR)
+    {
+      expected.swap(out);
+    }
+    else if (out != expected)
+    {
+      cerr << "ERROR: " << names[mode] << " " << type << " values differ from scalar ones."
+           << endl;
+      return false;
+    }
+    const double gb = static_cast<double>(iterations * numValues * sizeof(t)) / 1.0e9;
+    const double time = timer->GetElapsedTime();
+    cout << type << " " << names[mode] << ": " << (time > 0 ? gb / time : 0.0) << " GB/s" << endl;
+  }
+  return true;
+}
+}
+
+int BenchmarkSpyPlotRunLengthDecode(int argc, char* argv[])
+{
+  int numPlanes = 256;
+  int planeSize = 128 * 128;
+  int iterations = 1;
+
+  vtksys::CommandLineArguments arg;
+  arg.Initialize(argc, argv);
+  typedef vtksys::CommandLineArguments argT;
+  arg.AddArgument("--planes", argT::EQUAL_ARGUMENT, &numPlanes, "Number of planes.");
+  arg.AddArgument("--plane-size", argT::EQUAL_ARGUMENT, &planeSize, "Values per plane.");
+  arg.AddArgument("--iterations", argT::EQUAL_ARGUMENT, &iterations, "Number of iterations.");
+  arg.StoreUnusedArguments(true);
+  if (!arg.Parse())
+  {
+    cerr << "Problem parsing arguments" << endl;
+    return EXIT_FAILURE;
+  }
+
+  Stream stream(numPlanes, planeSize);
+  cout << "stream: " << numPlanes << " planes of " << planeSize << " values, "
+       << stream.Bytes.size() << " bytes" << endl;
+  if (!Benchmark<float>(stream, iterations, "float") ||
+    !Benchmark<unsigned char>(stream, iterations, "unsigned char"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // runs overflowing the output or the input are errors.
+  std::vector<float> out(stream.PlaneSize);
+  if (vtkSpyPlotUniReader::RunLengthDataDecode(
+        stream.GetPlane(0), stream.GetPlaneBytes(0), out.data(), stream.PlaneSize - 1) ||
+    vtkSpyPlotUniReader::RunLengthDataDecode(
+      stream.GetPlane(0), stream.GetPlaneBytes(0) - 1, out.data(), stream.PlaneSize))
+  {
+    cerr << "ERROR: invalid runs should not be decoded." << endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
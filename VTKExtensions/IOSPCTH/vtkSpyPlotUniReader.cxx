@@ -1,10 +1,10 @@
 #include "vtkSpyPlotUniReader.h"
-#include "vtkByteSwap.h"
 #include "vtkDataArray.h"
 #include "vtkDataArraySelection.h"
 #include "vtkFloatArray.h"
 #include "vtkIntArray.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
 #include "vtkSpyPlotBlock.h"
 #include "vtkSpyPlotIStream.h"
 #include "vtkUnsignedCharArray.h"
@@ -12,6 +12,9 @@
 #include "vtksys/FStream.hxx"
 #include "vtksys/RegularExpression.hxx"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <sstream>
 #include <vector>
 
@@ -41,6 +44,80 @@ inline ostream& operator<<(ostream& os, const vtkSpyPlotWriteString& c)
   return os;
 }
 
+//-----------------------------------------------------------------------------
+// Run-length encoded planes of cell fields are read from the file in order,
+// then decoded concurrently: the planes of all the blocks of the variables
+// read since the last call to Decode().
+class vtkSpyPlotUniReaderPlaneDecoder
+{
+public:
+  // Returns the buffer to read the `numBytes` bytes of a plane decoded to
+  // `out`. The buffer is valid until the next call.
+  template <class t>
+  unsigned char* AddPlane(int numBytes, t* out, int outSize)
+  {
+    Plane plane;
+    plane.Offset = this->Buffer.size();
+    plane.NumberOfBytes = numBytes;
+    plane.FloatOut = nullptr;
+    plane.UnsignedCharOut = nullptr;
+    plane.OutSize = outSize;
+    plane.SetOutput(out);
+    this->Planes.push_back(plane);
+    this->Buffer.resize(plane.Offset + numBytes);
+    return this->Buffer.data() + plane.Offset;
+  }
+
+  size_t GetBufferSize() const { return this->Buffer.size(); }
+
+  // Decodes the planes added since the last call, returns false if any of
+  // them is invalid.
+  bool Decode()
+  {
+    std::atomic<bool> valid(true);
+    const vtkIdType numPlanes = static_cast<vtkIdType>(this->Planes.size());
+    vtkSMPTools::For(0, numPlanes, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType cc = begin; cc < end; ++cc)
+      {
+        const Plane& plane = this->Planes[cc];
+        const unsigned char* in = this->Buffer.data() + plane.Offset;
+        const int status = plane.FloatOut
+          ? vtkSpyPlotUniReader::RunLengthDataDecode(
+              in, plane.NumberOfBytes, plane.FloatOut, plane.OutSize)
+          : vtkSpyPlotUniReader::RunLengthDataDecode(
+              in, plane.NumberOfBytes, plane.UnsignedCharOut, plane.OutSize);
+        if (!status)
+        {
+          valid = false;
+        }
+      }
+    });
+    this->Planes.clear();
+    this->Buffer.clear();
+    return valid;
+  }
+
+private:
+  struct Plane
+  {
+    size_t Offset;
+    int NumberOfBytes;
+    float* FloatOut;
+    unsigned char* UnsignedCharOut;
+    int OutSize;
+
+    void SetOutput(float* out) { this->FloatOut = out; }
+    void SetOutput(unsigned char* out) { this->UnsignedCharOut = out; }
+  };
+
+  std::vector<Plane> Planes;
+  std::vector<unsigned char> Buffer;
+};
+
+// Size of the encoded planes above which they are decoded before reading the
+// next variable.
+static const size_t vtkSpyPlotUniReaderMaximumPlaneBufferSize = 256 * 1024 * 1024;
+
 //-----------------------------------------------------------------------------
 vtkSpyPlotUniReader::vtkSpyPlotUniReader()
 {
@@ -328,6 +405,32 @@ int vtkSpyPlotUniReader::MakeCurrent()
   dump = this->CurrentTimeStep;
   dp = this->DataDumps + dump;
 
+  vtkSpyPlotUniReaderPlaneDecoder planeDecoder;
+  // The arrays of the variables read since the last successful Decode() are
+  // in DataBlocks but not decoded yet. On error, they are released so that
+  // they are read again by the next call.
+  std::vector<vtkSpyPlotUniReader::Variable*> pendingVariables;
+  auto releasePending = [&pendingVariables, dp]() {
+    for (vtkSpyPlotUniReader::Variable* pending : pendingVariables)
+    {
+      if (pending->DataBlocks)
+      {
+        for (int dataBlock = 0; dataBlock < dp->ActualNumberOfBlocks; ++dataBlock)
+        {
+          if (pending->DataBlocks[dataBlock])
+          {
+            pending->DataBlocks[dataBlock]->Delete();
+          }
+        }
+        delete[] pending->DataBlocks;
+        pending->DataBlocks = 0;
+        delete[] pending->GhostCellsFixed;
+        pending->GhostCellsFixed = 0;
+      }
+    }
+    pendingVariables.clear();
+  };
+
   for (int fieldCnt = 0; fieldCnt < dp->NumVars; ++fieldCnt)
   {
     vtkSpyPlotUniReader::Variable* var = dp->Variables + fieldCnt;
@@ -385,6 +488,7 @@ int vtkSpyPlotUniReader::MakeCurrent()
                     << this->FileName);
       continue;
     }
+    pendingVariables.push_back(var);
 
     // vtkDebugMacro( "  Field: " << fieldCnt << " / " << dp->NumVars
     // << " [" << var->Name << "]" );
@@ -426,37 +530,44 @@ int vtkSpyPlotUniReader::MakeCurrent()
         for (zax = 0; zax < bdims[2]; ++zax)
         {
           int planeSize = bdims[0] * bdims[1];
-          if (!spis.ReadInt32s(&numBytes, 1))
+          if (!spis.ReadInt32s(&numBytes, 1) || numBytes < 0)
           {
             vtkErrorMacro("Problem reading the number of bytes");
+            if (dataArray)
+            {
+              dataArray->Delete();
+            }
+            releasePending();
             return 0;
           }
-          if (static_cast<int>(arrayBuffer.size()) < numBytes)
+          unsigned char* buffer;
+          if (floatArray)
           {
-            arrayBuffer.resize(numBytes);
+            buffer = planeDecoder.AddPlane(
+              numBytes, floatArray->GetPointer(zax * planeSize), planeSize);
           }
-          if (!spis.ReadString(&*arrayBuffer.begin(), numBytes))
+          else if (unsignedCharArray)
           {
-            vtkErrorMacro("Problem reading the bytes");
-            return 0;
+            buffer = planeDecoder.AddPlane(
+              numBytes, unsignedCharArray->GetPointer(zax * planeSize), planeSize);
           }
-          if (floatArray)
+          else
           {
-            float* ptr = floatArray->GetPointer(zax * planeSize);
-            if (!this->RunLengthDataDecode(&*arrayBuffer.begin(), numBytes, ptr, planeSize))
+            if (static_cast<int>(arrayBuffer.size()) < numBytes)
             {
-              vtkErrorMacro("Problem RLD decoding float data array");
-              return 0;
+              arrayBuffer.resize(numBytes);
             }
+            buffer = arrayBuffer.data();
           }
-          if (unsignedCharArray)
+          if (!spis.ReadString(buffer, numBytes))
           {
-            unsigned char* ptr = unsignedCharArray->GetPointer(zax * planeSize);
-            if (!this->RunLengthDataDecode(&*arrayBuffer.begin(), numBytes, ptr, planeSize))
+            vtkErrorMacro("Problem reading the bytes");
+            if (dataArray)
             {
-              vtkErrorMacro("Problem RLD decoding unsigned char data array");
-              return 0;
+              dataArray->Delete();
             }
+            releasePending();
+            return 0;
           }
         }
         if (dataArray)
@@ -468,7 +579,26 @@ int vtkSpyPlotUniReader::MakeCurrent()
         }
       }
     }
+
+    if (planeDecoder.GetBufferSize() > vtkSpyPlotUniReaderMaximumPlaneBufferSize)
+    {
+      if (!planeDecoder.Decode())
+      {
+        vtkErrorMacro("Problem RLD decoding data arrays");
+        releasePending();
+        return 0;
+      }
+      pendingVariables.clear();
+    }
+  }
+
+  if (!planeDecoder.Decode())
+  {
+    vtkErrorMacro("Problem RLD decoding data arrays");
+    releasePending();
+    return 0;
   }
+  pendingVariables.clear();
 
   if (blocksUpdated && needMarkers)
   {
@@ -665,61 +795,56 @@ void vtkSpyPlotUniReader::PrintInformation()
    n bytes long. */
 
 //-----------------------------------------------------------------------------
+// Reads a big endian float. Compilers turn this into a load and a byte swap,
+// which are vectorized in the loops below.
+inline float vtkSpyPlotUniReaderReadFloat(const unsigned char* ptr)
+{
+  const uint32_t bits = (static_cast<uint32_t>(ptr[0]) << 24) |
+    (static_cast<uint32_t>(ptr[1]) << 16) | (static_cast<uint32_t>(ptr[2]) << 8) |
+    static_cast<uint32_t>(ptr[3]);
+  float val;
+  memcpy(&val, &bits, sizeof(float));
+  return val;
+}
+
+//-----------------------------------------------------------------------------
+// A run starts with a byte n. When n < 128, the next float is repeated n
+// times, otherwise the next n - 128 floats are copied. Whole runs are checked
+// against the sizes of the input and output, so that the inner loops are
+// plain fills and conversions.
 template <class t>
 int vtkSpyPlotUniReaderRunLengthDataDecode(
-  vtkSpyPlotUniReader* self, const unsigned char* in, int inSize, t* out, int outSize, t scale = 1)
+  const unsigned char* in, int inSize, t* out, int outSize, t scale = 1)
 {
   int outIndex = 0, inIndex = 0;
 
-  const unsigned char* ptmp = in;
-
   /* Run-length decode */
   while ((outIndex < outSize) && (inIndex < inSize))
   {
     // Okay get the run length
-    unsigned char runLength = *ptmp;
-    ptmp++;
+    const int runLength = in[inIndex];
+    const int count = runLength < 128 ? runLength : runLength - 128;
+    const int runBytes = runLength < 128 ? 4 : 4 * count;
+    if (count > outSize - outIndex || runBytes > inSize - inIndex - 1)
+    {
+      return 0;
+    }
+
+    const unsigned char* ptmp = in + inIndex + 1;
+    t* ptr = out + outIndex;
     if (runLength < 128)
     {
-      float val;
-      memcpy(&val, ptmp, sizeof(float));
-      vtkByteSwap::SwapBE(&val);
-      ptmp += 4;
-      // Now populate the out data
-      int k;
-      for (k = 0; k < runLength; ++k)
-      {
-        if (outIndex >= outSize)
-        {
-          vtkErrorWithObjectMacro(self, "Problem doing RLD decode. "
-              << "Too much data generated. Expected: " << outSize);
-          return 0;
-        }
-        out[outIndex] = static_cast<t>(val * scale);
-        outIndex++;
-      }
-      inIndex += 5;
+      std::fill_n(ptr, count, static_cast<t>(vtkSpyPlotUniReaderReadFloat(ptmp) * scale));
     }
-    else // runLength >= 128
+    else
     {
-      int k;
-      for (k = 0; k < runLength - 128; ++k)
+      for (int k = 0; k < count; ++k)
       {
-        if (outIndex >= outSize)
-        {
-          vtkErrorWithObjectMacro(self, "Problem doing RLD decode. "
-              << "Too much data generated. Expected: " << outSize);
-          return 0;
-        }
-        float val;
-        memcpy(&val, ptmp, sizeof(float));
-        vtkByteSwap::SwapBE(&val);
-        out[outIndex] = static_cast<t>(val * scale);
-        outIndex++;
-        ptmp += 4;
+        ptr[k] = static_cast<t>(vtkSpyPlotUniReaderReadFloat(ptmp + 4 * k) * scale);
       }
-      inIndex += 4 * (runLength - 128) + 1;
     }
+    outIndex += count;
+    inIndex += runBytes + 1;
   } // while
 
   return 1;
@@ -729,14 +854,14 @@ int vtkSpyPlotUniReaderRunLengthDataDecode(
 int vtkSpyPlotUniReader::RunLengthDataDecode(
   const unsigned char* in, int inSize, float* out, int outSize)
 {
-  return ::vtkSpyPlotUniReaderRunLengthDataDecode(this, in, inSize, out, outSize);
+  return ::vtkSpyPlotUniReaderRunLengthDataDecode(in, inSize, out, outSize);
 }
 
 //-----------------------------------------------------------------------------
 int vtkSpyPlotUniReader::RunLengthDataDecode(
   const unsigned char* in, int inSize, int* out, int outSize)
 {
-  return ::vtkSpyPlotUniReaderRunLengthDataDecode(this, in, inSize, out, outSize);
+  return ::vtkSpyPlotUniReaderRunLengthDataDecode(in, inSize, out, outSize);
 }
 
 //-----------------------------------------------------------------------------
@@ -744,7 +869,7 @@ int vtkSpyPlotUniReader::RunLengthDataDecode(
   const unsigned char* in, int inSize, unsigned char* out, int outSize)
 {
   return ::vtkSpyPlotUniReaderRunLengthDataDecode(
-    this, in, inSize, out, outSize, static_cast<unsigned char>(255));
+    in, inSize, out, outSize, static_cast<unsigned char>(255));
 }
 
 //-----------------------------------------------------------------------------
@@ -231,16 +231,26 @@ public:
   vtkSetMacro(DataTypeChanged, int);
   void SetDownConvertVolumeFraction(int vf);
 
+  //@{
+  /**
+   * Run-length decodes `inSize` bytes of `in` into the `outSize` values of
+   * `out`. Volume fractions decoded to unsigned char are scaled to [0, 255].
+   * Returns 0 if the runs overflow `in` or `out`. These functions are thread
+   * safe, the reader decodes the planes of the blocks of cell fields
+   * concurrently.
+   */
+  static int RunLengthDataDecode(const unsigned char* in, int inSize, float* out, int outSize);
+  static int RunLengthDataDecode(const unsigned char* in, int inSize, int* out, int outSize);
+  static int RunLengthDataDecode(
+    const unsigned char* in, int inSize, unsigned char* out, int outSize);
+  //@}
+
 protected:
   vtkSpyPlotUniReader();
   ~vtkSpyPlotUniReader() override;
   vtkSpyPlotBlock* Blocks;
 
 private:
-  int RunLengthDataDecode(const unsigned char* in, int inSize, float* out, int outSize);
-  int RunLengthDataDecode(const unsigned char* in, int inSize, int* out, int outSize);
-  int RunLengthDataDecode(const unsigned char* in, int inSize, unsigned char* out, int outSize);
-
   int ReadHeader(vtkSpyPlotIStream* spis);
   int ReadMarkerHeader(vtkSpyPlotIStream* spis);
   int ReadCellVariableInfo(vtkSpyPlotIStream* spis);
@@ -0,0 +1,127 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestPVTemporalDataSetCache.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Tests vtkPVTemporalDataSetCache used as a source, as Catalyst does, with
+// time steps of different sizes: memory accounting, memory limit, serving
+// cached time steps and shallow copies.
+
+#include "vtkDataObject.h"
+#include "vtkInformation.h"
+#include "vtkNew.h"
+#include "vtkPVTemporalDataSetCache.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSmartPointer.h"
+#include "vtkSphereSource.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+
+#define expect(x, msg)                                                                             \
+  if (!(x))                                                                                        \
+  {                                                                                                \
+    cerr << __LINE__ << ": " msg << endl;                                                          \
+    return EXIT_FAILURE;                                                                           \
+  }
+
+namespace
+{
+vtkSmartPointer<vtkPolyData> MakeStep(int step)
+{
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(8 * (step + 1));
+  sphere->SetPhiResolution(8 * (step + 1));
+  sphere->Update();
+  vtkSmartPointer<vtkPolyData> data = sphere->GetOutput();
+  data->GetInformation()->Set(vtkDataObject::DATA_TIME_STEP(), static_cast<double>(step));
+  return data;
+}
+
+vtkTypeInt64 SumOfSteps(vtkPVTemporalDataSetCache* cache)
+{
+  vtkTypeInt64 sum = 0;
+  for (int cc = 0; cc < cache->GetNumberOfCachedTimeSteps(); ++cc)
+  {
+    sum += cache->GetCachedTimeStepMemorySize(cc);
+  }
+  return sum;
+}
+}
+
+int TestPVTemporalDataSetCache(int, char* [])
+{
+  vtkNew<vtkPVTemporalDataSetCache> cache;
+  cache->IsASourceOn();
+  cache->SetCacheSize(10);
+
+  vtkIdType numberOfPoints[5];
+  for (int step = 0; step < 5; ++step)
+  {
+    auto data = MakeStep(step);
+    numberOfPoints[step] = data->GetNumberOfPoints();
+    cache->SetInputDataObject(data);
+    cache->UpdateTimeStep(step);
+  }
+  expect(cache->GetNumberOfCachedTimeSteps() == 5, "all time steps should be cached.");
+  expect(cache->GetCacheMemorySize() > 0 && cache->GetCacheMemorySize() == SumOfSteps(cache),
+    "incorrect memory accounting.");
+  expect(cache->GetCachedTimeStepMemorySize(4) > cache->GetCachedTimeStepMemorySize(0),
+    "larger time steps should use more memory.");
+
+  // cached time steps are advertised and served without the input.
+  cache->UpdateInformation();
+  vtkInformation* outInfo = cache->GetOutputInformation(0);
+  expect(outInfo->Length(vtkStreamingDemandDrivenPipeline::TIME_STEPS()) == 5,
+    "cached time steps should be advertised.");
+  cache->UpdateTimeStep(1);
+  expect(vtkPolyData::SafeDownCast(cache->GetOutputDataObject(0))->GetNumberOfPoints() ==
+      numberOfPoints[1],
+    "cached time step was not served.");
+
+  // the memory limit removes the least recently used time steps, time step 1
+  // was used last before 4.
+  const vtkTypeInt64 limit =
+    cache->GetCachedTimeStepMemorySize(4) + cache->GetCachedTimeStepMemorySize(1);
+  cache->SetMemoryLimit(limit);
+  expect(cache->GetCacheMemorySize() <= limit, "memory limit exceeded.");
+  expect(cache->GetNumberOfCachedTimeSteps() == 2 && cache->GetCachedTimeStep(0) == 1 &&
+      cache->GetCachedTimeStep(1) == 4,
+    "the least recently used time steps should have been removed.");
+
+  // the most recent time step is kept even if it does not fit.
+  cache->SetMemoryLimit(1);
+  expect(cache->GetNumberOfCachedTimeSteps() == 1, "one time step should be kept.");
+  cache->SetMemoryLimit(0);
+
+  // shallow copies share the arrays of the input, deep copies do not.
+  auto data = MakeStep(5);
+  cache->SetInputDataObject(data);
+  cache->UpdateTimeStep(5);
+  auto output = vtkPolyData::SafeDownCast(cache->GetOutputDataObject(0));
+  expect(output->GetPoints()->GetData() != data->GetPoints()->GetData(),
+    "time step should have been deep copied.");
+
+  cache->ShallowCopyOn();
+  data = MakeStep(6);
+  cache->SetInputDataObject(data);
+  cache->UpdateTimeStep(6);
+  output = vtkPolyData::SafeDownCast(cache->GetOutputDataObject(0));
+  expect(output->GetNumberOfPoints() == data->GetNumberOfPoints() &&
+      output->GetPoints()->GetData() == data->GetPoints()->GetData(),
+    "time step should have been shallow copied.");
+  expect(cache->GetCacheMemorySize() == SumOfSteps(cache), "incorrect memory accounting.");
+
+  cache->ClearCache();
+  expect(cache->GetNumberOfCachedTimeSteps() == 0 && cache->GetCacheMemorySize() == 0,
+    "cache should be empty.");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,355 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    vtkPVTemporalDataSetCache.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkPVTemporalDataSetCache.h"
+
+#include "vtkDataObject.h"
+#include "vtkDemandDrivenPipeline.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkObjectFactory.h"
+#include "vtkSmartPointer.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <map>
+#include <vector>
+
+class vtkPVTemporalDataSetCache::vtkInternals
+{
+public:
+  struct CacheEntry
+  {
+    vtkSmartPointer<vtkDataObject> Data;
+    vtkTypeInt64 MemorySize;
+    // pipeline MTime when the time step was cached.
+    vtkMTimeType PipelineMTime;
+    vtkTypeUInt64 LastAccess;
+  };
+
+  // cached time steps, sorted by time.
+  typedef std::map<double, CacheEntry> CacheType;
+  CacheType Cache;
+  vtkTypeInt64 MemorySize = 0;
+
+  // orders the accesses of all the caches. vtkTimeStamp is not used since
+  // it would bump the global modified time on each access.
+  static vtkTypeUInt64 NextAccess()
+  {
+    static std::atomic<vtkTypeUInt64> counter(0);
+    return ++counter;
+  }
+
+  CacheType::iterator GetLeastRecentlyUsed()
+  {
+    CacheType::iterator oldest = this->Cache.begin();
+    for (auto iter = this->Cache.begin(); iter != this->Cache.end(); ++iter)
+    {
+      if (iter->second.LastAccess < oldest->second.LastAccess)
+      {
+        oldest = iter;
+      }
+    }
+    return oldest;
+  }
+
+  void Remove(CacheType::iterator iter)
+  {
+    this->MemorySize -= iter->second.MemorySize;
+    this->Cache.erase(iter);
+  }
+
+  const CacheEntry* GetEntry(int index) const
+  {
+    if (index < 0 || index >= static_cast<int>(this->Cache.size()))
+    {
+      return nullptr;
+    }
+    return &std::next(this->Cache.begin(), index)->second;
+  }
+};
+
+vtkStandardNewMacro(vtkPVTemporalDataSetCache);
+//----------------------------------------------------------------------------
+vtkPVTemporalDataSetCache::vtkPVTemporalDataSetCache()
+  : Internals(new vtkPVTemporalDataSetCache::vtkInternals())
+{
+  this->CacheSize = 10;
+  this->MemoryLimit = 0;
+  this->IsASource = false;
+  this->CacheInMemkind = false;
+  this->ShallowCopy = false;
+}
+
+//----------------------------------------------------------------------------
+vtkPVTemporalDataSetCache::~vtkPVTemporalDataSetCache() = default;
+
+//----------------------------------------------------------------------------
+void vtkPVTemporalDataSetCache::SetCacheSize(int size)
+{
+  if (size < 1)
+  {
+    vtkErrorMacro("Attempt to set cache size to less than 1.");
+    return;
+  }
+  // changing the limits does not change the output.
+  this->CacheSize = size;
+  this->Shrink();
+}
+
+//----------------------------------------------------------------------------
+void vtkPVTemporalDataSetCache::SetMemoryLimit(vtkTypeInt64 limit)
+{
+  this->MemoryLimit = limit > 0 ? limit : 0;
+  this->Shrink();
+}
+
+//----------------------------------------------------------------------------
+vtkTypeInt64 vtkPVTemporalDataSetCache::GetCacheMemorySize() const
+{
+  return this->Internals->MemorySize;
+}
+
+//----------------------------------------------------------------------------
+int vtkPVTemporalDataSetCache::GetNumberOfCachedTimeSteps() const
+{
+  return static_cast<int>(this->Internals->Cache.size());
+}
+
+//----------------------------------------------------------------------------
+double vtkPVTemporalDataSetCache::GetCachedTimeStep(int index) const
+{
+  if (index < 0 || index >= this->GetNumberOfCachedTimeSteps())
+  {
+    vtkErrorMacro("Invalid time step index " << index);
+    return 0.0;
+  }
+  return std::next(this->Internals->Cache.begin(), index)->first;
+}
+
+//----------------------------------------------------------------------------
+vtkTypeInt64 vtkPVTemporalDataSetCache::GetCachedTimeStepMemorySize(int index) const
+{
+  auto entry = this->Internals->GetEntry(index);
+  return entry ? entry->MemorySize : 0;
+}
+
+//----------------------------------------------------------------------------
+vtkTypeUInt64 vtkPVTemporalDataSetCache::GetLeastRecentAccess() const
+{
+  auto& internals = *this->Internals;
+  return internals.Cache.empty() ? 0 : internals.GetLeastRecentlyUsed()->second.LastAccess;
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVTemporalDataSetCache::RemoveLeastRecentlyUsedTimeStep()
+{
+  auto& internals = *this->Internals;
+  if (internals.Cache.size() < 2)
+  {
+    return false;
+  }
+  internals.Remove(internals.GetLeastRecentlyUsed());
+  return true;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVTemporalDataSetCache::ClearCache()
+{
+  this->Internals->Cache.clear();
+  this->Internals->MemorySize = 0;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVTemporalDataSetCache::Shrink()
+{
+  auto& internals = *this->Internals;
+  while (static_cast<int>(internals.Cache.size()) > this->CacheSize ||
+    (this->MemoryLimit > 0 && internals.MemorySize > this->MemoryLimit))
+  {
+    if (!this->RemoveLeastRecentlyUsedTimeStep())
+    {
+      break;
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+int vtkPVTemporalDataSetCache::RequestInformation(
+  vtkInformation*, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  if (!this->IsASource)
+  {
+    // time steps are the ones of the input.
+    return 1;
+  }
+
+  // advertise the cached time steps and the one the input currently holds.
+  std::vector<double> timeSteps;
+  for (const auto& item : this->Internals->Cache)
+  {
+    timeSteps.push_back(item.first);
+  }
+  vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+  vtkDataObject* input = inInfo ? inInfo->Get(vtkDataObject::DATA_OBJECT()) : nullptr;
+  if (input && input->GetInformation()->Has(vtkDataObject::DATA_TIME_STEP()))
+  {
+    const double time = input->GetInformation()->Get(vtkDataObject::DATA_TIME_STEP());
+    if (this->Internals->Cache.find(time) == this->Internals->Cache.end())
+    {
+      timeSteps.insert(std::upper_bound(timeSteps.begin(), timeSteps.end(), time), time);
+    }
+  }
+
+  vtkInformation* outInfo = outputVector->GetInformationObject(0);
+  if (timeSteps.empty())
+  {
+    outInfo->Remove(vtkStreamingDemandDrivenPipeline::TIME_STEPS());
+    outInfo->Remove(vtkStreamingDemandDrivenPipeline::TIME_RANGE());
+  }
+  else
+  {
+    double range[2] = { timeSteps.front(), timeSteps.back() };
+    outInfo->Set(vtkStreamingDemandDrivenPipeline::TIME_STEPS(), timeSteps.data(),
+      static_cast<int>(timeSteps.size()));
+    outInfo->Set(vtkStreamingDemandDrivenPipeline::TIME_RANGE(), range, 2);
+  }
+  return 1;
+}
+
+//----------------------------------------------------------------------------
+int vtkPVTemporalDataSetCache::RequestUpdateExtent(
+  vtkInformation*, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+  vtkInformation* outInfo = outputVector->GetInformationObject(0);
+  if (!inInfo)
+  {
+    return 1;
+  }
+
+  if (this->IsASource)
+  {
+    // never make the input execute for another time step.
+    inInfo->Remove(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP());
+    return 1;
+  }
+
+  // time steps cached before the pipeline was modified are obsolete.
+  auto& internals = *this->Internals;
+  if (auto ddp = vtkDemandDrivenPipeline::SafeDownCast(this->GetExecutive()))
+  {
+    const vtkMTimeType pipelineMTime = ddp->GetPipelineMTime();
+    for (auto iter = internals.Cache.begin(); iter != internals.Cache.end();)
+    {
+      auto current = iter++;
+      if (current->second.PipelineMTime < pipelineMTime)
+      {
+        internals.Remove(current);
+      }
+    }
+  }
+
+  if (outInfo->Has(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP()))
+  {
+    const double time = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP());
+    vtkDataObject* input = inInfo->Get(vtkDataObject::DATA_OBJECT());
+    if (internals.Cache.find(time) != internals.Cache.end() && input &&
+      input->GetInformation()->Has(vtkDataObject::DATA_TIME_STEP()))
+    {
+      // the time step is cached, request the one the input already has so it
+      // does not execute again.
+      inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP(),
+        input->GetInformation()->Get(vtkDataObject::DATA_TIME_STEP()));
+    }
+  }
+  return 1;
+}
+
+//----------------------------------------------------------------------------
+int vtkPVTemporalDataSetCache::RequestData(
+  vtkInformation*, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkDataObject* input = vtkDataObject::GetData(inputVector[0], 0);
+  vtkInformation* outInfo = outputVector->GetInformationObject(0);
+  vtkDataObject* output = vtkDataObject::GetData(outInfo);
+
+  const bool inputHasTime = input && input->GetInformation()->Has(vtkDataObject::DATA_TIME_STEP());
+  const double inputTime =
+    inputHasTime ? input->GetInformation()->Get(vtkDataObject::DATA_TIME_STEP()) : 0.0;
+  const double time = outInfo->Has(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP())
+    ? outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP())
+    : inputTime;
+
+  auto& internals = *this->Internals;
+  auto iter = internals.Cache.find(time);
+  if (iter == internals.Cache.end())
+  {
+    if (!input)
+    {
+      vtkErrorMacro("Time step " << time << " is not cached and there is no input.");
+      return 0;
+    }
+
+    // the input may not provide the requested time step exactly.
+    const double key = inputHasTime ? inputTime : time;
+    iter = internals.Cache.find(key);
+    if (iter == internals.Cache.end())
+    {
+      vtkSmartPointer<vtkDataObject> copy;
+      if (this->ShallowCopy)
+      {
+        copy.TakeReference(input->NewInstance());
+        copy->ShallowCopy(input);
+      }
+      else
+      {
+        vtkMemkindRAII memkind(this->CacheInMemkind);
+        copy.TakeReference(input->NewInstance());
+        copy->DeepCopy(input);
+      }
+
+      vtkInternals::CacheEntry& entry = internals.Cache[key];
+      entry.Data = copy;
+      entry.MemorySize = static_cast<vtkTypeInt64>(copy->GetActualMemorySize()) * 1024;
+      auto ddp = vtkDemandDrivenPipeline::SafeDownCast(this->GetExecutive());
+      entry.PipelineMTime = ddp ? ddp->GetPipelineMTime() : 0;
+      internals.MemorySize += entry.MemorySize;
+      iter = internals.Cache.find(key);
+    }
+  }
+
+  iter->second.LastAccess = vtkInternals::NextAccess();
+  output->ShallowCopy(iter->second.Data);
+  output->GetInformation()->Set(vtkDataObject::DATA_TIME_STEP(), iter->first);
+
+  // the time step just used is the most recently used one, it is kept.
+  this->Shrink();
+  return 1;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVTemporalDataSetCache::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "CacheSize: " << this->CacheSize << endl;
+  os << indent << "MemoryLimit: " << this->MemoryLimit << endl;
+  os << indent << "IsASource: " << this->IsASource << endl;
+  os << indent << "CacheInMemkind: " << this->CacheInMemkind << endl;
+  os << indent << "ShallowCopy: " << this->ShallowCopy << endl;
+  os << indent << "NumberOfCachedTimeSteps: " << this->GetNumberOfCachedTimeSteps() << endl;
+  os << indent << "CacheMemorySize: " << this->GetCacheMemorySize() << endl;
+}
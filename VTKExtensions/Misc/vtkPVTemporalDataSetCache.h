@@ -0,0 +1,159 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    vtkPVTemporalDataSetCache.h
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkPVTemporalDataSetCache
+ * @brief   cache time steps, bounded by count and memory.
+ *
+ * vtkPVTemporalDataSetCache keeps copies of its input at several time steps,
+ * like vtkTemporalDataSetCache, so that downstream temporal filters do not
+ * make the input execute again. Besides the maximum number of time steps, the
+ * cache can be bounded by the memory used by the cached data, as reported by
+ * `GetActualMemorySize()`. The least recently used time steps are removed
+ * first and the most recently used one is always kept.
+ *
+ * When IsASource is true, the filter advertises the cached time steps
+ * downstream and never requests a time step from its input: each update caches
+ * the data the input currently holds. This is how Catalyst uses it.
+ *
+ * Time steps are deep copied unless ShallowCopy is true. Shallow copies share
+ * the arrays of the input, e.g. buffers owned by a simulation, and are only
+ * valid if these arrays are not modified afterwards.
+ */
+
+#ifndef vtkPVTemporalDataSetCache_h
+#define vtkPVTemporalDataSetCache_h
+
+#include "vtkPVVTKExtensionsMiscModule.h" // needed for export macro
+#include "vtkPassInputTypeAlgorithm.h"
+
+#include <memory> // for std::unique_ptr
+
+class VTKPVVTKEXTENSIONSMISC_EXPORT vtkPVTemporalDataSetCache : public vtkPassInputTypeAlgorithm
+{
+public:
+  static vtkPVTemporalDataSetCache* New();
+  vtkTypeMacro(vtkPVTemporalDataSetCache, vtkPassInputTypeAlgorithm);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  //@{
+  /**
+   * Get/Set the maximum number of time steps in the cache. Default is 10.
+   */
+  void SetCacheSize(int size);
+  vtkGetMacro(CacheSize, int);
+  //@}
+
+  //@{
+  /**
+   * Get/Set the maximum memory used by the cached time steps, in bytes.
+   * 0 (default) means no limit.
+   */
+  void SetMemoryLimit(vtkTypeInt64 limit);
+  vtkGetMacro(MemoryLimit, vtkTypeInt64);
+  //@}
+
+  //@{
+  /**
+   * When true, the filter acts as a pipeline source rather than a filter.
+   * Default is false.
+   */
+  vtkSetMacro(IsASource, bool);
+  vtkGetMacro(IsASource, bool);
+  vtkBooleanMacro(IsASource, bool);
+  //@}
+
+  //@{
+  /**
+   * When true, the time steps are copied in memkind extended memory.
+   * Ignored for shallow copies. Default is false.
+   */
+  vtkSetMacro(CacheInMemkind, bool);
+  vtkGetMacro(CacheInMemkind, bool);
+  vtkBooleanMacro(CacheInMemkind, bool);
+  //@}
+
+  //@{
+  /**
+   * When true, time steps added to the cache share the arrays of the input
+   * instead of copying them. Default is false.
+   */
+  vtkSetMacro(ShallowCopy, bool);
+  vtkGetMacro(ShallowCopy, bool);
+  vtkBooleanMacro(ShallowCopy, bool);
+  //@}
+
+  /**
+   * Returns the memory used by the cached time steps, in bytes.
+   */
+  vtkTypeInt64 GetCacheMemorySize() const;
+
+  //@{
+  /**
+   * Returns the cached time steps, in increasing order, and the memory used by
+   * each of them in bytes.
+   */
+  int GetNumberOfCachedTimeSteps() const;
+  double GetCachedTimeStep(int index) const;
+  vtkTypeInt64 GetCachedTimeStepMemorySize(int index) const;
+  //@}
+
+  /**
+   * Returns when the least recently used time step was last used, or 0 if the
+   * cache is empty. Accesses are numbered by a counter shared by all the
+   * caches of the process, so caches sharing a memory budget use it to remove
+   * the oldest time step of all of them first.
+   */
+  vtkTypeUInt64 GetLeastRecentAccess() const;
+
+  /**
+   * Removes the least recently used time step, unless it is the only one.
+   * Returns true if a time step was removed.
+   */
+  bool RemoveLeastRecentlyUsedTimeStep();
+
+  /**
+   * Removes all the cached time steps.
+   */
+  void ClearCache();
+
+protected:
+  vtkPVTemporalDataSetCache();
+  ~vtkPVTemporalDataSetCache() override;
+
+  int RequestInformation(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+  int RequestUpdateExtent(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+  int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+
+  int CacheSize;
+  vtkTypeInt64 MemoryLimit;
+  bool IsASource;
+  bool CacheInMemkind;
+  bool ShallowCopy;
+
+private:
+  vtkPVTemporalDataSetCache(const vtkPVTemporalDataSetCache&) = delete;
+  void operator=(const vtkPVTemporalDataSetCache&) = delete;
+
+  /**
+   * Removes the least recently used time steps until the cache fits its
+   * limits.
+   */
+  void Shrink();
+
+  class vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
+};
+
+#endif
@@ -24,6 +24,7 @@
 #include "vtkTestUtilities.h"
 #include "vtkUnsignedCharArray.h"
 
+#include <algorithm>
 #include <float.h>
 // ----------------------------------------------------------------------------
 void fillArray(vtkDoubleArray* array, double* dataPointer, int dataSize, const char* name)
@@ -164,6 +165,59 @@ int sortMagnitudeOnUnsignedCharVector()
   return EXIT_SUCCESS;
 }
 
+// ----------------------------------------------------------------------------
+// Fetch every block in both orders, switching the order between blocks, and
+// make sure that the blocks put together give the sorted array.
+int sortAcrossBlocks(bool debug)
+{
+  const int size = 100;
+  const int blockSize = 7;
+  double dataArray[size];
+  double sortedArray[size];
+  double invertedArray[size];
+  for (int i = 0; i < size; i++)
+  {
+    dataArray[i] = (i * 37) % 25;
+  }
+  std::copy(dataArray, dataArray + size, sortedArray);
+  std::sort(sortedArray, sortedArray + size);
+  std::reverse_copy(sortedArray, sortedArray + size, invertedArray);
+
+  vtkSmartPointer<vtkDoubleArray> dataToSort = vtkSmartPointer<vtkDoubleArray>::New();
+  fillArray(dataToSort.GetPointer(), dataArray, size, "data");
+
+  vtkSmartPointer<vtkTable> input = vtkSmartPointer<vtkTable>::New();
+  input->AddColumn(dataToSort);
+
+  vtkSmartPointer<vtkSortedTableStreamer> sortingfilter =
+    vtkSmartPointer<vtkSortedTableStreamer>::New();
+  sortingfilter->SetInputData(input.GetPointer());
+  sortingfilter->SetSelectedComponent(0);
+  sortingfilter->SetColumnNameToSort("data");
+  sortingfilter->SetBlockSize(blockSize);
+
+  for (int block = 0; block * blockSize < size; block++)
+  {
+    int blockStart = block * blockSize;
+    int count = std::min(blockSize, size - blockStart);
+    for (int invert = 0; invert < 2; invert++)
+    {
+      sortingfilter->SetInvertOrder(invert);
+      sortingfilter->SetBlock(block);
+      sortingfilter->Update();
+
+      double* expected = (invert ? invertedArray : sortedArray) + blockStart;
+      if (!compareArray(sortingfilter->GetOutput(), "data", expected, count, debug))
+      {
+        cout << "Invalid block " << block << (invert ? " (inverted)" : "") << endl;
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
+
 // ----------------------------------------------------------------------------
 int TestSortingTable(int vtkNotUsed(argc), char** vtkNotUsed(argv))
 {
@@ -183,6 +237,9 @@ int TestSortingTable(int vtkNotUsed(argc), char** vtkNotUsed(argv))
   cout << "Testing sorting with magnitude on unsigned char: "
        << ((result += sortMagnitudeOnUnsignedCharVector()) ? "FAILED" : "SUCCESS") << endl;
   // --------------------------------------------------------------------------
+  cout << "Testing sorting across blocks: "
+       << ((result += sortAcrossBlocks(debug)) ? "FAILED" : "SUCCESS") << endl;
+  // --------------------------------------------------------------------------
   // --------------------------------------------------------------------------
 
   // Delete Fake MPI controller
@@ -0,0 +1,109 @@
+"""
+This module benchmarks the cost of gathering data information from all ranks
+of a parallel server.
+
+A multiblock dataset with a configurable number of blocks per rank is
+generated and the vtkPVDataInformation for it is gathered repeatedly, once
+with the flat gather (every rank sends its serialized information to the root
+which merges them serially) and once with the tree reduction (ranks merge
+pairwise in log(P) steps). Run it with increasing number of ranks to see how
+the gather cost scales, e.g.::
+
+    mpiexec -n 64 pvbatch -m paraview.benchmark.gatherinformation -b 100
+
+"""
+
+from __future__ import print_function
+
+import datetime as dt
+from paraview import servermanager
+from paraview.simple import *
+
+source_script = """
+from paraview.vtk.vtkCommonDataModel import vtkImageData
+from paraview.vtk.vtkCommonCore import vtkFloatArray
+from paraview.vtk.vtkParallelCore import vtkMultiProcessController
+
+controller = vtkMultiProcessController.GetGlobalController()
+rank = controller.GetLocalProcessId() if controller else 0
+nranks = controller.GetNumberOfProcesses() if controller else 1
+
+output = self.GetOutput()
+output.SetNumberOfBlocks(nranks * %(blocks)d)
+for i in range(%(blocks)d):
+    img = vtkImageData()
+    img.SetDimensions(%(dimension)d, %(dimension)d, %(dimension)d)
+    img.SetOrigin(rank * %(dimension)d, i * %(dimension)d, 0)
+    for a in range(%(arrays)d):
+        arr = vtkFloatArray()
+        arr.SetName('array%%d' %% a)
+        arr.SetNumberOfTuples(img.GetNumberOfPoints())
+        arr.Fill(rank + a)
+        img.GetPointData().AddArray(arr)
+    output.SetBlock(rank * %(blocks)d + i, img)
+"""
+
+
+def gather(proxy, tree_reduction, num_iterations):
+    '''Gathers data information for `proxy` `num_iterations` times and
+    returns the average time in seconds.'''
+    from paraview.modules.vtkRemotingCore import vtkPVDataInformation, vtkPVSession
+    session = proxy.GetSession()
+    t0 = dt.datetime.now()
+    for i in range(num_iterations):
+        info = vtkPVDataInformation()
+        info.SetPortNumber(0)
+        info.SetUseTreeReduction(tree_reduction)
+        session.GatherInformation(vtkPVSession.DATA_SERVER, info, proxy.GetGlobalID())
+    t1 = dt.datetime.now()
+    return (t1 - t0).total_seconds() / num_iterations, info
+
+
+def run(num_blocks=10, dimension=4, num_arrays=4, num_iterations=10):
+    from vtkmodules.vtkParallelCore import vtkMultiProcessController
+    controller = vtkMultiProcessController.GetGlobalController()
+    nranks = controller.GetNumberOfProcesses() if controller else 1
+
+    source = ProgrammableSource()
+    source.OutputDataSetType = 'vtkMultiBlockDataSet'
+    source.Script = source_script % {
+        'blocks': num_blocks, 'dimension': dimension, 'arrays': num_arrays}
+    source.UpdatePipeline()
+
+    flat, flat_info = gather(source.SMProxy, False, num_iterations)
+    tree, tree_info = gather(source.SMProxy, True, num_iterations)
+
+    if flat_info.GetNumberOfPoints() != tree_info.GetNumberOfPoints() or \
+            flat_info.GetNumberOfCells() != tree_info.GetNumberOfCells() or \
+            flat_info.GetBounds() != tree_info.GetBounds() or \
+            flat_info.GetNumberOfDataSets() != tree_info.GetNumberOfDataSets() or \
+            flat_info.GetDataSetType() != tree_info.GetDataSetType():
+        raise RuntimeError('Flat and tree reductions gathered different information')
+
+    print('Ranks:', nranks)
+    print('Blocks:', nranks * num_blocks)
+    print('Flat gather (s):', flat)
+    print('Tree reduction (s):', tree)
+    return (nranks, flat, tree)
+
+
+def main(argv):
+    import argparse
+    parser = argparse.ArgumentParser(
+        description='Benchmark ParaView data information gathering')
+    parser.add_argument('-b', '--blocks', default=10, type=int,
+                        help='Number of blocks generated on each rank')
+    parser.add_argument('-d', '--dimension', default=4, type=int,
+                        help='The dimension of each side of each block')
+    parser.add_argument('-a', '--arrays', default=4, type=int,
+                        help='Number of point arrays on each block')
+    parser.add_argument('-i', '--iterations', default=10, type=int,
+                        help='Number of times the information is gathered')
+
+    args = parser.parse_args(argv)
+    run(num_blocks=args.blocks, dimension=args.dimension,
+        num_arrays=args.arrays, num_iterations=args.iterations)
+
+if __name__ == "__main__":
+    import sys
+    main(sys.argv[1:])
@@ -2119,6 +2119,33 @@ class Connection(object):
         if self.Alive:
            self.close()
 
+class MessageBatch(object):
+    """Context manager that queues the messages pushed to the servers, such
+    as property values and proxy registrations, and sends them together when
+    the block exits. Any call that needs a reply from the servers sends the
+    queued messages first, so it is always safe to use. Batches nest.
+
+    Example::
+
+        with servermanager.MessageBatch():
+            for i in range(100):
+                s = simple.Sphere(Center=[i, 0, 0])
+    """
+    def __init__(self, session=None):
+        if not session and ActiveConnection:
+            session = ActiveConnection.Session
+        self.Session = session
+
+    def __enter__(self):
+        if self.Session:
+            self.Session.BeginMessageBatch()
+        return self
+
+    def __exit__(self, exc_type, exc_value, traceback):
+        if self.Session:
+            self.Session.EndMessageBatch()
+        return False
+
 def SaveState(filename):
     """Given a state filename, saves the state of objects registered
     with the proxy manager."""
@@ -635,11 +635,12 @@ def Show(proxy=None, view=None, representationType=None, **params):
         # if possible.
         view = active_objects.view
     controller = servermanager.ParaViewPipelineController()
-    rep = controller.Show(proxy, proxy.Port, view, representationType)
-    if rep == None:
-        raise RuntimeError ("Could not create a representation object for proxy %s" % proxy.GetXMLLabel())
-    for param in params.keys():
-        setattr(rep, param, params[param])
+    with servermanager.MessageBatch():
+        rep = controller.Show(proxy, proxy.Port, view, representationType)
+        if rep == None:
+            raise RuntimeError ("Could not create a representation object for proxy %s" % proxy.GetXMLLabel())
+        for param in params.keys():
+            setattr(rep, param, params[param])
     return rep
 
 # -----------------------------------------------------------------------------
@@ -2437,61 +2438,64 @@ def _create_func(key, module, skipRegisteration=False):
               registrationName = params[nameParam]
               del params[nameParam]
 
-        # Create a controller instance.
-        controller = servermanager.ParaViewPipelineController()
-
-        from .catalyst.detail import IsInsituInput, CreateProducer
-        if IsInsituInput(registrationName):
-            # This is a catalyst input, replace with a trivial producer
-            px = CreateProducer(registrationName)
-        else:
-            # Instantiate the actual object from the given module.
-            px = paraview._backwardscompatibilityhelper.GetProxy(module, key, no_update=True)
-
-        # preinitialize the proxy.
-        controller.PreInitializeProxy(px)
+        # Send the messages for creating, initializing and registering the proxy
+        # to the servers together.
+        with servermanager.MessageBatch():
+            # Create a controller instance.
+            controller = servermanager.ParaViewPipelineController()
 
-        # Make sure non-keyword arguments are valid
-        for inp in input:
-            if inp != None and not isinstance(inp, servermanager.Proxy):
-                if px.GetProperty("Input") != None:
-                    raise RuntimeError ("Expecting a proxy as input.")
+            from .catalyst.detail import IsInsituInput, CreateProducer
+            if IsInsituInput(registrationName):
+                # This is a catalyst input, replace with a trivial producer
+                px = CreateProducer(registrationName)
+            else:
+                # Instantiate the actual object from the given module.
+                px = paraview._backwardscompatibilityhelper.GetProxy(module, key, no_update=True)
+
+            # preinitialize the proxy.
+            controller.PreInitializeProxy(px)
+
+            # Make sure non-keyword arguments are valid
+            for inp in input:
+                if inp != None and not isinstance(inp, servermanager.Proxy):
+                    if px.GetProperty("Input") != None:
+                        raise RuntimeError ("Expecting a proxy as input.")
+                    else:
+                        raise RuntimeError ("This function does not accept non-keyword arguments.")
+
+            # Assign inputs
+            inputName = servermanager.vtkSMCoreUtilities.GetInputPropertyName(px.SMProxy, 0)
+
+            if px.GetProperty(inputName) != None:
+                if len(input) > 0:
+                    px.SetPropertyWithName(inputName, input)
                 else:
-                    raise RuntimeError ("This function does not accept non-keyword arguments.")
-
-        # Assign inputs
-        inputName = servermanager.vtkSMCoreUtilities.GetInputPropertyName(px.SMProxy, 0)
-
-        if px.GetProperty(inputName) != None:
-            if len(input) > 0:
-                px.SetPropertyWithName(inputName, input)
+                    # If no input is specified, try the active pipeline object
+                    if px.GetProperty(inputName).GetRepeatable() and active_objects.get_selected_sources():
+                        px.SetPropertyWithName(inputName, active_objects.get_selected_sources())
+                    elif active_objects.source:
+                        px.SetPropertyWithName(inputName, active_objects.source)
             else:
-                # If no input is specified, try the active pipeline object
-                if px.GetProperty(inputName).GetRepeatable() and active_objects.get_selected_sources():
-                    px.SetPropertyWithName(inputName, active_objects.get_selected_sources())
-                elif active_objects.source:
-                    px.SetPropertyWithName(inputName, active_objects.source)
-        else:
-            if len(input) > 0:
-                raise RuntimeError ("This function does not expect an input.")
-
-        # Pass all the named arguments as property,value pairs
-        SetProperties(px, **params)
-
-        # post initialize
-        controller.PostInitializeProxy(px)
-
-        if isinstance(px, servermanager.MultiplexerSourceProxy):
-            px.UpdateDynamicProperties()
-
-        if not skipRegisteration:
-            # Register the proxy with the proxy manager (assuming we are only using
-            # these functions for pipeline proxies or animation proxies.
-            if isinstance(px, servermanager.SourceProxy):
-                controller.RegisterPipelineProxy(px, registrationName)
-            elif px.GetXMLGroup() == "animation":
-               controller.RegisterAnimationProxy(px)
-        return px
+                if len(input) > 0:
+                    raise RuntimeError ("This function does not expect an input.")
+
+            # Pass all the named arguments as property,value pairs
+            SetProperties(px, **params)
+
+            # post initialize
+            controller.PostInitializeProxy(px)
+
+            if isinstance(px, servermanager.MultiplexerSourceProxy):
+                px.UpdateDynamicProperties()
+
+            if not skipRegisteration:
+                # Register the proxy with the proxy manager (assuming we are only using
+                # these functions for pipeline proxies or animation proxies.
+                if isinstance(px, servermanager.SourceProxy):
+                    controller.RegisterPipelineProxy(px, registrationName)
+                elif px.GetXMLGroup() == "animation":
+                   controller.RegisterAnimationProxy(px)
+            return px
 
     return CreateObject
 